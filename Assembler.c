@@ -2,130 +2,961 @@
 #include <string.h>
 #include <stdlib.h>
 #include <ctype.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <elf.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <errno.h>
+#include <time.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <signal.h>
+#include <poll.h>
+#include "Assembler.h"
 
-#define MAXLINE 1024
-#define MAX_SYMBOLS 1024
+#define MAX_OPERAND 256
+#define ARENA_BLOCK_SIZE 65536
+#define OPCODE_FILE "opcode.csv"
+#define MAX_RELAX_PASSES 32
+#define MAX_INSN_LEN 16
+#define LISTING_BUFFER_SIZE (1 << 20)
+#define MAX_WRITE_IOVS 1024         // iovecs per writev(), IOV_MAX on Linux
+#define REPEAT_FILL_SIZE (1 << 20)  // Largest buffer of times copies built for the output
+#define MAX_LIST_DATA 8             // Bytes of a data line shown in the listing
+#define MAX_THREADS 64
+#define MIN_CHUNK_SIZE (1 << 16)    // Smallest source chunk worth a thread
+#define MIN_ENCODE_NODES 4096       // Smallest IR range worth a thread in pass 2
+#define CACHE_FORMAT 12             // Bump whenever parsing, encoding or the cache layout changes
+#define CACHE_BLOCK_LINES 256       // Longest cache block without a label
+#define MEMO_SLOTS 4096             // Encoding memo entries per pass-1 thread (power of two)
+#define MEMO_KEY_LEN 48             // Longest normalized instruction the memo keeps
+#define MAX_MACRO_DEPTH 64          // Macro expansions nested in one another
 
-typedef enum {
-    DB,
-    DW,
-    DD,
-    DQ
-} DATATYPE;
+// A slice of the source text: not NUL-terminated, valid while the source
+// stays mapped
+typedef struct {
+    const char *ptr;
+    int len;
+} STRVIEW;
 
+// Token kinds produced by next_token(). Punctuation tokens use their
+// character as the kind.
 typedef enum {
-    SEC_NONE,
-    SEC_DATA,
-    SEC_TEXT,
-    SEC_BSS
-} Section;
+    TOK_END,        // End of line or start of a comment
+    TOK_IDENT,
+    TOK_REGISTER,
+    TOK_NUMBER,
+    TOK_STRING,     // Quoted string or character constant
+    TOK_ERROR,
+    TOK_COMMA = ',',
+    TOK_COLON = ':',
+    TOK_LBRACKET = '[',
+    TOK_RBRACKET = ']',
+    TOK_PLUS = '+',
+    TOK_MINUS = '-',
+    TOK_STAR = '*'
+} TokenKind;
+
+typedef struct {
+    unsigned char kind;      // TokenKind
+    signed char reg;         // TOK_REGISTER: register id
+    long value;              // TOK_NUMBER: value
+    STRVIEW text;            // Token text; for strings, without the quotes
+} TOKEN;
+
+// Lexer position within one line
+typedef struct {
+    const char *pos;
+    const char *end;
+} LEXER;
 
 typedef enum {
-    SYM_LABEL,
-    SYM_VARIABLE,
-    SYM_EXTERN,
-    SYM_GLOBAL
-} SymType;
+    OPD_NONE,
+    OPD_REG,
+    OPD_IMM,
+    OPD_SYM,
+    OPD_MEM
+} OperandKind;
+
+// Effective address [base + index*scale + disp]
+typedef struct {
+    signed char base;        // Register id, -1 if none
+    signed char index;       // Register id, -1 if none
+    unsigned char scale;     // 1, 2, 4 or 8
+    int disp;
+} MEMEXPR;
 
+// One parsed instruction operand
 typedef struct {
-    char variable[100]; 
-    DATATYPE size;
-    char value[300];
-} SECTIONENTRY;
+    unsigned char kind;      // OperandKind
+    signed char reg;         // OPD_REG: register id
+    int imm;                 // OPD_IMM: value
+    STRVIEW sym;             // OPD_SYM name, or the symbol in an OPD_MEM address
+    MEMEXPR mem;             // OPD_MEM
+} OPERAND;
+
+// Operand combinations; operand_type_name[] gives the opcode table's
+// spelling of each
+typedef enum {
+    OPT_NOOP,
+    OPT_R,
+    OPT_I,
+    OPT_RR,
+    OPT_RI,
+    OPT_MR,
+    OPT_RM,
+    OPT_M,
+    OPT_MI,
+    OPT_II,
+    OPT_INVALID
+} OperandType;
 
 typedef struct {
-    char name[100];
+    const char *name;  // Interned in the assembly arena
+    unsigned int hash;
     unsigned int address;
     SymType type;
     int defined;  // 1 if defined, 0 if extern/forward reference
     int size;     // Size in bytes for variables
-    char section[20];  // Which section (.text, .data, .bss)
+    Section section;  // Which section (SEC_NONE for externs)
+    int is_global;    // Declared with 'global'; kept when the label is defined
 } SYMBOL;
 
-SECTIONENTRY data[1024];
-SECTIONENTRY TEXT[1024];
-int datacount = 0;
+typedef struct ARENABLOCK {
+    struct ARENABLOCK *next;
+    size_t used;
+    size_t capacity;
+    _Alignas(16) char data[];
+} ARENABLOCK;
+
+// Bump allocator for what lives exactly as long as one assembly: interned
+// symbol names and the scratch of writing the output. Nothing is freed on
+// its own; arena_reset() takes everything back in O(1) and keeps the
+// blocks, so the next file fills the same memory.
+typedef struct {
+    ARENABLOCK *first;      // Every block, in the order they are filled
+    ARENABLOCK *current;    // Block being filled
+    size_t in_use;          // Bytes handed out since the last reset
+    size_t high_water;      // Most bytes in use at once since the arena was made
+    size_t allocated;       // Bytes of all blocks, obtained from malloc
+} ARENA;
+
+typedef struct {
+    char mnemonic[16];      // Uppercase mnemonic, e.g. "MOV"
+    char type[8];           // Operand type, e.g. "RR", "RI", "NOOP"
+    unsigned char bytes[4]; // Opcode bytes ("0FBE" -> 0F BE)
+    int len;                // Number of opcode bytes
+    int ext;                // ModR/M reg field of group opcodes ("83 /5" -> 5), -1 if none
+} OPCODE;
+
+typedef enum {
+    IR_BLANK,   // Empty line
+    IR_TEXT,    // Listing only: directives, comments, bss lines
+    IR_LABEL,   // Label on a line of its own
+    IR_INSN,    // Encodable instruction
+    IR_DATA,    // db/dw/dd/dq line, encoded from its text in pass 2
+    IR_BLOB     // incbin: bytes stay in the file until the output is written
+} IRKind;
+
+// One pass-1 record per source line. Pass 2 encodes and lists from these
+// without touching the source text again.
+typedef struct {
+    unsigned char kind;      // IRKind
+    unsigned char section;   // Section
+    unsigned char near;      // Branch widened from rel8 to rel32 by relax_branches()
+    unsigned char type;      // OperandType
+    unsigned int size;       // Bytes this line occupies in its section (one copy with times)
+    unsigned int repeat;     // times count above 1: the bytes are stored once, 0 otherwise
+    int line;                // Source line number
+    int label;               // Symbol index + 1 of a label defined here, 0 if none
+    int target;              // Symbol index + 1 of a branch target, 0 if none
+    unsigned int address;    // Offset within the section
+    int text_len;
+    unsigned int offset;     // Offset in the section buffer: address less the refs before it
+    const char *text;        // Original line in the mapped source
+    const OPCODE *opcode;
+    const unsigned char *bytes;   // Encoding taken from the cache, NULL if pass 2 encodes
+    OPERAND op1;             // Parsed operands, OPD_NONE if absent
+    OPERAND op2;
+} IRNODE;
+
+// Encoded bytes of one section, written out in one piece
+typedef struct {
+    unsigned char *data;
+    size_t size;
+    size_t capacity;
+} SECTIONBUF;
+
+// Relocation recorded by pass 2 (R_386_32 or R_386_PC32)
+typedef struct {
+    unsigned int offset;     // Offset of the field within its section
+    unsigned char section;   // Section holding the field
+    unsigned char type;
+    int symbol;              // Index into symbol_table
+} RELOC;
+
+typedef struct {
+    RELOC *items;
+    int count;
+    int capacity;
+} RELOCLIST;
+
+typedef enum {
+    REF_BLOB,       // incbin: bytes of a file
+    REF_REPEAT      // times: more copies of the unit bytes stored just before it
+} RefKind;
+
+// Section bytes kept by reference instead of in the section buffer, and
+// only produced when the output is written: a file included with incbin,
+// or the repeats of a times line
+typedef struct {
+    unsigned int address;    // Offset within the section
+    unsigned int size;
+    unsigned char section;   // Section
+    unsigned char kind;      // RefKind
+    unsigned int unit;       // REF_REPEAT: bytes in one copy
+    STRVIEW path;            // REF_BLOB: file name, in the source text
+    off_t offset;            // REF_BLOB: where the bytes start in the file
+    void *map;               // While the output is written: the file mapping,
+    size_t map_size;         // or a buffer of copies (in the arena) for REF_REPEAT
+} SECTIONREF;
+
+typedef struct {
+    SECTIONREF *items;
+    int count;
+    int capacity;
+} REFLIST;
+
+// Pieces of an output file, written with as few writev() calls as
+// MAX_WRITE_IOVS allows
+typedef struct {
+    struct iovec *items;
+    int count;
+    int capacity;
+} IOVLIST;
+
+// Symbol definition or declaration seen by a pass-1 chunk, applied to the
+// symbol table in source order once chunk addresses are known
+typedef struct {
+    STRVIEW name;
+    unsigned int address;    // Chunk-relative when defined
+    int size;
+    int node;                // Chunk IR index of the defining line, -1 if none
+    unsigned char type;      // SymType
+    unsigned char section;   // Section
+    unsigned char defined;
+} SYMEVENT;
+
+// Preprocessor: %define, %macro and %rep. Definitions are collected by
+// scan_macros() before pass 1, and a macro body is lexed once, into pieces
+// of literal text and parameter references, so expanding it only copies
+// pieces. Expanded lines are parsed as they are produced.
+typedef enum {
+    PIECE_TEXT,     // Body text, copied as is
+    PIECE_PARAM,    // %1, %2, ...: an argument
+    PIECE_COUNT,    // %0: the number of arguments
+    PIECE_LOCAL     // %%name: a label unique to each expansion
+} PieceKind;
+
+typedef struct {
+    unsigned char kind;      // PieceKind
+    unsigned char param;     // PIECE_PARAM: argument number, from 1
+    int len;
+    const char *text;        // PIECE_TEXT: the text; PIECE_LOCAL: the name
+} MACROPIECE;
+
+typedef enum {
+    MACRO_DEFINE,   // %define name value
+    MACRO_MULTI,    // %macro name params ... %endmacro
+    MACRO_UNDEF     // %undef name: no definition from here on
+} MacroKind;
+
+// One definition of a name. It is in effect after its line, until the
+// next definition of the name (prev links back to the one before).
+typedef struct {
+    STRVIEW name;
+    unsigned int hash;
+    int line;
+    unsigned char kind;      // MacroKind
+    unsigned char has_locals;     // Uses %%labels: expansions all differ, so none are cached
+    int params;
+    STRVIEW value;           // MACRO_DEFINE: replacement, already expanded
+    int first_line;          // MACRO_MULTI: body lines in MACROTABLE.lines
+    int line_count;
+    int prev;                // Index of the name's previous definition, -1 if none
+} MACRO;
+
+typedef struct {
+    int first;               // Pieces of one body line in MACROTABLE.pieces
+    int count;
+} MACROLINE;
+
+// A %macro or %rep block in the source: pass 1 chunks are not split inside one
+typedef struct {
+    const char *start;
+    const char *end;
+} MACROBLOCK;
+
+typedef struct {
+    MACRO *macros;
+    int count;
+    int capacity;
+    MACROPIECE *pieces;
+    int piece_count;
+    int piece_capacity;
+    MACROLINE *lines;
+    int line_count;
+    int line_capacity;
+    MACROBLOCK *blocks;
+    int block_count;
+    int block_capacity;
+    int *index;              // Open addressing: newest definition's index + 1, 0 = empty
+    unsigned int index_mask;
+    unsigned int define_first[8];   // Bitmaps of the first characters of %define'd
+    unsigned int macro_first[8];    // and %macro names: a cheap filter before lookups
+    int active;              // The source has preprocessor lines
+    int defines;             // Some %define: every line is checked for its names
+    int multi;               // Some %macro: first words are checked for invocations
+    int sections;            // A body switches sections: pass 1 runs as one chunk
+} MACROTABLE;
+
+// A cached expansion: a macro's body with one set of arguments
+typedef struct {
+    unsigned int hash;       // 0 = empty slot
+    int macro;
+    int argc;
+    const STRVIEW *args;
+    const char *text;        // Expanded lines, each ending in '\n'
+    int len;
+} EXPANSION;
+
+// Macro expansions of one pass-1 worker. The text stays for pass 2 and the
+// listing; the arena and the table start over with each assembly.
+typedef struct {
+    ARENA arena;
+    EXPANSION *slots;
+    unsigned int mask;
+    int count;
+    int *local_lines;        // Open addressing: source lines that made %%labels
+    int *local_seqs;         // and how many expansions each has made so far
+    unsigned int local_mask;
+    int local_count;
+} EXPANSIONS;
+
+// Buffers a pass-1 chunk and a pass-2 range fill, kept by the assembler
+// (one set per worker) so that assembling again reuses them
+typedef struct {
+    IRNODE *ir;
+    int ir_capacity;
+    SYMEVENT *syms;
+    int sym_capacity;
+    REFLIST refs;
+    RELOCLIST relocs;
+    EXPANSIONS expansions;
+} WORKERBUFS;
+
+// Header of an incremental cache file (--cache). The entries follow.
+typedef struct {
+    char magic[4];                // "ASMC"
+    unsigned int format;          // CACHE_FORMAT
+    unsigned int opcodes;         // opcode_table_version() of the build
+    unsigned int optimize_size;   // -Os of the build
+    unsigned int entry_count;
+} CACHEHEADER;
+
+// One cached block of source lines, keyed by two hashes of its text and
+// the section in effect at its first line. Followed by node_count CACHENODEs,
+// sym_count CACHESYMs, two OPERANDs per instruction that is not stored
+// pre-encoded, then byte_count encoded bytes; each part 8-byte aligned.
+typedef struct {
+    unsigned long long hash;      // FNV-1a of the block text
+    unsigned long long hash2;     // block_check() of it, compared before replaying
+    unsigned int text_len;
+    unsigned int size;            // Whole entry in bytes
+    unsigned int node_count;      // One per line
+    unsigned int sym_count;
+    unsigned int operand_count;
+    unsigned int byte_count;
+    unsigned char section;        // Section in effect at the first line
+    unsigned char pad[3];
+    unsigned int check;           // entry_check() of the rest of the entry
+} CACHEENTRY;
+
+// A cached IR node. Text, line and address are not stored: they follow
+// from the block's lines and the running section counters.
+typedef struct {
+    unsigned char kind;           // IRKind
+    unsigned char section;        // Section
+    unsigned char type;           // OperandType
+    unsigned char encoded;        // Bytes are stored; operands are not
+    unsigned int opcode;          // opcode_id(), IR_INSN only
+    unsigned int size;
+} CACHENODE;
+
+// A cached SYMEVENT; name and addresses are relative to the block
+typedef struct {
+    unsigned int name;            // Offset of the name in the block text
+    int name_len;
+    unsigned int address;
+    int size;
+    int node;                     // Block node index, -1 if none
+    unsigned char type;
+    unsigned char section;
+    unsigned char defined;
+    unsigned char pad;
+} CACHESYM;
+
+// A run of entries to save: from the mapped previous file (reused blocks)
+// or, when mapped is NULL, at offset in the new entries
+typedef struct {
+    const unsigned char *mapped;
+    size_t offset;
+    size_t size;
+} CACHEPIECE;
+
+typedef struct {
+    CACHEPIECE *items;
+    int count;
+    int capacity;
+} PIECELIST;
+
+// Incremental cache of one input: the previous build's blocks, mapped
+// read-only and indexed by hash, plus the blocks of this build to save
+typedef struct {
+    const char *dir;              // Cache directory, NULL when off
+    unsigned char *map;
+    size_t map_size;
+    const CACHEENTRY **index;     // Open addressing by hash, NULL = empty
+    unsigned int index_mask;
+    unsigned int entry_count;
+    SECTIONBUF out;               // Entries new in this build
+    PIECELIST pieces;             // All entries of this build, in source order
+    unsigned int out_count;
+
+    // Blocks and lines seen and reused by the last assembly
+    int blocks;
+    int hits;
+    int lines;
+    int hit_lines;
+} BLOCKCACHE;
+
+// A memoized instruction: its normalized text and what pass 1 made of it
+typedef struct {
+    unsigned int hash;
+    unsigned char key_len;        // 0 = empty slot
+    unsigned char type;           // OperandType
+    unsigned char size;
+    char key[MEMO_KEY_LEN];
+    const OPCODE *opcode;
+    unsigned char bytes[MAX_INSN_LEN];
+} MEMOENTRY;
+
+// Encoding memo of one pass-1 thread: instructions without symbols, by
+// normalized text. Entries are not replaced during an assembly, since IR
+// nodes point at their bytes; a full memo is emptied before the next one,
+// and so is one encoded with another -Os setting or opcode table.
+typedef struct {
+    MEMOENTRY *entries;           // memo_size slots, allocated on first use
+    int count;
+    int hits;
+    int misses;
+    int optimize_size;            // -Os setting the entries were encoded with
+    const OPCODE *table;          // opcode_table the entries point into
+    unsigned int opcodes;         // and its opcode_table_version()
+} ENCODEMEMO;
+
+// Phases timed by --stats
+typedef enum {
+    PHASE_READ,     // Map the source
+    PHASE_PARSE,    // Pass 1 lexing and parsing, per chunk
+    PHASE_LAYOUT,   // Merging chunks, symbols, cache save, branch relaxation
+    PHASE_ENCODE,   // Pass 2
+    PHASE_OUTPUT,   // Writing the object or binary
+    PHASE_COUNT
+} Phase;
+
+// Hot-path counters for --stats. Each thread counts into its own copy
+// (COUNT), which collect_counters() adds to its assembler's totals.
+// Building with -DASSEMBLER_NO_STATS compiles the counting out.
+typedef struct {
+    long parsed;             // Lines through Assembly_line() (not memo or cache hits)
+    long opcode_lookups;
+    long opcode_probes;
+    long symbol_lookups;     // Both finds and inserts
+    long symbol_probes;
+    long macro_expansions;   // Macro invocations expanded
+    long macro_cached;       // ... of which the expansion was reused
+    long expanded_lines;     // Lines parsed from expansions and %rep copies
+    long define_substitutions;
+    long preprocess_ns;      // Time collecting definitions and building expansions
+} COUNTERS;
+
+#ifndef ASSEMBLER_NO_STATS
+static _Thread_local COUNTERS thread_counters;
+#define COUNT(field, n) (thread_counters.field += (n))
+#else
+#define COUNT(field, n) ((void)sizeof(n))
+#endif
+
+// Errors reported by this thread, so a pass-1 chunk can tell whether a
+// block it parsed had any
+static _Thread_local long thread_errors;
+
+// Everything one assembly owns. Batch mode (several inputs) runs one
+// ASSEMBLER per worker thread; only the opcode table is shared, read-only.
+typedef struct ASSEMBLER {
+    // Options
+    OutputFormat output_format;
+    int thread_count;                 // Workers for pass 1 and pass 2 (-j)
+    int memo_size;                    // Encoding memo slots per thread, 0 = off
+    int optimize_size;                // -Os: mov reg, 0 as xor reg, reg
+    int stats;                        // --stats: time the phases
+    const char *input;                // Prefixes error messages in batch mode
+    int capture_diagnostics;          // Collect messages in diagnostics instead of printing them
+
+    // Counted from any worker thread
+    atomic_int error_count;
+
+    // Error messages of the last assembly, with capture_diagnostics
+    // (NUL-terminated, one per line); workers append under diag_lock
+    SECTIONBUF diagnostics;
+    pthread_mutex_t diag_lock;
+
+    // Source text: a file mapped read-only once per assembly (see
+    // read_source) or a caller's buffer (assemble_buffer)
+    const char *source;
+    size_t source_size;
+    int source_mapped;
+
+    // Intermediate representation built by pass 1
+    IRNODE *ir;
+    int ir_count;
+    int ir_capacity;
+
+    // Output: per-section bytes and sizes, and relocations against symbols
+    SECTIONBUF section_buf[SEC_COUNT];
+    unsigned int section_size[SEC_COUNT];
+    REFLIST refs;                     // Included blobs and times repeats, in address order
+    RELOCLIST relocations;
+    SECTIONBUF contents[SEC_COUNT];   // Sections with refs expanded, by section_contents()
+    IOVLIST iovs;                     // Pieces of the output file being written
+    size_t footprint_start;           // assembler_footprint() when the assembly started
+    WORKERBUFS workers[MAX_THREADS];  // Pass 1 and pass 2 scratch per worker
+
+    // NASM-style listing, only produced with -l
+    int listing_fd;
+    char *listing_buf;
+    size_t listing_used;
+
+    // Branch relaxation results
+    int short_branches;
+    int near_branches;
+    int relax_passes;
+
+    // Symbol table: entries in definition order, plus an open addressing
+    // index over them (entry index + 1, 0 = empty)
+    SYMBOL *symbol_table;
+    int symbol_count;
+    int symbol_capacity;
+    int *symbol_index;
+    unsigned int symbol_index_mask;
+    ARENA arena;                      // Symbol names and output scratch, reset per assembly
+
+    // Incremental cache (--cache)
+    BLOCKCACHE cache;
+
+    // %define and %macro definitions of the source
+    MACROTABLE macros;
+
+    // Encoding memo, one per pass-1 chunk, and its totals for the last assembly
+    ENCODEMEMO memo[MAX_THREADS];
+    int memo_hits;
+    int memo_misses;
+
+    // --stats results for the last assembly: seconds per phase and counters
+    double phase_wall[PHASE_COUNT];
+    double phase_cpu[PHASE_COUNT];
+    double phase_start_wall;
+    double phase_start_cpu;
+    COUNTERS counters;
+} ASSEMBLER;
+
+// A run of whole source lines parsed by one pass-1 worker
+typedef struct {
+    ASSEMBLER *as;
+    ENCODEMEMO *memo;
+    const char *start;
+    const char *end;
+    int first_line;                   // Line number of the first line
+    int line_count;
+    Section first_section;            // Section in effect at the first line
+    Section last_section;             // Last section directive, SEC_NONE if none
+
+    // Parse state; addresses are relative to the chunk's start in each section
+    Section section;
+    int line;
+    unsigned int address[SEC_COUNT];
+    unsigned int referenced[SEC_COUNT];   // Bytes of those addresses held by refs
+    REFLIST refs;
+    IRNODE *ir;
+    int ir_count;
+    int ir_capacity;
+    SYMEVENT *syms;
+    int sym_count;
+    int sym_capacity;
+    EXPANSIONS *expansions;
 
-// Add address counter
-unsigned int current_address = 0;
-int line_number = 1;
+    // Placement found by the prefix sum over the chunks before this one
+    int ir_offset;
+    unsigned int base[SEC_COUNT];
+    unsigned int referenced_base[SEC_COUNT];
 
-// Symbol table
-SYMBOL symbol_table[MAX_SYMBOLS];
-int symbol_count = 0;
+    // Cache entries for this chunk's blocks, and how many were reused
+    SECTIONBUF cache_out;
+    PIECELIST cache_pieces;
+    unsigned int cache_count;
+    int cache_blocks;
+    int cache_hits;
+    int cache_lines;
+    int cache_hit_lines;
+} CHUNK;
+
+// A range of IR nodes encoded by one pass-2 worker
+typedef struct {
+    ASSEMBLER *as;
+    int begin;
+    int end;
+    RELOCLIST relocs;
+} ENCODEJOB;
+
+// Built-in opcode table, generated from opcode.csv by tools/gen_opcode_table.c.
+// The generator itself builds with OPCODE_NO_BUILTIN since it produces the header.
+#ifndef OPCODE_NO_BUILTIN
+#include "opcode_table.h"
+#endif
+
+const char *const operand_type_name[] = { "NOOP", "R", "I", "RR", "RI", "MR", "RM", "M", "MI", "II", "??" };
+
+// Runtime opcode table, loaded from a CSV with --opcodes and indexed by
+// (mnemonic, type). When not loaded, the built-in table is used.
+OPCODE *opcode_table = NULL;
+int opcode_count = 0;
+int *opcode_index = NULL;           // Open addressing: entry index + 1, 0 = empty
+unsigned int opcode_index_mask = 0;
 
 // Function prototypes
-int reg_code(const char *reg);
-unsigned char mod_rm(int mod, const char *reg, const char *rm);
-int is_register(const char *s);
-int is_memory(const char *s);
-int is_immediate(const char *s);
-void check_operand(const char *op1, const char *op2, char *type);
-int search_opcode(char *mnemonic, const char *type, char *out);
-void Assembly_line(char *line);
-void assembly_file(const char *filename);
+int reg_code(STRVIEW reg);
+unsigned char mod_rm(int mod, int reg, int rm);
+STRVIEW view_of(const char *s);
+STRVIEW view_trim(STRVIEW v);
+STRVIEW next_field(STRVIEW *rest, const char *delims);
+int view_equal(STRVIEW v, const char *lower);
+int view_starts_with(STRVIEW v, const char *lower);
+int view_contains(STRVIEW v, const char *lower);
+int view_to_int(STRVIEW v);
+void next_token(LEXER *lx, TOKEN *tok);
+int parse_instruction(STRVIEW line, STRVIEW *mnemonic, OPERAND *op1, OPERAND *op2);
+OperandType operand_type(const OPERAND *op1, const OPERAND *op2);
+const OPCODE* find_opcode(const char *mnemonic, const char *type);
+const OPCODE* find_opcode_n(const char *mnemonic, int len, const char *type);
+const OPCODE* find_builtin_opcode(const char *mnemonic, int len, const char *type);
+static int cache_encodable(const IRNODE *node);
+unsigned int opcode_id(const OPCODE *op);
+const OPCODE* opcode_by_id(unsigned int id);
+unsigned int opcode_table_version();
+int branch_rel_size(const OPCODE *op);
+int is_relaxable_branch(const OPCODE *op);
+int is_plus_r_opcode(const OPCODE *op);
+unsigned int operand_value(ASSEMBLER *as, const OPERAND *op, int line, int final);
+int Assembly_line(ASSEMBLER *as, STRVIEW line, IRNODE *node);
+int encode_instruction(ASSEMBLER *as, const IRNODE *node, unsigned char *machine, RELOCLIST *relocs);
+IRNODE* new_ir_node(CHUNK *c, IRKind kind, STRVIEW text);
+void chunk_symbol(CHUNK *c, STRVIEW name, unsigned int address, SymType type, Section section, int size, int defined, int node);
+void run_parallel(void *(*fn)(void *), void *items, size_t item_size, int n);
+int read_source(ASSEMBLER *as, const char *filename);
+void free_source(ASSEMBLER *as);
+void scan_macros(ASSEMBLER *as);
+void pass1(ASSEMBLER *as);
+void relax_branches(ASSEMBLER *as);
+void pass2(ASSEMBLER *as);
+void cache_open(ASSEMBLER *as, const char *input);
+int cache_save(ASSEMBLER *as, const char *input);
+void cache_close(ASSEMBLER *as);
+void init_assembler(ASSEMBLER *as);
+void free_assembler(ASSEMBLER *as);
+void reset_assembler(ASSEMBLER *as);
+void assembly_file(ASSEMBLER *as, const char *filename);
+void report_error(ASSEMBLER *as, int line, const char *fmt, ...);
+void collect_counters(ASSEMBLER *as);
+void start_phase(ASSEMBLER *as);
+void end_phase(ASSEMBLER *as, Phase phase);
+void print_stats(ASSEMBLER *as, const char *input);
+int write_stats_json(ASSEMBLER *as, const char *input, const char *filename);
+char* output_name(const char *input, const char *ext);
+int write_output(ASSEMBLER *as, const char *input, const char *output);
+void print_cache_stats(int blocks, int hits, int lines, int hit_lines);
+int assemble_batch(const char *const *inputs, int count, OutputFormat format, const char *cache_dir, int threads,
+                   int optimize_size);
+int serve(const char *path, int workers);
+int connect_server(const char *path);
+int remote_assemble(int fd, const char *name, const char *source, size_t size, unsigned int flags,
+                    SECTIONBUF *output, SECTIONBUF *diagnostics);
+unsigned char* buffer_try_reserve(SECTIONBUF *buf, size_t len);
+unsigned char* buffer_reserve(SECTIONBUF *buf, size_t len, const char *what);
+unsigned char* section_reserve(ASSEMBLER *as, Section section, size_t len);
+static size_t align_up(size_t n, size_t align);
+void clear_sections(ASSEMBLER *as);
+unsigned int buffer_offset(ASSEMBLER *as, Section section, unsigned int address);
+void add_relocation(RELOCLIST *list, Section section, unsigned int offset, int type, int symbol);
+int relocation_addend(const SYMBOL *sym, int type);
+int write_elf32(ASSEMBLER *as, const char *filename);
+int write_bin(ASSEMBLER *as, const char *filename);
+int output_pieces(ASSEMBLER *as);
 void tolower_str(char *s);
-void print_instruction(const char *original, unsigned char *machine, int len);
-void reset_address_counter();
-void add_symbol(const char *name, unsigned int address, SymType type, const char *section, int size, int defined);
-SYMBOL* find_symbol(const char *name);
-void print_symbol_table();
-void process_data_line(char *line);
-void process_bss_line(char *line);
-
-void reset_address_counter() {
-    current_address = 0;
-    line_number = 1;
-}
-
-void add_symbol(const char *name, unsigned int address, SymType type, const char *section, int size, int defined) {
-    if (symbol_count >= MAX_SYMBOLS) {
-        fprintf(stderr, "Symbol table overflow!\n");
-        return;
+int open_listing(ASSEMBLER *as, const char *filename);
+void flush_listing(ASSEMBLER *as);
+void close_listing(ASSEMBLER *as);
+void listing_printf(ASSEMBLER *as, const char *fmt, ...);
+void list_row(ASSEMBLER *as, int line, long address, const unsigned char *machine, int len, const char *text, int text_len, int width);
+const char* section_name(Section section);
+void* arena_alloc(ARENA *arena, size_t size);
+void arena_reset(ARENA *arena);
+void arena_free(ARENA *arena);
+size_t assembler_footprint(const ASSEMBLER *as);
+const char* intern_string(ASSEMBLER *as, const char *s, int len);
+void clear_symbol_table(ASSEMBLER *as);
+void add_symbol(ASSEMBLER *as, const char *name, unsigned int address, SymType type, Section section, int size, int defined);
+void add_symbol_n(ASSEMBLER *as, const char *name, int len, unsigned int address, SymType type, Section section, int size, int defined);
+SYMBOL* find_symbol(ASSEMBLER *as, const char *name);
+SYMBOL* find_symbol_n(ASSEMBLER *as, const char *name, int len);
+void print_symbol_table(ASSEMBLER *as);
+void process_data_line(CHUNK *c, STRVIEW line, IRNODE *node);
+void process_bss_line(CHUNK *c, STRVIEW line);
+STRVIEW data_directive(STRVIEW line, STRVIEW *name, STRVIEW *times, STRVIEW *directive);
+int data_width(STRVIEW directive);
+size_t add_incbin(CHUNK *c, STRVIEW operands, int line);
+STRVIEW split_times(STRVIEW *line);
+unsigned int times_count(ASSEMBLER *as, STRVIEW field, int line);
+static const char* parse_data_number(const char *p, const char *end, unsigned long long *value, int *negative);
+unsigned int repeat_node(CHUNK *c, IRNODE *node, unsigned int count);
+size_t emit_data(ASSEMBLER *as, STRVIEW values, int width, unsigned char *dest, int line);
+
+const char* section_name(Section section) {
+    switch (section) {
+        case SEC_DATA: return ".data";
+        case SEC_TEXT: return ".text";
+        case SEC_BSS: return ".bss";
+        default: return "";
     }
-    
-    // Check if symbol already exists
-    for (int i = 0; i < symbol_count; i++) {
-        if (strcmp(symbol_table[i].name, name) == 0) {
-            // Update existing symbol if it's a definition
-            if (defined) {
-                symbol_table[i].address = address;
-                symbol_table[i].defined = 1;
-                symbol_table[i].type = type;
-                strcpy(symbol_table[i].section, section);
-                symbol_table[i].size = size;
+}
+
+// Bytes from the arena, 16-byte aligned. When the current block is full
+// the next kept block is used, or a new one is put after it if that is too
+// small (a request larger than ARENA_BLOCK_SIZE gets a block of its own).
+void* arena_alloc(ARENA *arena, size_t size) {
+    size = (size + 15) & ~(size_t)15;
+    ARENABLOCK *block = arena->current;
+    if (!block || block->used + size > block->capacity) {
+        ARENABLOCK *next = block ? block->next : arena->first;
+        if (!next || next->capacity < size) {
+            size_t capacity = size > ARENA_BLOCK_SIZE ? size : ARENA_BLOCK_SIZE;
+            ARENABLOCK *fresh = malloc(sizeof(ARENABLOCK) + capacity);
+            if (!fresh) {
+                fprintf(stderr, "Out of memory in the assembly arena!\n");
+                exit(1);
             }
-            return;
+            fresh->capacity = capacity;
+            fresh->next = next;
+            if (block) block->next = fresh;
+            else arena->first = fresh;
+            arena->allocated += sizeof(ARENABLOCK) + capacity;
+            next = fresh;
         }
+        next->used = 0;
+        arena->current = block = next;
     }
-    
-    // Add new symbol
-    strcpy(symbol_table[symbol_count].name, name);
-    symbol_table[symbol_count].address = address;
-    symbol_table[symbol_count].type = type;
-    symbol_table[symbol_count].defined = defined;
-    strcpy(symbol_table[symbol_count].section, section);
-    symbol_table[symbol_count].size = size;
-    symbol_count++;
+
+    void *p = block->data + block->used;
+    block->used += size;
+    arena->in_use += size;
+    if (arena->in_use > arena->high_water)
+        arena->high_water = arena->in_use;
+    return p;
+}
+
+// Take back everything handed out; the blocks stay for reuse
+void arena_reset(ARENA *arena) {
+    arena->current = NULL;
+    arena->in_use = 0;
+}
+
+void arena_free(ARENA *arena) {
+    while (arena->first) {
+        ARENABLOCK *next = arena->first->next;
+        free(arena->first);
+        arena->first = next;
+    }
+    memset(arena, 0, sizeof(*arena));
+}
+
+// Bytes an assembler holds on to between assemblies: IR, symbol table,
+// section buffers, relocations, per-worker scratch and the arena
+size_t assembler_footprint(const ASSEMBLER *as) {
+    size_t bytes = (size_t)as->ir_capacity * sizeof(IRNODE) + as->arena.allocated +
+                   (size_t)as->symbol_capacity * (sizeof(SYMBOL) + 2 * sizeof(int)) +
+                   (size_t)as->refs.capacity * sizeof(SECTIONREF) +
+                   (size_t)as->relocations.capacity * sizeof(RELOC) +
+                   (size_t)as->iovs.capacity * sizeof(struct iovec) + as->diagnostics.capacity;
+    for (int i = 0; i < SEC_COUNT; i++)
+        bytes += as->section_buf[i].capacity + as->contents[i].capacity;
+    const MACROTABLE *mt = &as->macros;
+    bytes += (size_t)mt->capacity * sizeof(MACRO) + (size_t)mt->piece_capacity * sizeof(MACROPIECE) +
+             (size_t)mt->line_capacity * sizeof(MACROLINE) + (size_t)mt->block_capacity * sizeof(MACROBLOCK) +
+             (mt->index ? (size_t)(mt->index_mask + 1) * sizeof(int) : 0);
+    for (int i = 0; i < MAX_THREADS; i++) {
+        const WORKERBUFS *w = &as->workers[i];
+        bytes += (size_t)w->ir_capacity * sizeof(IRNODE) + (size_t)w->sym_capacity * sizeof(SYMEVENT) +
+                 (size_t)w->refs.capacity * sizeof(SECTIONREF) + (size_t)w->relocs.capacity * sizeof(RELOC) +
+                 w->expansions.arena.allocated;
+        if (as->memo[i].entries)
+            bytes += (size_t)as->memo_size * sizeof(MEMOENTRY);
+    }
+    return bytes;
+}
+
+// Copy a symbol name into the arena, folded to lowercase since symbols are
+// case-insensitive. Interned strings stay valid until the next assembly
+// resets the arena, however much the symbol table grows.
+const char* intern_string(ASSEMBLER *as, const char *s, int len) {
+    char *copy = arena_alloc(&as->arena, len + 1);
+    for (int i = 0; i < len; i++)
+        copy[i] = (char)tolower((unsigned char)s[i]);
+    copy[len] = '\0';
+    return copy;
+}
+
+static unsigned int symbol_hash(const char *name, int len) {
+    // FNV-1a over the lowercased name
+    unsigned int h = 2166136261u;
+    for (int i = 0; i < len; i++) {
+        h ^= (unsigned char)tolower((unsigned char)name[i]);
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// Find the index slot holding name, or the empty slot where it belongs
+static unsigned int symbol_slot(ASSEMBLER *as, const char *name, int len, unsigned int hash) {
+    unsigned int slot = hash & as->symbol_index_mask;
+    COUNT(symbol_lookups, 1);
+    COUNT(symbol_probes, 1);
+    while (as->symbol_index[slot]) {
+        SYMBOL *sym = &as->symbol_table[as->symbol_index[slot] - 1];
+        if (sym->hash == hash && strncasecmp(sym->name, name, len) == 0 && sym->name[len] == '\0')
+            break;
+        slot = (slot + 1) & as->symbol_index_mask;
+        COUNT(symbol_probes, 1);
+    }
+    return slot;
 }
 
-SYMBOL* find_symbol(const char *name) {
-    for (int i = 0; i < symbol_count; i++) {
-        if (strcmp(symbol_table[i].name, name) == 0) {
-            return &symbol_table[i];
+// Double the entry array and the index, keeping the index at most half full
+static void grow_symbol_table(ASSEMBLER *as) {
+    int capacity = as->symbol_capacity ? as->symbol_capacity * 2 : 256;
+    SYMBOL *table = realloc(as->symbol_table, capacity * sizeof(SYMBOL));
+    int *index = calloc(capacity * 2, sizeof(int));
+    if (!table || !index) {
+        fprintf(stderr, "Out of memory growing symbol table!\n");
+        exit(1);
+    }
+    as->symbol_table = table;
+    as->symbol_capacity = capacity;
+
+    free(as->symbol_index);
+    as->symbol_index = index;
+    as->symbol_index_mask = capacity * 2 - 1;
+    for (int i = 0; i < as->symbol_count; i++) {
+        unsigned int slot = as->symbol_table[i].hash & as->symbol_index_mask;
+        while (as->symbol_index[slot]) slot = (slot + 1) & as->symbol_index_mask;
+        as->symbol_index[slot] = i + 1;
+    }
+}
+
+// Forget all symbols. Their names stay in the arena until it is reset.
+void clear_symbol_table(ASSEMBLER *as) {
+    if (as->symbol_index) memset(as->symbol_index, 0, (as->symbol_index_mask + 1) * sizeof(int));
+    as->symbol_count = 0;
+}
+
+void add_symbol(ASSEMBLER *as, const char *name, unsigned int address, SymType type, Section section, int size, int defined) {
+    add_symbol_n(as, name, strlen(name), address, type, section, size, defined);
+}
+
+// add_symbol() for a name that is not NUL-terminated, e.g. a source view
+void add_symbol_n(ASSEMBLER *as, const char *name, int len, unsigned int address, SymType type, Section section, int size, int defined) {
+    if (as->symbol_count == as->symbol_capacity) {
+        grow_symbol_table(as);
+    }
+
+    unsigned int hash = symbol_hash(name, len);
+    unsigned int slot = symbol_slot(as, name, len, hash);
+
+    // Check if symbol already exists
+    if (as->symbol_index[slot]) {
+        SYMBOL *sym = &as->symbol_table[as->symbol_index[slot] - 1];
+        if (type == SYM_GLOBAL)
+            sym->is_global = 1;
+        // Update existing symbol if it's a definition
+        if (defined) {
+            sym->address = address;
+            sym->defined = 1;
+            sym->type = type;
+            sym->section = section;
+            sym->size = size;
         }
+        return;
     }
-    return NULL;
+
+    // Add new symbol
+    SYMBOL *sym = &as->symbol_table[as->symbol_count];
+    sym->name = intern_string(as, name, len);
+    sym->hash = hash;
+    sym->address = address;
+    sym->type = type;
+    sym->defined = defined;
+    sym->section = section;
+    sym->size = size;
+    sym->is_global = type == SYM_GLOBAL;
+    as->symbol_index[slot] = ++as->symbol_count;
+}
+
+// Pointers returned here are invalidated when the table grows
+SYMBOL* find_symbol(ASSEMBLER *as, const char *name) {
+    return find_symbol_n(as, name, strlen(name));
+}
+
+SYMBOL* find_symbol_n(ASSEMBLER *as, const char *name, int len) {
+    if (!as->symbol_index) return NULL;
+
+    unsigned int slot = symbol_slot(as, name, len, symbol_hash(name, len));
+    return as->symbol_index[slot] ? &as->symbol_table[as->symbol_index[slot] - 1] : NULL;
 }
 
-void print_symbol_table() {
-    printf("\n\nSymbol Table:\n");
-    printf("Name                 Type     Value     Size  Section  Defined\n");
-    printf("-------------------- -------- --------- ----- -------- -------\n");
+void print_symbol_table(ASSEMBLER *as) {
+    listing_printf(as, "\n\nSymbol Table:\n");
+    listing_printf(as, "Name                 Type     Value     Size  Section  Defined\n");
+    listing_printf(as, "-------------------- -------- --------- ----- -------- -------\n");
     
-    for (int i = 0; i < symbol_count; i++) {
+    for (int i = 0; i < as->symbol_count; i++) {
         const char* type_str;
-        switch(symbol_table[i].type) {
+        switch(as->symbol_table[i].type) {
             case SYM_LABEL: type_str = "label"; break;
             case SYM_VARIABLE: type_str = "var"; break;
             case SYM_EXTERN: type_str = "extern"; break;
@@ -133,170 +964,240 @@ void print_symbol_table() {
             default: type_str = "unknown";
         }
         
-        printf("%-20s %-8s %08X %5d %-8s %s\n",
-               symbol_table[i].name,
+        listing_printf(as, "%-20s %-8s %08X %5d %-8s %s\n",
+               as->symbol_table[i].name,
                type_str,
-               symbol_table[i].address,
-               symbol_table[i].size,
-               symbol_table[i].section,
-               symbol_table[i].defined ? "yes" : "no");
+               as->symbol_table[i].address,
+               as->symbol_table[i].size,
+               section_name(as->symbol_table[i].section),
+               as->symbol_table[i].defined ? "yes" : "no");
     }
 }
 
-void process_data_line(char *line) {
+// Split "name: rest" into the label and what follows it. Returns 1 and
+// sets name if the line has a label; line is moved past the colon.
+static int split_label(STRVIEW *line, STRVIEW *name) {
+    const char *colon = memchr(line->ptr, ':', line->len);
+    if (!colon) return 0;
+
+    STRVIEW label = { line->ptr, (int)(colon - line->ptr) };
+    *name = view_trim(label);
+    line->len -= colon + 1 - line->ptr;
+    line->ptr = colon + 1;
+    return 1;
+}
+
+void process_data_line(CHUNK *c, STRVIEW line, IRNODE *node) {
     // Parse data definition lines like:
     // var1: dd 100
     // var2 db 1,2,3
     // msg: db 'Hello',0
-    
-    char name[100] = "";
-    char directive[10] = "";
-    char value[300] = "";
-    
-    // Check for label
-    char *colon = strchr(line, ':');
-    if (colon) {
-        int len = colon - line;
-        strncpy(name, line, len);
-        name[len] = '\0';
-        
-        // Remove leading/trailing spaces from name
-        while (name[0] == ' ' || name[0] == '\t') {
-            memmove(name, name + 1, strlen(name));
-        }
-        
-        char *end = name + strlen(name) - 1;
-        while (end > name && (*end == ' ' || *end == '\t')) {
-            *end = '\0';
-            end--;
+    // font: incbin "font.bin", 0, 4096
+    // The line is only sized here; pass 2 encodes the values.
+
+    STRVIEW name, times, directive;
+    STRVIEW values = data_directive(line, &name, &times, &directive);
+    int width = data_width(directive);
+    unsigned int count = times.ptr ? times_count(c->as, times, node->line) : 1;
+    size_t size = 0;
+    if (width) {
+        node->size = (unsigned int)emit_data(c->as, values, width, NULL, 0);
+        size = repeat_node(c, node, count);
+    } else if (directive.len) {
+        if (times.ptr) {
+            report_error(c->as, node->line, "times cannot repeat incbin");
         }
-        
-        // Add to symbol table
-        add_symbol(name, current_address, SYM_VARIABLE, ".data", 0, 1);
-        
-        // Move past colon
-        line = colon + 1;
-    }
-    
-    // Skip whitespace
-    while (*line == ' ' || *line == '\t') line++;
-    
-    // Parse directive
-    sscanf(line, "%s", directive);
-    char *rest = line + strlen(directive);
-    
-    // Calculate size based on directive
-    int size = 0;
-    DATATYPE dt;
-    
-    if (strcmp(directive, "db") == 0) {
-        size = 1;
-        dt = DB;
-    } else if (strcmp(directive, "dw") == 0) {
-        size = 2;
-        dt = DW;
-    } else if (strcmp(directive, "dd") == 0) {
-        size = 4;
-        dt = DD;
-    } else if (strcmp(directive, "dq") == 0) {
-        size = 8;
-        dt = DQ;
+        node->kind = IR_BLOB;
+        node->size = (unsigned int)add_incbin(c, values, node->line);
+        size = node->size;
     }
-    
-    // Parse the value(s)
-    while (*rest == ' ' || *rest == '\t') rest++;
-    
-    // For now, just print the line
-    printf("%4d                                      %s\n", line_number++, line);
-    
-    // Update current_address based on size
-    // Note: This is simplified - actual size depends on the number of values
-    current_address += size;
+
+    if (name.len > 0)
+        chunk_symbol(c, name, c->address[SEC_DATA], SYM_VARIABLE, SEC_DATA, (int)size, 1, (int)(node - c->ir));
+    c->address[SEC_DATA] += (unsigned int)size;
 }
 
-void process_bss_line(char *line) {
+void process_bss_line(CHUNK *c, STRVIEW line) {
     // Parse BSS (uninitialized data) lines like:
     // buffer: resb 100
     // array: resd 10
+    // table: times 4 resd 2
     
-    char name[100] = "";
-    char directive[10] = "";
-    int count = 0;
-    
-    // Check for label
-    char *colon = strchr(line, ':');
-    if (colon) {
-        int len = colon - line;
-        strncpy(name, line, len);
-        name[len] = '\0';
-        
-        // Remove leading/trailing spaces
-        while (name[0] == ' ' || name[0] == '\t') {
-            memmove(name, name + 1, strlen(name));
-        }
-        
-        char *end = name + strlen(name) - 1;
-        while (end > name && (*end == ' ' || *end == '\t')) {
-            *end = '\0';
-            end--;
-        }
-        
-        line = colon + 1;
-    }
-    
-    // Skip whitespace
-    while (*line == ' ' || *line == '\t') line++;
+    STRVIEW name = { NULL, 0 };
+    split_label(&line, &name);
+    line = view_trim(line);
+    STRVIEW times = split_times(&line);
     
     // Parse directive and count
-    sscanf(line, "%s %d", directive, &count);
+    STRVIEW directive = next_field(&line, " \t");
+    STRVIEW field = next_field(&line, " \t");
+    unsigned int repeat = times.ptr ? times_count(c->as, times, c->line - 1) : 1;
+    unsigned long long count;
+    int negative;
+    if (parse_data_number(field.ptr, field.ptr + field.len, &count, &negative) != field.ptr + field.len ||
+        field.len == 0 || negative || count > 0xFFFFFFFFull) {
+        report_error(c->as, c->line - 1, "reservation needs a count from 0 to 4294967295, not '%.*s'",
+                     field.len, field.ptr);
+        count = 0;
+    }
     
-    // Calculate size based on directive
-    int size = 0;
-    if (strcmp(directive, "resb") == 0) {
-        size = count * 1;  // bytes
-    } else if (strcmp(directive, "resw") == 0) {
-        size = count * 2;  // words
-    } else if (strcmp(directive, "resd") == 0) {
-        size = count * 4;  // dwords
-    } else if (strcmp(directive, "resq") == 0) {
-        size = count * 8;  // qwords
+    // Calculate size based on directive, in 64 bits so that large counts
+    // are caught rather than wrapped
+    unsigned long long unit = 0;
+    if (view_equal(directive, "resb")) {
+        unit = 1;  // bytes
+    } else if (view_equal(directive, "resw")) {
+        unit = 2;  // words
+    } else if (view_equal(directive, "resd")) {
+        unit = 4;  // dwords
+    } else if (view_equal(directive, "resq")) {
+        unit = 8;  // qwords
+    }
+    unsigned long long bytes = unit * count;     // Below 2^35: times is applied below
+    unsigned long long limit = 0xFFFFFFFFull - c->address[SEC_BSS];
+    unsigned long long total = bytes * repeat;
+    if (repeat > 1 && bytes > limit / repeat) {
+        report_error(c->as, c->line - 1, "reservation of %u x %llu bytes does not fit in a 32-bit section",
+                     repeat, bytes);
+        total = 0;
+    } else if (total > limit) {
+        report_error(c->as, c->line - 1, "reservation of %llu bytes does not fit in a 32-bit section", total);
+        total = 0;
     }
+    unsigned int size = (unsigned int)total;
     
     // Add to symbol table if we have a name
-    if (strlen(name) > 0) {
-        add_symbol(name, current_address, SYM_VARIABLE, ".bss", size, 1);
+    if (name.len > 0) {
+        chunk_symbol(c, name, c->address[SEC_BSS], SYM_VARIABLE, SEC_BSS, (int)size, 1, c->ir_count - 1);
     }
     
-    // Print the line
-    printf("%4d                                      %s\n", line_number++, line);
-    
     // Update address
-    current_address += size;
+    c->address[SEC_BSS] += size;
 }
 
-void print_instruction(const char *original, unsigned char *machine, int len) {
-    // Print line number and address
-    printf("%4d %08X ", line_number++, current_address);
-    
-    // Print machine code bytes
+// Open the listing file ("-" for stdout). Rows are formatted into a large
+// buffer and written in LISTING_BUFFER_SIZE chunks.
+int open_listing(ASSEMBLER *as, const char *filename) {
+    as->listing_fd = strcmp(filename, "-") == 0 ? 1 : open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (as->listing_fd < 0) {
+        perror("Cannot create listing file");
+        return 0;
+    }
+    as->listing_buf = malloc(LISTING_BUFFER_SIZE);
+    if (!as->listing_buf) {
+        fprintf(stderr, "Out of memory for listing buffer\n");
+        close_listing(as);
+        return 0;
+    }
+    as->listing_used = 0;
+    return 1;
+}
+
+void flush_listing(ASSEMBLER *as) {
+    size_t done = 0;
+    while (done < as->listing_used) {
+        ssize_t n = write(as->listing_fd, as->listing_buf + done, as->listing_used - done);
+        if (n <= 0) {
+            perror("Cannot write listing");
+            break;
+        }
+        done += n;
+    }
+    as->listing_used = 0;
+}
+
+void close_listing(ASSEMBLER *as) {
+    if (as->listing_fd < 0) return;
+    flush_listing(as);
+    if (as->listing_fd != 1) close(as->listing_fd);
+    free(as->listing_buf);
+    as->listing_buf = NULL;
+    as->listing_fd = -1;
+}
+
+// Make room for len bytes in the listing buffer
+static char* listing_space(ASSEMBLER *as, size_t len) {
+    if (as->listing_used + len > LISTING_BUFFER_SIZE) flush_listing(as);
+    if (len > LISTING_BUFFER_SIZE) return NULL;
+    return as->listing_buf + as->listing_used;
+}
+
+static void listing_write(ASSEMBLER *as, const char *s, size_t len) {
+    char *dest = listing_space(as, len);
+    if (dest) {
+        memcpy(dest, s, len);
+        as->listing_used += len;
+    } else {
+        // Longer than the whole buffer: write it through
+        flush_listing(as);
+        if (write(as->listing_fd, s, len) < 0) perror("Cannot write listing");
+    }
+}
+
+// printf into the listing; only used for headers and the symbol table
+void listing_printf(ASSEMBLER *as, const char *fmt, ...) {
+    char row[512];
+    va_list ap;
+    va_start(ap, fmt);
+    int n = vsnprintf(row, sizeof(row), fmt, ap);
+    va_end(ap);
+    if (n > 0) listing_write(as, row, n < (int)sizeof(row) ? (size_t)n : sizeof(row) - 1);
+}
+
+static const char hex_digits[] = "0123456789ABCDEF";
+
+// One listing row: "%4d %08X <bytes padded to width> text\n". address < 0
+// leaves the address column blank; a NULL text is a blank line.
+void list_row(ASSEMBLER *as, int line, long address, const unsigned char *machine, int len, const char *text, int text_len, int width) {
+    char *p = listing_space(as, 16 + width + 2 * len + text_len);
+    if (!p) {
+        // Enormous line: let the general path handle it
+        listing_printf(as, "%4d ", line);
+        listing_write(as, text, text_len);
+        listing_write(as, "\n", 1);
+        return;
+    }
+    char *start = p;
+
+    // Line number, right-aligned to 4 columns like %4d
+    char digits[12];
+    int n = 0;
+    unsigned int v = line;
+    do { digits[n++] = (char)('0' + v % 10); v /= 10; } while (v);
+    for (int i = n; i < 4; i++) *p++ = ' ';
+    while (n) *p++ = digits[--n];
+
+    if (!text) {
+        *p++ = '\n';
+        as->listing_used += p - start;
+        return;
+    }
+
+    *p++ = ' ';
+    if (address >= 0) {
+        for (int shift = 28; shift >= 0; shift -= 4)
+            *p++ = hex_digits[(address >> shift) & 0xF];
+    } else {
+        memset(p, ' ', 8);
+        p += 8;
+    }
+    *p++ = ' ';
+
     for (int i = 0; i < len; i++) {
-        printf("%02X", machine[i]);
+        *p++ = hex_digits[machine[i] >> 4];
+        *p++ = hex_digits[machine[i] & 0xF];
     }
-    
-    // Add spaces for alignment (similar to NASM output)
-    int bytes_printed = len * 2;
-    int spaces_needed = 24 - bytes_printed;
+
+    // Pad the machine code column (similar to NASM output)
+    int spaces_needed = width - len * 2;
     if (spaces_needed < 1) spaces_needed = 1;
-    
-    for (int i = 0; i < spaces_needed; i++) {
-        printf(" ");
-    }
-    
-    // Print the original assembly instruction
-    printf("%s\n", original);
-    
-    // Update address counter
-    current_address += len;
+    memset(p, ' ', spaces_needed);
+    p += spaces_needed;
+
+    memcpy(p, text, text_len);
+    p += text_len;
+    *p++ = '\n';
+    as->listing_used += p - start;
 }
 
 void tolower_str(char *s) {
@@ -304,664 +1205,5044 @@ void tolower_str(char *s) {
         *s = tolower((unsigned char)*s);
 }
 
-int reg_code(const char *reg)
-{
-    if (!reg) return -1;
-    if (strcmp(reg, "eax") == 0) return 0;
-    if (strcmp(reg, "ecx") == 0) return 1;
-    if (strcmp(reg, "edx") == 0) return 2;
-    if (strcmp(reg, "ebx") == 0) return 3;
-    if (strcmp(reg, "esp") == 0) return 4;
-    if (strcmp(reg, "ebp") == 0) return 5;
-    if (strcmp(reg, "esi") == 0) return 6;
-    if (strcmp(reg, "edi") == 0) return 7;
-    return -1;  // not a register
+STRVIEW view_of(const char *s) {
+    STRVIEW v = { s, s ? (int)strlen(s) : 0 };
+    return v;
 }
 
-unsigned char mod_rm(int mod, const char *reg, const char *rm)
-{
-    int regcode = reg_code(reg);
-    int rmcode  = reg_code(rm);
+// Drop leading and trailing blanks
+STRVIEW view_trim(STRVIEW v) {
+    while (v.len > 0 && (v.ptr[0] == ' ' || v.ptr[0] == '\t')) {
+        v.ptr++;
+        v.len--;
+    }
+    while (v.len > 0 && (v.ptr[v.len - 1] == ' ' || v.ptr[v.len - 1] == '\t'))
+        v.len--;
+    return v;
+}
 
-    if (regcode < 0 || rmcode < 0) {
-        printf("invalid register in mod_rm\n");
-        return 0;
+// strtok() over a view: skip delimiters, return the next field and move
+// rest past it. An empty view means no more fields.
+STRVIEW next_field(STRVIEW *rest, const char *delims) {
+    while (rest->len > 0 && strchr(delims, rest->ptr[0])) {
+        rest->ptr++;
+        rest->len--;
     }
+    STRVIEW field = { rest->ptr, 0 };
+    while (field.len < rest->len && !strchr(delims, rest->ptr[field.len]))
+        field.len++;
+    rest->ptr += field.len;
+    rest->len -= field.len;
+    return field;
+}
+
+// Case-insensitive comparisons against lowercase literals, done in place
+// on the source text
+int view_equal(STRVIEW v, const char *lower) {
+    int n = strlen(lower);
+    return v.len == n && strncasecmp(v.ptr, lower, n) == 0;
+}
 
-    return (unsigned char)((mod << 6) | (regcode << 3) | rmcode);
+int view_starts_with(STRVIEW v, const char *lower) {
+    int n = strlen(lower);
+    return v.len >= n && strncasecmp(v.ptr, lower, n) == 0;
 }
 
-int is_register(const char *s) {
-    if (!s) return 0;
-    if (s[0] == 'e' && (
-                strstr(s, "ax") || strstr(s, "bx") || strstr(s, "cx") || strstr(s, "dx") ||
-                strstr(s, "si") || strstr(s, "di") || strstr(s, "sp") || strstr(s, "bp")
-             )) return 1;
+int view_contains(STRVIEW v, const char *lower) {
+    int n = strlen(lower);
+    for (int i = 0; i + n <= v.len; i++) {
+        if (strncasecmp(v.ptr + i, lower, n) == 0) return 1;
+    }
     return 0;
 }
 
-int is_memory(const char *s) {
-    if (!s) return 0;
-    return (s[0] == '[');   // ex: [ebx+ecx*4+8]
+// atoi() for a view: optional sign then decimal digits
+int view_to_int(STRVIEW v) {
+    int i = 0, negative = 0;
+    long value = 0;
+
+    if (i < v.len && (v.ptr[i] == '-' || v.ptr[i] == '+'))
+        negative = v.ptr[i++] == '-';
+    for (; i < v.len && isdigit((unsigned char)v.ptr[i]); i++)
+        value = value * 10 + (v.ptr[i] - '0');
+    return (int)(negative ? -value : value);
 }
 
-int is_immediate(const char *s) {
-    if (!s) return 0;
-    if (isdigit((unsigned char)s[0])) return 1;
-    if (s[0] == '-' && isdigit((unsigned char)s[1])) return 1;
-    return 0;
+// Register id (eax=0 ... edi=7) of a 32-bit register name in any case,
+// or -1 if the view is not a register
+int reg_code(STRVIEW reg)
+{
+    if (reg.len != 3 || (reg.ptr[0] | 0x20) != 'e') return -1;
+
+    // Both letters folded to lowercase, one switch
+    switch (((reg.ptr[1] | 0x20) << 8) | (reg.ptr[2] | 0x20)) {
+        case 'a' << 8 | 'x': return 0;
+        case 'c' << 8 | 'x': return 1;
+        case 'd' << 8 | 'x': return 2;
+        case 'b' << 8 | 'x': return 3;
+        case 's' << 8 | 'p': return 4;
+        case 'b' << 8 | 'p': return 5;
+        case 's' << 8 | 'i': return 6;
+        case 'd' << 8 | 'i': return 7;
+        default: return -1;
+    }
 }
 
-void check_operand(const char *op1, const char *op2, char *type)
+unsigned char mod_rm(int mod, int reg, int rm)
 {
-    if (is_register(op1) && is_register(op2))
-        strcpy(type, "RR");
-    else if (is_register(op1) && is_immediate(op2))
-        strcpy(type, "RI");
-    else if (is_memory(op1) && is_register(op2))
-        strcpy(type, "MR");
-    else if (is_register(op1) && is_memory(op2))
-        strcpy(type, "RM");
-    else
-        strcpy(type, "??");
+    return (unsigned char)((mod << 6) | (reg << 3) | rm);
 }
 
-int search_opcode(char *mnemonic, const char *type, char *out)
+// Character classes driving the lexer's state machine
+enum {
+    CC_OTHER,
+    CC_SPACE,
+    CC_IDENT,       // Letters, '_', '.', '$', '@', '?'
+    CC_DIGIT,
+    CC_QUOTE,
+    CC_PUNCT,       // One-character tokens
+    CC_COMMENT
+};
+
+static const unsigned char char_class[256] = {
+    [' '] = CC_SPACE, ['\t'] = CC_SPACE, ['\r'] = CC_SPACE, ['\v'] = CC_SPACE, ['\f'] = CC_SPACE,
+    ['a' ... 'z'] = CC_IDENT, ['A' ... 'Z'] = CC_IDENT,
+    ['_'] = CC_IDENT, ['.'] = CC_IDENT, ['$'] = CC_IDENT, ['@'] = CC_IDENT, ['?'] = CC_IDENT,
+    ['0' ... '9'] = CC_DIGIT,
+    ['\''] = CC_QUOTE, ['"'] = CC_QUOTE, ['`'] = CC_QUOTE,
+    [','] = CC_PUNCT, [':'] = CC_PUNCT, ['['] = CC_PUNCT, [']'] = CC_PUNCT,
+    ['+'] = CC_PUNCT, ['-'] = CC_PUNCT, ['*'] = CC_PUNCT,
+    [';'] = CC_COMMENT
+};
+
+static int hex_value(char c)
 {
-    FILE *fp = fopen("opcode.csv", "r");
-    if (!fp) return 0;
+    if (c >= '0' && c <= '9') return c - '0';
+    c = (char)tolower((unsigned char)c);
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    return -1;
+}
 
-    char row[128], col1[32], col2[8], col3[32];
-    for (int i = 0; mnemonic[i]; i++) 
-        mnemonic[i] = toupper((unsigned char)mnemonic[i]);
+// Value of a numeric literal: decimal, 0x1F, 1Fh. Returns 0 if malformed,
+// -1 if it does not fit in 32 bits.
+static int parse_number(STRVIEW v, long *value)
+{
+    int base = 10;
+    int i = 0, end = v.len;
 
-    if (fgets(row, sizeof(row), fp) == NULL) { // skip header
-        fclose(fp);
-        return 0;
+    if (v.len > 2 && v.ptr[0] == '0' && tolower((unsigned char)v.ptr[1]) == 'x') {
+        base = 16;
+        i = 2;
+    } else if (v.len > 1 && tolower((unsigned char)v.ptr[v.len - 1]) == 'h') {
+        base = 16;
+        end--;
     }
 
-    while (fgets(row, sizeof(row), fp)) {
-        if (sscanf(row, "%31[^,],%7[^,],%31[^\n]", col1, col2, col3) != 3)
-            continue;
-            
-        // Convert column 1 to uppercase
-        for (int i = 0; col1[i]; i++) 
-            col1[i] = toupper((unsigned char)col1[i]);
-
-        if (strcmp(col1, mnemonic) == 0 && strcmp(col2, type) == 0) {
-            strcpy(out, col3);
-            fclose(fp);
-            return 1;
+    unsigned long long n = 0;
+    int big = 0;
+    for (; i < end; i++) {
+        int d = hex_value(v.ptr[i]);
+        if (d < 0 || d >= base) return 0;
+        n = n * base + d;
+        if (n > 0xFFFFFFFFull) {
+            big = 1;
+            n = 0;      // Keep checking the digits without wrapping
         }
     }
-
-    fclose(fp);
-    return 0;
+    *value = (long)n;
+    return big ? -1 : 1;
 }
 
-void Assembly_line(char *line)
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+// Value of the eight ASCII digits at p, or -1 if any of them is not a
+// digit. SWAR: the digit check and the multiply-combine of pairs, fours
+// and eights each take one 64-bit operation instead of eight steps.
+static inline long long eight_digits(const char *p)
 {
-    char mnemonic[32], op1[32], op2[32];
-    char original[MAXLINE];
-    strcpy(original, line);  // KEEP the original before tokenizing
-
-    // Tokenize the line into mnemonic, op1, op2
-    mnemonic[0] = op1[0] = op2[0] = '\0';
+    unsigned long long v;
+    memcpy(&v, p, 8);
+    if (((v & 0xF0F0F0F0F0F0F0F0ull) |
+         (((v + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4)) != 0x3333333333333333ull)
+        return -1;
+    v = ((v & 0x0F0F0F0F0F0F0F0Full) * 2561) >> 8;
+    v = ((v & 0x00FF00FF00FF00FFull) * 6553601) >> 16;
+    return (long long)(((v & 0x0000FFFF0000FFFFull) * 42949672960001ull) >> 32);
+}
+#endif
 
-    char line_copy[MAXLINE];
-    strcpy(line_copy, line);
-    
-    char *tok = strtok(line_copy, " ,");
-    if (!tok) return;
+// Numeric literal at p for a data directive: optional sign, then decimal,
+// 0x1F or 1Fh, up to 64 bits. Returns the end of the literal, or NULL if
+// p holds no number (or one that overflows).
+static const char* parse_data_number(const char *p, const char *end, unsigned long long *value, int *negative)
+{
+    *negative = 0;
+    if (p < end && (*p == '-' || *p == '+'))
+        *negative = *p++ == '-';
 
-    strcpy(mnemonic, tok);
+    const char *start = p;
+    while (p < end && (char_class[(unsigned char)*p] == CC_DIGIT || char_class[(unsigned char)*p] == CC_IDENT))
+        p++;
+    if (p == start || char_class[(unsigned char)*start] != CC_DIGIT)
+        return NULL;
 
-    tok = strtok(NULL, " ,");
-    if (tok) {
-        strcpy(op1, tok);
-        tok = strtok(NULL, " ,");
-        if (tok) strcpy(op2, tok);
+    unsigned long long n = 0;
+    const char *q = start, *digits_end = p;
+    int base = 10;
+    if ((p[-1] | 0x20) == 'h') {
+        base = 16;
+        digits_end--;
+    } else if (p - start > 2 && start[0] == '0' && (start[1] | 0x20) == 'x') {
+        base = 16;
+        q += 2;
     }
 
-    // Determine operand type (RR, RI, MR, RM)
-    char type[8];
-    check_operand(op1, op2, type);
-
-    // Find opcode from CSV
-    char opcode_str[32];
-    int len = 0;
-    unsigned char machine[16];  // Increased size for complex addressing modes
-
-    if (search_opcode(mnemonic, type, opcode_str)) {
-        // Convert hex string to byte
-        machine[len++] = (unsigned char)strtol(opcode_str, NULL, 16);
-        
-        if (strcmp(type, "RR") == 0) {
-            // Both operands are registers
-            machine[len++] = mod_rm(3, op1, op2);
-        }
-        else if (strcmp(type, "RI") == 0) {
-            // Register to immediate
-            int num = machine[0];
-            num += reg_code(op1);
-            machine[0] = (unsigned char)num;
-            int imm = atoi(op2);
-            
-            // Handle different sizes of immediates
-            if (imm >= -128 && imm <= 127) {
-                machine[len++] = (unsigned char)(imm & 0xFF);
-            } else if (imm >= -32768 && imm <= 32767) {
-                machine[len++] = (unsigned char)(imm & 0xFF);
-                machine[len++] = (unsigned char)((imm >> 8) & 0xFF);
-            } else {
-                machine[len++] = (unsigned char)(imm & 0xFF);
-                machine[len++] = (unsigned char)((imm >> 8) & 0xFF);
-                machine[len++] = (unsigned char)((imm >> 16) & 0xFF);
-                machine[len++] = (unsigned char)((imm >> 24) & 0xFF);
-            }
-        }
-        else if (strcmp(type, "RM") == 0) {
-            // Register to Memory: reg , [mem]
-            const char *reg = op1;      // destination register
-            char mem[256];
-            strcpy(mem, op2);           // source memory operand
-
-            // Remove the brackets from memory operand
-            if (mem[0] == '[') {
-                memmove(mem, mem + 1, strlen(mem));
-                if (mem[strlen(mem)-1] == ']')
-                    mem[strlen(mem)-1] = '\0';
-            }
-
-            // Check if it's just a displacement (e.g., "[1234]")
-            char *plus = strchr(mem, '+');
-            char *star = strchr(mem, '*');
-
-            if (!plus && !star) {
-                // Case 1: [reg] or Case 5: [disp]
-                if (is_register(mem)) {
-                    // Case 1: [reg] - register indirect
-                    if (strcmp(mem, "ebp") == 0 || strcmp(mem, "esp") == 0) {
-                        // esp and ebp in SIB require special handling
-                        machine[len++] = mod_rm(0, reg, "ebp");  // mod=00, rm=101 means [disp32]
-                        machine[len++] = 0x00;  // SIB byte: scale=00, index=100(esp), base=101(ebp)
-                        machine[len++] = 0x00;  // 32-bit displacement (0)
-                        machine[len++] = 0x00;
-                        machine[len++] = 0x00;
-                        machine[len++] = 0x00;
-                    } else {
-                        machine[len++] = mod_rm(0, reg, mem);
-                    }
-                } else {
-                    // Case 5: [disp] - direct memory address
-                    machine[len++] = mod_rm(0, reg, "ebp");  // mod=00, rm=101 means [disp32]
-                    int disp = atoi(mem);
-                    machine[len++] = (unsigned char)(disp & 0xFF);
-                    machine[len++] = (unsigned char)((disp >> 8) & 0xFF);
-                    machine[len++] = (unsigned char)((disp >> 16) & 0xFF);
-                    machine[len++] = (unsigned char)((disp >> 24) & 0xFF);
-                }
-            } else if (plus && !star) {
-                // Case 2: [reg+disp]
-                char *base_reg = mem;
-                char *disp_str = plus + 1;
-                *plus = '\0';  // split at '+'
-
-                int disp = atoi(disp_str);
-                int mod;
-
-                if (disp == 0 && strcmp(base_reg, "ebp") != 0) {
-                    mod = 0;  // [reg]
-                } else if (disp >= -128 && disp <= 127) {
-                    mod = 1;  // 8-bit displacement
-                } else {
-                    mod = 2;  // 32-bit displacement
-                }
+    if (base == 16) {
+        if (digits_end - q > 16) return NULL;
+        for (; q < digits_end; q++) {
+            int d = hex_value(*q);
+            if (d < 0) return NULL;
+            n = n << 4 | d;
+        }
+    } else {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+        for (; digits_end - q >= 8; q += 8) {
+            long long eight = eight_digits(q);
+            if (eight < 0 || __builtin_mul_overflow(n, 100000000ull, &n) ||
+                __builtin_add_overflow(n, (unsigned long long)eight, &n))
+                return NULL;
+        }
+#endif
+        for (; q < digits_end; q++) {
+            unsigned int d = (unsigned int)(*q - '0');
+            if (d > 9 || __builtin_mul_overflow(n, 10ull, &n) || __builtin_add_overflow(n, d, &n))
+                return NULL;
+        }
+    }
+    *value = n;
+    return p;
+}
 
-                if (strcmp(base_reg, "esp") == 0) {
-                    // esp requires SIB byte
-                    machine[len++] = mod_rm(mod, reg, "esp");
-                    machine[len++] = 0x24;  // SIB: scale=00, index=100(esp), base=100(esp)
-
-                    if (mod == 1) {
-                        machine[len++] = (unsigned char)(disp & 0xFF);
-                    } else if (mod == 2) {
-                        machine[len++] = (unsigned char)(disp & 0xFF);
-                        machine[len++] = (unsigned char)((disp >> 8) & 0xFF);
-                        machine[len++] = (unsigned char)((disp >> 16) & 0xFF);
-                        machine[len++] = (unsigned char)((disp >> 24) & 0xFF);
-                    }
-                } else {
-                    machine[len++] = mod_rm(mod, reg, base_reg);
-
-                    if (mod == 1) {
-                        machine[len++] = (unsigned char)(disp & 0xFF);
-                    } else if (mod == 2) {
-                        machine[len++] = (unsigned char)(disp & 0xFF);
-                        machine[len++] = (unsigned char)((disp >> 8) & 0xFF);
-                        machine[len++] = (unsigned char)((disp >> 16) & 0xFF);
-                        machine[len++] = (unsigned char)((disp >> 24) & 0xFF);
-                    }
-                }
-            } else if (star) {
-                // Case 3 & 4: [index+base*scale] or [index+base*scale+disp]
-                // Format: [base+index*scale+disp] or [base+index*scale]
-
-                char *base_reg = mem;
-                char *index_part = strstr(mem, "+");
-                char *scale_part = strstr(mem, "*");
-                char *disp_part = NULL;
-
-                // Find displacement if exists
-                char *last_plus = strrchr(mem, '+');
-                if (last_plus && last_plus > scale_part) {
-                    disp_part = last_plus + 1;
-                    *last_plus = '\0';
-                }
+// Element size of a data directive: db, dw, dd, dq. 0 for anything else.
+int data_width(STRVIEW directive)
+{
+    if (directive.len != 2 || (directive.ptr[0] | 0x20) != 'd') return 0;
+    switch (directive.ptr[1] | 0x20) {
+        case 'b': return 1;
+        case 'w': return 2;
+        case 'd': return 4;
+        case 'q': return 8;
+    }
+    return 0;
+}
 
-                // Parse index*scale
-                if (index_part) {
-                    *index_part = '\0';
-                    index_part++;
-                }
+static int is_data_directive(STRVIEW directive)
+{
+    return data_width(directive) || view_equal(directive, "incbin");
+}
 
-                char *index_reg = index_part;
-                int scale = 1;
+// Split a .data line ("name: dd 1, 2", "name dd 1, 2", "dd 1, 2", any of
+// them with "times N" before the directive) into its label, times count
+// field (see split_times), directive (db/dw/dd/dq/incbin, empty if none)
+// and operands. A name without a colon only counts before a directive.
+STRVIEW data_directive(STRVIEW line, STRVIEW *name, STRVIEW *times, STRVIEW *directive)
+{
+    STRVIEW rest = line;
+    STRVIEW first = next_field(&rest, " \t:");
+    name->ptr = NULL;
+    name->len = 0;
+    if (is_data_directive(first)) {
+        times->ptr = NULL;
+        times->len = 0;
+        *directive = first;
+        return view_trim(rest);
+    }
 
-                if (scale_part) {
-                    *scale_part = '\0';
-                    scale = atoi(scale_part + 1);
-                }
+    int colon = 0;
+    if (view_equal(first, "times")) {
+        rest = line;
+    } else {
+        rest = view_trim(rest);
+        colon = rest.len > 0 && rest.ptr[0] == ':';
+        if (colon) {
+            rest.ptr++;
+            rest.len--;
+        }
+    }
+    *times = split_times(&rest);
+    *directive = next_field(&rest, " \t");
+    if (!is_data_directive(*directive))
+        directive->len = 0;
+    if (colon || (directive->len && !view_equal(first, "times")))
+        *name = first;
+    return view_trim(rest);
+}
 
-                // Calculate scale encoding: 1=00, 2=01, 4=10, 8=11
-                int scale_enc;
-                switch (scale) {
-                    case 1: scale_enc = 0; break;
-                    case 2: scale_enc = 1; break;
-                    case 4: scale_enc = 2; break;
-                    case 8: scale_enc = 3; break;
-                    default: scale_enc = 0; break;
-                }
+static SECTIONREF* new_ref(REFLIST *list)
+{
+    if (list->count == list->capacity) {
+        int capacity = list->capacity ? list->capacity * 2 : 16;
+        SECTIONREF *grown = realloc(list->items, capacity * sizeof(SECTIONREF));
+        if (!grown) {
+            fprintf(stderr, "Out of memory recording incbin or times!\n");
+            exit(1);
+        }
+        list->items = grown;
+        list->capacity = capacity;
+    }
+    SECTIONREF *ref = &list->items[list->count++];
+    memset(ref, 0, sizeof(*ref));
+    return ref;
+}
 
-                // Calculate SIB byte: scale(2 bits) | index(3 bits) | base(3 bits)
-                unsigned char sib = (unsigned char)((scale_enc << 6) | (reg_code(index_reg) << 3) | reg_code(base_reg));
-
-                int mod;
-                int disp = 0;
-
-                if (disp_part) {
-                    disp = atoi(disp_part);
-                    if (disp == 0 && strcmp(base_reg, "ebp") != 0) {
-                        mod = 0;
-                    } else if (disp >= -128 && disp <= 127) {
-                        mod = 1;
-                    } else {
-                        mod = 2;
-                    }
-                } else {
-                    mod = 0;
-                }
+// Parse incbin "file"[, offset[, length]] and record the bytes as a
+// reference: the file is only checked here, and read when the output is
+// written. Returns the number of bytes included, 0 after an error.
+size_t add_incbin(CHUNK *c, STRVIEW operands, int line)
+{
+    ASSEMBLER *as = c->as;
+    const char *p = operands.ptr, *end = operands.ptr + operands.len;
+    const char *close = p < end && char_class[(unsigned char)*p] == CC_QUOTE ? memchr(p + 1, *p, end - p - 1) : NULL;
+    if (!close || close == p + 1) {
+        report_error(as, line, "incbin needs a quoted file name");
+        return 0;
+    }
+    STRVIEW path = { p + 1, (int)(close - p - 1) };
 
-                machine[len++] = mod_rm(mod, reg, "esp");  // esp indicates SIB follows
-                machine[len++] = sib;
+    // Optional offset and length
+    unsigned long long args[2] = { 0, 0 };
+    int nargs = 0, ok = 1;
+    p = close + 1;
+    for (;;) {
+        while (p < end && char_class[(unsigned char)*p] == CC_SPACE) p++;
+        if (p == end || *p == ';') break;
+        if (*p != ',' || nargs == 2) {
+            ok = 0;
+            break;
+        }
+        for (p++; p < end && char_class[(unsigned char)*p] == CC_SPACE; p++) ;
+        int negative;
+        p = parse_data_number(p, end, &args[nargs++], &negative);
+        if (!p || negative) {
+            ok = 0;
+            break;
+        }
+    }
+    if (!ok) {
+        report_error(as, line, "bad incbin operands '%.*s'", operands.len, operands.ptr);
+        return 0;
+    }
 
-                if (mod == 1) {
-                    machine[len++] = (unsigned char)(disp & 0xFF);
-                } else if (mod == 2) {
-                    machine[len++] = (unsigned char)(disp & 0xFF);
-                    machine[len++] = (unsigned char)((disp >> 8) & 0xFF);
-                    machine[len++] = (unsigned char)((disp >> 16) & 0xFF);
-                    machine[len++] = (unsigned char)((disp >> 24) & 0xFF);
-                }
+    char name[4096];
+    struct stat st;
+    if (path.len >= (int)sizeof(name)) {
+        report_error(as, line, "incbin file name too long");
+        return 0;
+    }
+    memcpy(name, path.ptr, path.len);
+    name[path.len] = '\0';
+    if (stat(name, &st) != 0) {
+        report_error(as, line, "cannot include '%s': %s", name, strerror(errno));
+        return 0;
+    }
+
+    unsigned long long file_size = (unsigned long long)st.st_size;
+    unsigned long long offset = args[0];
+    unsigned long long size = nargs == 2 ? args[1] : (offset <= file_size ? file_size - offset : 0);
+    if (offset > file_size || size > file_size - offset) {
+        report_error(as, line, "incbin range is past the end of '%s' (%llu bytes)", name, file_size);
+        return 0;
+    }
+    if (size > 0xFFFFFFFFull - c->address[SEC_DATA]) {
+        report_error(as, line, "incbin of '%s' does not fit in a 32-bit section", name);
+        return 0;
+    }
+    if (size == 0)
+        return 0;
+
+    SECTIONREF *ref = new_ref(&c->refs);
+    ref->address = c->address[SEC_DATA];
+    ref->size = (unsigned int)size;
+    ref->section = SEC_DATA;
+    ref->kind = REF_BLOB;
+    ref->path = path;
+    ref->offset = (off_t)offset;
+    c->referenced[SEC_DATA] += (unsigned int)size;
+    return (size_t)size;
+}
+
+// Split a "times N" prefix off line, moving line past it. Returns the
+// count field, or a view with a NULL ptr if there is no prefix.
+STRVIEW split_times(STRVIEW *line)
+{
+    STRVIEW rest = *line;
+    if (!view_equal(next_field(&rest, " \t"), "times"))
+        return (STRVIEW){ NULL, 0 };
+    STRVIEW count = next_field(&rest, " \t");
+    *line = view_trim(rest);
+    return count;
+}
+
+// Value of a times count field; a count that is not a constant is
+// reported and taken as 1
+unsigned int times_count(ASSEMBLER *as, STRVIEW field, int line)
+{
+    unsigned long long value;
+    int negative;
+    if (parse_data_number(field.ptr, field.ptr + field.len, &value, &negative) != field.ptr + field.len ||
+        field.len == 0 || negative || value > 0xFFFFFFFFull) {
+        report_error(as, line, "times needs a constant count, not '%.*s'", field.len, field.ptr);
+        return 1;
+    }
+    return (unsigned int)value;
+}
+
+// Repeat a node count times (times prefix). The node keeps the size of
+// one copy, which pass 2 stores as usual; the other copies become one
+// REF_REPEAT right after it and are only expanded in the output. Returns
+// the bytes the line takes in its section.
+unsigned int repeat_node(CHUNK *c, IRNODE *node, unsigned int count)
+{
+    if (count == 0) {
+        node->kind = IR_TEXT;   // Nothing to store
+        node->size = 0;
+        return 0;
+    }
+    if (count == 1 || node->size == 0)
+        return node->size;
+
+    unsigned long long total = (unsigned long long)node->size * count;
+    if (total > 0xFFFFFFFFull - c->address[node->section]) {
+        ASSEMBLER *as = c->as;
+        report_error(as, node->line, "times %u does not fit in a 32-bit section", count);
+        return node->size;
+    }
+
+    SECTIONREF *ref = new_ref(&c->refs);
+    ref->address = c->address[node->section] + node->size;
+    ref->size = (unsigned int)(total - node->size);
+    ref->section = node->section;
+    ref->kind = REF_REPEAT;
+    ref->unit = node->size;
+    c->referenced[node->section] += ref->size;
+    node->repeat = count;
+    return (unsigned int)total;
+}
+
+// Encode a db/dw/dd/dq value list into dest. Numbers are stored
+// little-endian in width bytes; quoted strings byte by byte, zero-padded
+// to a multiple of width as NASM does, so 'A' also works as a character
+// constant. The size depends only on the commas and string lengths, so
+// with dest NULL the list is just measured and nothing is reported.
+// Returns the size in bytes.
+size_t emit_data(ASSEMBLER *as, STRVIEW values, int width, unsigned char *dest, int line)
+{
+    const char *p = values.ptr, *end = values.ptr + values.len;
+    size_t size = 0;
+
+    for (;;) {
+        while (p < end && char_class[(unsigned char)*p] == CC_SPACE) p++;
+        if (p == end || *p == ';' || *p == ',') {
+            if (dest) {
+                report_error(as, line, "missing data value");
             }
+            if (p == end || *p == ';') break;
+            p++;
+            continue;
         }
-        else if (strcmp(type, "MR") == 0) {
-            // Register to Memory: [mem] , reg
-            // mov [destination_memory], source_register
 
-            const char *mem = op1;      // destination memory operand  
-            const char *reg = op2;      // source register
+        const char *start = p;
+        if (char_class[(unsigned char)*p] == CC_QUOTE) {
+            const char *close = memchr(p + 1, *p, end - p - 1);
+            if (!close) {
+                if (dest) {
+                    report_error(as, line, "unterminated string");
+                }
+                close = end;
+            }
+            size_t n = close - p - 1;
+            size_t padded = (n + width - 1) / width * width;
+            if (dest) {
+                memcpy(dest + size, p + 1, n);
+                memset(dest + size + n, 0, padded - n);
+            }
+            size += padded;
+            p = close < end ? close + 1 : end;
+        } else if (dest) {
+            unsigned long long value;
+            int negative;
+            const char *after = parse_data_number(p, end, &value, &negative);
+            if (after) p = after;
+            while (p < end && char_class[(unsigned char)*p] == CC_SPACE) p++;
+
+            unsigned long long limit = width == 8 ? ~0ull : (1ull << (8 * width)) - 1;
+            if (!after || (p < end && *p != ',' && *p != ';')) {
+                while (p < end && *p != ',' && *p != ';') p++;
+                STRVIEW bad = view_trim((STRVIEW){ start, (int)(p - start) });
+                report_error(as, line, "invalid value '%.*s'", bad.len, bad.ptr);
+                value = 0;
+            } else if (negative ? value > limit / 2 + 1 : value > limit) {
+                report_error(as, line, "value '%.*s' does not fit in %d byte%s",
+                             (int)(after - start), start, width, width > 1 ? "s" : "");
+                value = 0;
+            }
+            if (negative) value = -value;
 
-            // Remove the brackets from memory operand
-            char mem_copy[256];
-            strcpy(mem_copy, mem);
+            unsigned char *d = dest + size;
+            for (int i = 0; i < width; i++, value >>= 8)
+                d[i] = (unsigned char)value;
+            size += width;
+        } else {
+            while (p < end && *p != ',' && *p != ';') p++;
+            size += width;
+        }
 
-            if (mem_copy[0] == '[') {
-                // Remove opening bracket
-                memmove(mem_copy, mem_copy + 1, strlen(mem_copy));
-                // Remove closing bracket
-                if (mem_copy[strlen(mem_copy)-1] == ']')
-                    mem_copy[strlen(mem_copy)-1] = '\0';
+        // Next value, if any; text straight after a string is skipped
+        while (p < end && char_class[(unsigned char)*p] == CC_SPACE) p++;
+        if (p < end && *p != ',' && *p != ';') {
+            if (dest) {
+                report_error(as, line, "expected ',' after string");
             }
+            while (p < end && *p != ',' && *p != ';') p++;
+        }
+        if (p == end || *p == ';') break;
+        p++;
+    }
+    return size;
+}
 
-            // Now parse mem_copy which contains the memory operand without brackets
+// Scan the next token. One pass over the line: each character is
+// classified once, and the token is typed as it is recognised.
+void next_token(LEXER *lx, TOKEN *tok)
+{
+    const char *p = lx->pos;
 
-            // Check for SIB addressing (contains '*')
-            char *star = strchr(mem_copy, '*');
+    while (p < lx->end && char_class[(unsigned char)*p] == CC_SPACE) p++;
 
-            if (star) {
-                // Handle SIB addressing: [base+index*scale(+disp)]
+    tok->text.ptr = p;
+    tok->value = 0;
+    tok->reg = -1;
 
-                // Find the parts
-                char *plus_before_star = NULL;
-                char *plus_after_star = NULL;
+    if (p == lx->end) {
+        tok->kind = TOK_END;
+        tok->text.len = 0;
+        lx->pos = p;
+        return;
+    }
 
-                // Look for '+' before '*'
-                for (char *p = mem_copy; p < star; p++) {
-                    if (*p == '+') plus_before_star = p;
-                }
+    const char *start = p;
+    switch (char_class[(unsigned char)*p]) {
+        case CC_IDENT:
+            while (p < lx->end && (char_class[(unsigned char)*p] == CC_IDENT ||
+                                   char_class[(unsigned char)*p] == CC_DIGIT))
+                p++;
+            tok->text.len = p - start;
+            tok->reg = (signed char)reg_code(tok->text);
+            tok->kind = tok->reg >= 0 ? TOK_REGISTER : TOK_IDENT;
+            break;
 
-                // Look for '+' after '*'
-                for (char *p = star + 1; *p; p++) {
-                    if (*p == '+') {
-                        plus_after_star = p;
-                        break;
-                    }
-                }
+        case CC_DIGIT:
+            // Digits and letters, so "0x1F" and "1Fh" scan as one token
+            while (p < lx->end && (char_class[(unsigned char)*p] == CC_IDENT ||
+                                   char_class[(unsigned char)*p] == CC_DIGIT))
+                p++;
+            tok->text.len = p - start;
+            tok->kind = parse_number(tok->text, &tok->value) > 0 ? TOK_NUMBER : TOK_ERROR;
+            break;
 
-                // Parse components
-                char base_reg[32] = "";
-                char index_reg[32] = "";
-                int scale = 1;
-                int disp = 0;
-
-                if (plus_before_star) {
-                    // Has base register before index
-                    *plus_before_star = '\0';
-                    strcpy(base_reg, mem_copy);
-                    strcpy(index_reg, plus_before_star + 1);
-                } else {
-                    // No base, only index*scale
-                    strcpy(index_reg, mem_copy);
-                }
+        case CC_QUOTE: {
+            // String or character constant; text excludes the quotes
+            char quote = *p++;
+            while (p < lx->end && *p != quote) p++;
+            if (p == lx->end) {
+                tok->kind = TOK_ERROR;
+                tok->text.len = p - start;
+                break;
+            }
+            tok->kind = TOK_STRING;
+            tok->text.ptr = start + 1;
+            tok->text.len = p - start - 1;
+            p++;
+            break;
+        }
 
-                // Extract scale (remove everything after '*')
-                char *scale_end = star;
-                while (*scale_end && *scale_end != '+' && *scale_end != ']') {
-                    scale_end++;
-                }
-                char scale_char = *scale_end;
-                *scale_end = '\0';
-                scale = atoi(star + 1);
-                *scale_end = scale_char;
-
-                // Extract displacement if exists
-                if (plus_after_star) {
-                    disp = atoi(plus_after_star + 1);
-                }
+        case CC_PUNCT:
+            tok->kind = (unsigned char)*p++;   // TokenKind values are the characters
+            tok->text.len = 1;
+            break;
 
-                // Calculate scale encoding
-                int scale_enc;
-                switch (scale) {
-                    case 1: scale_enc = 0; break;
-                    case 2: scale_enc = 1; break;
-                    case 4: scale_enc = 2; break;
-                    case 8: scale_enc = 3; break;
-                    default: scale_enc = 0; break;
-                }
+        case CC_COMMENT:
+            // The rest of the line is a comment
+            p = lx->end;
+            tok->kind = TOK_END;
+            tok->text.len = 0;
+            break;
 
-                // Calculate SIB byte
-                int base_code, index_code;
+        default:
+            p++;
+            tok->kind = TOK_ERROR;
+            tok->text.len = 1;
+            break;
+    }
+    lx->pos = p;
+}
 
-                if (strlen(base_reg) > 0) {
-                    base_code = reg_code(base_reg);
-                    if (base_code < 0) base_code = 5; // EBP if invalid
-                } else {
-                    base_code = 5; // No base register
-                }
+// Little-endian value of a 1-4 character constant like 'A'
+static int char_constant(STRVIEW s, int *value)
+{
+    if (s.len < 1 || s.len > 4) return 0;
+    unsigned int v = 0;
+    for (int i = s.len - 1; i >= 0; i--)
+        v = (v << 8) | (unsigned char)s.ptr[i];
+    *value = (int)v;
+    return 1;
+}
 
-                // Clean index register string (remove scale part)
-                char *index_end = strchr(index_reg, '*');
-                if (index_end) *index_end = '\0';
-
-                index_code = reg_code(index_reg);
-                if (index_code < 0) index_code = 4; // ESP if invalid
-
-                unsigned char sib = (unsigned char)((scale_enc << 6) | (index_code << 3) | base_code);
-
-                // Determine mod value
-                int mod;
-                if (strlen(base_reg) == 0) {
-                    // No base register - always mod=00 with 32-bit displacement
-                    mod = 0;
-                } else if (disp == 0 && strcmp(base_reg, "ebp") != 0) {
-                    mod = 0;
-                } else if (disp >= -128 && disp <= 127) {
-                    mod = 1;
-                } else {
-                    mod = 2;
-                }
+// Parse "base + index*scale + disp" up to the closing ']'. Registers
+// without a scale fill base, then index; numbers add to disp; one
+// identifier may stand for a symbolic displacement.
+static int parse_memory(LEXER *lx, TOKEN *tok, OPERAND *op)
+{
+    MEMEXPR *m = &op->mem;
+    int sign = 1;
 
-                // Add modrm byte (reg field has source register, rm=100 for SIB)
-                machine[len++] = mod_rm(mod, reg, "esp");
-
-                // Add SIB byte
-                machine[len++] = sib;
-
-                // Add displacement if needed
-                if (mod == 1) {
-                    machine[len++] = (unsigned char)(disp & 0xFF);
-                } else if (mod == 2 || strlen(base_reg) == 0) {
-                    // 32-bit displacement for large disp or no-base SIB
-                    machine[len++] = (unsigned char)(disp & 0xFF);
-                    machine[len++] = (unsigned char)((disp >> 8) & 0xFF);
-                    machine[len++] = (unsigned char)((disp >> 16) & 0xFF);
-                    machine[len++] = (unsigned char)((disp >> 24) & 0xFF);
-                }
+    m->base = m->index = -1;
+    m->scale = 1;
+    m->disp = 0;
 
+    next_token(lx, tok);
+    for (;;) {
+        if (tok->kind == TOK_REGISTER) {
+            if (sign < 0) return 0;
+            int reg = tok->reg;
+            next_token(lx, tok);
+            if (tok->kind == TOK_STAR) {
+                next_token(lx, tok);
+                if (tok->kind != TOK_NUMBER || m->index >= 0) return 0;
+                if (tok->value != 1 && tok->value != 2 && tok->value != 4 && tok->value != 8) return 0;
+                m->index = (signed char)reg;
+                m->scale = (unsigned char)tok->value;
+                next_token(lx, tok);
+            } else if (m->base < 0) {
+                m->base = (signed char)reg;
+            } else if (m->index < 0) {
+                m->index = (signed char)reg;
             } else {
-                // NON-SIB addressing modes
-
-                // Check for displacement: [reg+disp] or [disp]
-                char *plus = strchr(mem_copy, '+');
-
-                if (!plus) {
-                    // Simple cases: [reg] or [disp]
-                    if (is_register(mem_copy)) {
-                        // [reg] - register indirect
-                        machine[len++] = mod_rm(0, reg, mem_copy);
-                    } else {
-                        // [disp] - direct memory addressing
-                        machine[len++] = mod_rm(0, reg, "ebp");
-                        int disp = atoi(mem_copy);
-                        machine[len++] = (unsigned char)(disp & 0xFF);
-                        machine[len++] = (unsigned char)((disp >> 8) & 0xFF);
-                        machine[len++] = (unsigned char)((disp >> 16) & 0xFF);
-                        machine[len++] = (unsigned char)((disp >> 24) & 0xFF);
-                    }
-                } else {
-                    // [reg+disp]
-                    char base_reg[32];
-                    strncpy(base_reg, mem_copy, plus - mem_copy);
-                    base_reg[plus - mem_copy] = '\0';
-
-                    int disp = atoi(plus + 1);
-                    int mod;
-
-                    if (disp == 0 && strcmp(base_reg, "ebp") != 0) {
-                        mod = 0;
-                    } else if (disp >= -128 && disp <= 127) {
-                        mod = 1;
-                    } else {
-                        mod = 2;
-                    }
-
-                    machine[len++] = mod_rm(mod, reg, base_reg);
-
-                    if (mod == 1) {
-                        machine[len++] = (unsigned char)(disp & 0xFF);
-                    } else if (mod == 2) {
-                        machine[len++] = (unsigned char)(disp & 0xFF);
-                        machine[len++] = (unsigned char)((disp >> 8) & 0xFF);
-                        machine[len++] = (unsigned char)((disp >> 16) & 0xFF);
-                        machine[len++] = (unsigned char)((disp >> 24) & 0xFF);
-                    }
-                }
+                return 0;
+            }
+        } else if (tok->kind == TOK_NUMBER) {
+            long value = tok->value;
+            next_token(lx, tok);
+            if (tok->kind == TOK_STAR) {
+                // scale*register
+                next_token(lx, tok);
+                if (tok->kind != TOK_REGISTER || m->index >= 0 || sign < 0) return 0;
+                if (value != 1 && value != 2 && value != 4 && value != 8) return 0;
+                m->index = tok->reg;
+                m->scale = (unsigned char)value;
+                next_token(lx, tok);
+            } else {
+                m->disp += (int)(sign * value);
             }
+        } else if (tok->kind == TOK_IDENT) {
+            if (op->sym.len || sign < 0) return 0;
+            op->sym = tok->text;
+            next_token(lx, tok);
+        } else {
+            return 0;
         }
 
-        // Use the new print function that includes address
-        print_instruction(original, machine, len);
+        if (tok->kind == TOK_RBRACKET) break;
+        if (tok->kind == TOK_PLUS) sign = 1;
+        else if (tok->kind == TOK_MINUS) sign = -1;
+        else return 0;
+        next_token(lx, tok);
+    }
 
-    } else {
-        // For non-instruction lines (labels, directives, etc.)
-        printf("%4d                                      %s\n", line_number++, original);
+    // esp cannot be an index register: [eax+esp] is encoded with esp as base
+    if (m->index == 4) {
+        if (m->scale != 1 || m->base == 4) return 0;
+        m->index = m->base;
+        m->base = 4;
     }
+    next_token(lx, tok);
+    return 1;
 }
 
-// Read .asm file line-by-line and call Assembly_line()
-void assembly_file(const char *filename) {
-    FILE *fp = fopen(filename, "r");
-    char line[MAXLINE];
+// Parse one operand starting at tok, leaving tok on the token after it
+static int parse_operand(LEXER *lx, TOKEN *tok, OPERAND *op)
+{
+    op->sym.len = 0;
 
-    if (!fp) {
-        perror("Cannot open .asm file");
-        return;
+    switch (tok->kind) {
+        case TOK_REGISTER:
+            op->kind = OPD_REG;
+            op->reg = tok->reg;
+            next_token(lx, tok);
+            return 1;
+        case TOK_MINUS:
+            next_token(lx, tok);
+            if (tok->kind != TOK_NUMBER || tok->value > 0x80000000l) return 0;
+            op->kind = OPD_IMM;
+            op->imm = (int)-tok->value;
+            next_token(lx, tok);
+            return 1;
+        case TOK_NUMBER:
+            op->kind = OPD_IMM;
+            op->imm = (int)tok->value;
+            next_token(lx, tok);
+            return 1;
+        case TOK_STRING:
+            op->kind = OPD_IMM;
+            if (!char_constant(tok->text, &op->imm)) return 0;
+            next_token(lx, tok);
+            return 1;
+        case TOK_IDENT:
+            op->kind = OPD_SYM;
+            op->sym = tok->text;
+            next_token(lx, tok);
+            if (tok->kind == TOK_LBRACKET && view_equal(op->sym, "dword")) {
+                // Operand size of [mem] with an immediate or none: dword is
+                // the only one, and the default
+                op->kind = OPD_MEM;
+                op->sym.len = 0;
+                return parse_memory(lx, tok, op);
+            }
+            return 1;
+        case TOK_LBRACKET:
+            op->kind = OPD_MEM;
+            return parse_memory(lx, tok, op);
+        default:
+            return 0;
     }
-    
-    // Reset counters for new file
-    reset_address_counter();
-    symbol_count = 0;  // Clear symbol table
-    
-    int current = SEC_NONE;
-    char current_section[20] = "";
-    
-    while (fgets(line, sizeof(line), fp)) {
-        // Trim newline
-        line[strcspn(line, "\n")] = 0;
-        
-        // Skip empty lines
-        if (strlen(line) == 0) {
-            printf("%4d\n", line_number++);
-            continue;
-        }
-        
-        // Convert to lowercase for processing (keep original for display)
-        char original_line[MAXLINE];
-        strcpy(original_line, line);
-        tolower_str(line);
-
-        if (strstr(line, ".data")) {
-            current = SEC_DATA;
-            strcpy(current_section, ".data");
-            current_address = 0;  // Reset address for new section
-            printf("%4d                                      %s\n", line_number++, original_line);
-            continue;
+}
+
+// Lex and parse "mnemonic [op1 [, op2]]". Returns 0 if the line does not
+// have that shape.
+int parse_instruction(STRVIEW line, STRVIEW *mnemonic, OPERAND *op1, OPERAND *op2)
+{
+    LEXER lx = { line.ptr, line.ptr + line.len };
+    TOKEN tok;
+
+    op1->kind = op2->kind = OPD_NONE;
+    op1->sym.len = op2->sym.len = 0;    // Absent operands name no symbol
+
+    next_token(&lx, &tok);
+    if (tok.kind != TOK_IDENT) return 0;
+    *mnemonic = tok.text;
+
+    next_token(&lx, &tok);
+    if (tok.kind == TOK_END) return 1;
+    if (!parse_operand(&lx, &tok, op1)) return 0;
+    if (tok.kind == TOK_END) return 1;
+    if (tok.kind != TOK_COMMA) return 0;
+
+    next_token(&lx, &tok);
+    if (!parse_operand(&lx, &tok, op2)) return 0;
+    return tok.kind == TOK_END;
+}
+
+// Operand type for the opcode table lookup
+OperandType operand_type(const OPERAND *op1, const OPERAND *op2)
+{
+    switch (op1->kind) {
+        case OPD_NONE:
+            return op2->kind == OPD_NONE ? OPT_NOOP : OPT_INVALID;
+        case OPD_REG:
+            if (op2->kind == OPD_NONE) return OPT_R;
+            if (op2->kind == OPD_REG) return OPT_RR;
+            if (op2->kind == OPD_IMM) return OPT_RI;
+            if (op2->kind == OPD_MEM) return OPT_RM;
+            return OPT_INVALID;
+        case OPD_IMM:
+        case OPD_SYM:
+            if (op2->kind == OPD_NONE) return OPT_I;
+            if (op2->kind == OPD_IMM) return OPT_II;
+            return OPT_INVALID;
+        case OPD_MEM:
+            if (op2->kind == OPD_NONE) return OPT_M;
+            if (op2->kind == OPD_REG) return OPT_MR;
+            if (op2->kind == OPD_IMM) return OPT_MI;
+            return OPT_INVALID;
+        default:
+            return OPT_INVALID;
+    }
+}
+
+static unsigned int opcode_hash_n(const char *mnemonic, int len, const char *type)
+{
+    // FNV-1a over the uppercased mnemonic, a separator, then the type
+    unsigned int h = 2166136261u;
+    for (int i = 0; i < len; i++) {
+        h ^= (unsigned char)toupper((unsigned char)mnemonic[i]);
+        h *= 16777619u;
+    }
+    h ^= ',';
+    h *= 16777619u;
+    for (; *type; type++) {
+        h ^= (unsigned char)*type;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static unsigned int opcode_hash(const char *mnemonic, const char *type)
+{
+    return opcode_hash_n(mnemonic, strlen(mnemonic), type);
+}
+
+// Second-level hash of the built-in perfect hash: mixes the key hash with
+// the displacement chosen for its bucket by the generator
+static inline unsigned int opcode_slot(unsigned int h, unsigned int disp)
+{
+    h ^= disp * 0x9E3779B9u;
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    return h;
+}
+
+// Compare an uppercase table mnemonic against len chars of a mnemonic in
+// any case
+static int mnemonic_equal(const char *upper, const char *s, int len)
+{
+    for (int i = 0; i < len; i++) {
+        if (upper[i] != toupper((unsigned char)s[i])) return 0;
+    }
+    return upper[len] == '\0';
+}
+
+// Convert an opcode column like "8B", "0FBE" or "83 /5" into bytes and
+// the /digit opcode extension (-1 without one)
+static int parse_opcode_bytes(const char *hex, unsigned char *bytes, int *ext)
+{
+    int n = 0;
+    int digits = 0;
+    unsigned int value = 0;
+
+    for (; *hex && !isspace((unsigned char)*hex); hex++) {
+        if (!isxdigit((unsigned char)*hex)) return 0;
+        int d = isdigit((unsigned char)*hex) ? *hex - '0' : toupper((unsigned char)*hex) - 'A' + 10;
+        value = (value << 4) | d;
+        if (++digits == 2) {
+            if (n == 4) return 0;
+            bytes[n++] = (unsigned char)value;
+            value = 0;
+            digits = 0;
         }
-        else if (strstr(line, ".text")) {
-            current = SEC_TEXT;
-            strcpy(current_section, ".text");
-            current_address = 0;  // Reset address for new section
-            printf("%4d                                      %s\n", line_number++, original_line);
+    }
+    if (digits == 1) {
+        if (n == 4) return 0;
+        bytes[n++] = (unsigned char)value;
+    }
+
+    *ext = -1;
+    while (*hex == ' ' || *hex == '\t') hex++;
+    if (*hex == '/') {
+        if (hex[1] < '0' || hex[1] > '7') return 0;
+        *ext = hex[1] - '0';
+    }
+    return n;
+}
+
+// Load the opcode CSV once and build the (mnemonic, type) hash index.
+// Returns the number of opcodes loaded, or 0 on failure.
+int load_opcode_table(const char *filename)
+{
+    FILE *fp = fopen(filename, "r");
+    if (!fp) {
+        perror("Cannot open opcode table");
+        return 0;
+    }
+
+    free_opcode_table();
+
+    char row[128], col1[32], col2[8], col3[32];
+    int capacity = 256;
+    opcode_table = malloc(capacity * sizeof(OPCODE));
+
+    if (!opcode_table || fgets(row, sizeof(row), fp) == NULL) { // skip header
+        fclose(fp);
+        free_opcode_table();
+        return 0;
+    }
+
+    while (fgets(row, sizeof(row), fp)) {
+        if (sscanf(row, "%31[^,],%7[^,],%31[^\n]", col1, col2, col3) != 3)
             continue;
-        }
-        else if (strstr(line, ".bss")) {
-            current = SEC_BSS;
-            strcpy(current_section, ".bss");
-            current_address = 0;  // Reset address for new section
-            printf("%4d                                      %s\n", line_number++, original_line);
+        if (strlen(col1) >= sizeof(opcode_table[0].mnemonic))
             continue;
+
+        OPCODE op;
+        for (int i = 0; ; i++) {
+            op.mnemonic[i] = (char)toupper((unsigned char)col1[i]);
+            if (!col1[i]) break;
         }
-        
-        switch (current) {
-            case SEC_DATA: { 
-                process_data_line(line);
-                break;
+        strcpy(op.type, col2);
+        op.len = parse_opcode_bytes(col3, op.bytes, &op.ext);
+        if (op.len == 0)
+            continue;  // Header row or malformed opcode column
+
+        if (opcode_count == capacity) {
+            capacity *= 2;
+            OPCODE *grown = realloc(opcode_table, capacity * sizeof(OPCODE));
+            if (!grown) {
+                fclose(fp);
+                free_opcode_table();
+                return 0;
             }
-            case SEC_BSS: { 
-                process_bss_line(line);
+            opcode_table = grown;
+        }
+        opcode_table[opcode_count++] = op;
+    }
+    fclose(fp);
+
+    // Keep the index at most half full (power of two size)
+    unsigned int size = 16;
+    while (size < (unsigned int)opcode_count * 2) size <<= 1;
+    opcode_index = calloc(size, sizeof(int));
+    if (!opcode_index) {
+        free_opcode_table();
+        return 0;
+    }
+    opcode_index_mask = size - 1;
+
+    for (int i = 0; i < opcode_count; i++) {
+        unsigned int slot = opcode_hash(opcode_table[i].mnemonic, opcode_table[i].type) & opcode_index_mask;
+        int duplicate = 0;
+        while (opcode_index[slot]) {
+            OPCODE *other = &opcode_table[opcode_index[slot] - 1];
+            if (strcmp(other->mnemonic, opcode_table[i].mnemonic) == 0 &&
+                strcmp(other->type, opcode_table[i].type) == 0) {
+                duplicate = 1;  // First row in the CSV wins, as with the old linear scan
                 break;
             }
-            case SEC_TEXT: {
-                // Parse global directives
-                if (strncmp(line, "global", 6) == 0) {
-                    char *p = line + 6;
-                    while (*p == ' ' || *p == '\t') p++;
-                    
-                    // Parse global symbols
-                    char *tok = strtok(p, ",");
-                    while (tok != NULL) {
-                        // Clean up token
-                        while (*tok == ' ' || *tok == '\t') tok++;
-                        char *end = tok + strlen(tok) - 1;
-                        while (end > tok && (*end == ' ' || *end == '\t' || *end == '\n'))
-                            *end-- = '\0';
-                        
-                        // Add to symbol table as global (not yet defined)
-                        add_symbol(tok, 0, SYM_GLOBAL, current_section, 0, 0);
-                        
-                        tok = strtok(NULL, ",");
-                    }
-                    printf("%4d                                      %s\n", line_number++, original_line);
-                    continue;
-                }
+            slot = (slot + 1) & opcode_index_mask;
+        }
+        if (!duplicate)
+            opcode_index[slot] = i + 1;
+    }
 
-                // Parse extern directives
-                if (strncmp(line, "extern", 6) == 0) {
-                    char *p = line + 6;
-                    while (*p == ' ' || *p == '\t') p++;
-                    
-                    // Parse extern symbols
-                    char *tok = strtok(p, ",");
-                    while (tok != NULL) {
-                        // Clean up token
-                        while (*tok == ' ' || *tok == '\t') tok++;
-                        char *end = tok + strlen(tok) - 1;
-                        while (end > tok && (*end == ' ' || *end == '\t' || *end == '\n'))
-                            *end-- = '\0';
-                        
-                        // Add to symbol table as extern
-                        add_symbol(tok, 0, SYM_EXTERN, "", 0, 0);
-                        
-                        tok = strtok(NULL, ",");
-                    }
-                    printf("%4d                                      %s\n", line_number++, original_line);
-                    continue;
-                }
+    return opcode_count;
+}
 
-                // Check if it's a label (ends with ':')
-                char *colon = strchr(line, ':');
-                if (colon != NULL) {
-                    // Extract label name
-                    char label_name[100];
-                    strncpy(label_name, line, colon - line);
-                    label_name[colon - line] = '\0';
-                    
-                    // Clean up label name
-                    char *end = label_name + strlen(label_name) - 1;
-                    while (end > label_name && (*end == ' ' || *end == '\t'))
-                        *end-- = '\0';
-                    
-                    // Add to symbol table
-                    add_symbol(label_name, current_address, SYM_LABEL, current_section, 0, 1);
-                    
-                    // Print label with its address
-                    printf("%4d %08X                               %s\n", line_number++, current_address, original_line);
-                    
-                    // Check if there's code after the label
-                    char *after_colon = colon + 1;
-                    while (*after_colon == ' ' || *after_colon == '\t') after_colon++;
-                    
-                    if (strlen(after_colon) > 0) {
-                        // Process instruction after label
-                        Assembly_line(after_colon);
-                    }
-                } else {
-                    // It's a regular instruction - process it
-                    Assembly_line(line);
-                }
-                break;				      
+void free_opcode_table()
+{
+    free(opcode_table);
+    free(opcode_index);
+    opcode_table = NULL;
+    opcode_index = NULL;
+    opcode_count = 0;
+    opcode_index_mask = 0;
+}
+
+// Look up an opcode by mnemonic (any case) and operand type.
+// Returns NULL if the combination is not in the table.
+const OPCODE* find_opcode(const char *mnemonic, const char *type)
+{
+    return find_opcode_n(mnemonic, strlen(mnemonic), type);
+}
+
+// find_opcode() for a mnemonic that is not NUL-terminated, e.g. a source view
+const OPCODE* find_opcode_n(const char *mnemonic, int len, const char *type)
+{
+    COUNT(opcode_lookups, 1);
+    if (len >= (int)sizeof(((OPCODE *)0)->mnemonic)) return NULL;
+    if (!opcode_index) {
+        COUNT(opcode_probes, 1);
+        return find_builtin_opcode(mnemonic, len, type);
+    }
+
+    unsigned int slot = opcode_hash_n(mnemonic, len, type) & opcode_index_mask;
+    while (opcode_index[slot]) {
+        const OPCODE *op = &opcode_table[opcode_index[slot] - 1];
+        COUNT(opcode_probes, 1);
+        if (mnemonic_equal(op->mnemonic, mnemonic, len) && strcmp(op->type, type) == 0)
+            return op;
+        slot = (slot + 1) & opcode_index_mask;
+    }
+    return NULL;
+}
+
+// Look up an opcode in the compiled-in perfect hash table: one hash, one
+// probe, one compare.
+const OPCODE* find_builtin_opcode(const char *mnemonic, int len, const char *type)
+{
+#ifdef OPCODE_NO_BUILTIN
+    (void)mnemonic;
+    (void)len;
+    (void)type;
+    return NULL;
+#else
+    unsigned int h = opcode_hash_n(mnemonic, len, type);
+    unsigned int disp = builtin_opcode_disp[h & (BUILTIN_OPCODE_BUCKETS - 1)];
+    const OPCODE *op = &builtin_opcodes[opcode_slot(h, disp) & (BUILTIN_OPCODE_SLOTS - 1)];
+
+    if (mnemonic_equal(op->mnemonic, mnemonic, len) && strcmp(op->type, type) == 0)
+        return op;
+    return NULL;
+#endif
+}
+
+// Stable number of an opcode in the active table (CSV or built-in), for
+// the incremental cache
+unsigned int opcode_id(const OPCODE *op)
+{
+#ifndef OPCODE_NO_BUILTIN
+    if (!opcode_index) return (unsigned int)(op - builtin_opcodes);
+#endif
+    return (unsigned int)(op - opcode_table);
+}
+
+const OPCODE* opcode_by_id(unsigned int id)
+{
+#ifndef OPCODE_NO_BUILTIN
+    if (!opcode_index) return id < BUILTIN_OPCODE_SLOTS ? &builtin_opcodes[id] : NULL;
+#endif
+    return id < (unsigned int)opcode_count ? &opcode_table[id] : NULL;
+}
+
+// Hash of the active opcode table; cache entries built against another
+// table are not reused
+unsigned int opcode_table_version()
+{
+    const OPCODE *table = opcode_table;
+    int count = opcode_count;
+#ifndef OPCODE_NO_BUILTIN
+    if (!opcode_index) {
+        table = builtin_opcodes;
+        count = BUILTIN_OPCODE_SLOTS;
+    }
+#endif
+
+    unsigned int h = 2166136261u;
+    for (int i = 0; i < count; i++) {
+        const OPCODE *op = &table[i];
+        const char *fields[2] = { op->mnemonic, op->type };
+        for (int f = 0; f < 2; f++) {
+            for (const char *p = fields[f]; ; p++) {
+                h ^= (unsigned char)*p;
+                h *= 16777619u;
+                if (!*p) break;
             }
         }
+        for (int b = 0; b < op->len; b++) {
+            h ^= op->bytes[b];
+            h *= 16777619u;
+        }
     }
+    return h;
+}
 
-    fclose(fp);
+// Size of the relative displacement of a branch opcode (rel8 or rel32),
+// or 0 if the opcode takes an ordinary immediate
+int branch_rel_size(const OPCODE *op)
+{
+    unsigned char b = op->bytes[0];
+
+    if (op->len == 1 && (b == 0xE8 || b == 0xE9))
+        return 4;   // call rel32, jmp rel32
+    if (op->len == 1 && ((b >= 0x70 && b <= 0x7F) || b == 0xEB || (b >= 0xE0 && b <= 0xE3)))
+        return 1;   // jcc rel8, jmp rel8, loop/loope/loopne/jcxz rel8
+    if (op->len == 2 && b == 0x0F && (op->bytes[1] & 0xF0) == 0x80)
+        return 4;   // jcc rel32
+    return 0;
+}
+
+// Short jumps that have a rel32 form: jcc (70+cc -> 0F 80+cc) and jmp (EB -> E9).
+// loop/jcxz only exist as rel8.
+int is_relaxable_branch(const OPCODE *op)
+{
+    unsigned char b = op->bytes[0];
+    return op->len == 1 && ((b >= 0x70 && b <= 0x7F) || b == 0xEB);
+}
+
+// Opcodes that encode their register operand in the low 3 bits (e.g. 50+r)
+int is_plus_r_opcode(const OPCODE *op)
+{
+    unsigned char b = op->bytes[op->len - 1];
+
+    if (op->len == 1)
+        return b == 0x40 || b == 0x48 || b == 0x50 || b == 0x58 || b == 0xB8;
+    return op->len == 2 && op->bytes[0] == 0x0F && b == 0xC8;  // bswap
+}
+
+// Value of an immediate or symbol operand. Symbols that are not defined
+// yet resolve to 0; in the final pass an undefined, non-extern symbol is
+// reported as an error.
+unsigned int operand_value(ASSEMBLER *as, const OPERAND *op, int line, int final)
+{
+    if (op->kind == OPD_IMM)
+        return (unsigned int)op->imm;
+
+    SYMBOL *sym = find_symbol_n(as, op->sym.ptr, op->sym.len);
+    if (sym && sym->defined)
+        return sym->address;
+    if (final && (!sym || sym->type != SYM_EXTERN)) {
+        report_error(as, line, "undefined symbol '%.*s'", op->sym.len, op->sym.ptr);
+    }
+    return 0;
+}
+
+// Report a line Assembly_line() cannot encode: a mnemonic the opcode table
+// has with no operand form, or none at all
+static int report_unencodable(ASSEMBLER *as, STRVIEW mnemonic, int line)
+{
+    for (int t = 0; t < OPT_INVALID; t++) {
+        if (find_opcode_n(mnemonic.ptr, mnemonic.len, operand_type_name[t])) {
+            report_error(as, line, "unsupported operands for '%.*s'", mnemonic.len, mnemonic.ptr);
+            return 0;
+        }
+    }
+    report_error(as, line, "unknown instruction '%.*s'", mnemonic.len, mnemonic.ptr);
+    return 0;
 }
 
-int main() {
-    printf("Line   Address   Machine Code             Assembly\n");
-    printf("---- ---------- ------------------------ -------------------------\n");
-    assembly_file("input1.asm");
-    print_symbol_table();
+// The first number on a line that fits neither a signed nor an unsigned
+// 32-bit value, as next_token() and parse_operand() reject them. Returns 0
+// if there is none.
+static int oversized_number(STRVIEW line, STRVIEW *number)
+{
+    LEXER lx = { line.ptr, line.ptr + line.len };
+    TOKEN tok;
+    int minus = 0;
+    long value;
+    for (next_token(&lx, &tok); tok.kind != TOK_END; next_token(&lx, &tok)) {
+        int big = tok.kind == TOK_ERROR && char_class[(unsigned char)tok.text.ptr[0]] == CC_DIGIT &&
+                  parse_number(tok.text, &value) < 0;
+        if (big || (minus && tok.kind == TOK_NUMBER && tok.value > 0x80000000l)) {
+            *number = minus ? (STRVIEW){ tok.text.ptr - 1, tok.text.len + 1 } : tok.text;
+            return 1;
+        }
+        minus = tok.kind == TOK_MINUS;
+    }
     return 0;
 }
+
+// Parse one instruction into an IR node. Returns 1 if the line holds an
+// instruction we can encode; anything else is reported as an error and
+// returns 0.
+int Assembly_line(ASSEMBLER *as, STRVIEW line, IRNODE *node)
+{
+    STRVIEW mnemonic;
+    OPERAND op1, op2;
+
+    COUNT(parsed, 1);
+    if (!parse_instruction(line, &mnemonic, &op1, &op2)) {
+        STRVIEW number;
+        if (oversized_number(line, &number))
+            report_error(as, node->line, "value '%.*s' does not fit in 32 bits", number.len, number.ptr);
+        else
+            report_error(as, node->line, "invalid instruction '%.*s'", line.len, line.ptr);
+        return 0;
+    }
+
+    // Determine operand type (RR, RI, MR, RM, R, I, II, NOOP)
+    OperandType type = operand_type(&op1, &op2);
+    if (type == OPT_INVALID)
+        return report_unencodable(as, mnemonic, node->line);
+
+    // Find opcode in the built-in (or --opcodes) table
+    const OPCODE *opcode = find_opcode_n(mnemonic.ptr, mnemonic.len, operand_type_name[type]);
+    if (!opcode)
+        return report_unencodable(as, mnemonic, node->line);
+    if ((type == OPT_R && opcode->ext < 0 && !is_plus_r_opcode(opcode)) ||
+        ((type == OPT_M || type == OPT_MI) && opcode->ext < 0))
+        return report_unencodable(as, mnemonic, node->line);   // Needs a /digit the table does not record
+    if (type == OPT_II && (op2.imm < 0 || op2.imm > 255)) {
+        report_error(as, node->line, "nesting level must be from 0 to 255, not %d", op2.imm);
+        return 0;
+    }
+
+    // -Os: mov reg, 0 (B8+r id) as xor reg, reg, 3 bytes shorter. Off by
+    // default because xor also sets the flags.
+    if (as->optimize_size && type == OPT_RI && opcode->bytes[0] == 0xB8 && op2.imm == 0) {
+        const OPCODE *xor = find_opcode_n("xor", 3, "RR");
+        if (xor) {
+            type = OPT_RR;
+            opcode = xor;
+            op2 = op1;
+        }
+    }
+
+    node->kind = IR_INSN;
+    node->opcode = opcode;
+    node->type = (unsigned char)type;
+    node->op1 = op1;
+    node->op2 = op2;
+
+    // Size it now; only symbol values change in pass 2, never the length
+    unsigned char machine[16];
+    node->size = encode_instruction(as, node, machine, NULL);
+    return 1;
+}
+
+// Effective-address forms, indexed by base register + 1 (0 = no base):
+// esp as a base needs a SIB byte, ebp has no mod=00 form (that encoding
+// means disp32 without a base), and no base at all is disp32 only
+enum { EA_SIB = 1, EA_DISP = 2, EA_DISP32 = 4 };
+static const unsigned char ea_base_form[9] = { EA_DISP32, 0, 0, 0, 0, EA_SIB, EA_DISP, 0, 0 };
+static const unsigned char ea_scale_bits[9] = { 0, 0, 1, 0, 2, 0, 0, 0, 3 };
+
+// Append ModR/M, SIB and displacement for [base+index*scale+disp] with reg
+// (a register or /digit) in the reg field, in the shortest form. A
+// symbolic displacement always takes disp32, whose value is only known
+// in pass 2.
+static int encode_modrm(unsigned char *machine, int len, int reg, const MEMEXPR *m, int disp, int symbolic)
+{
+    int form = ea_base_form[m->base + 1] | (m->index >= 0 ? EA_SIB : 0);
+    int mod = 0;
+    if (!(form & EA_DISP32)) {
+        if (symbolic || disp < -128 || disp > 127) mod = 2;
+        else if (disp != 0 || (form & EA_DISP)) mod = 1;
+    }
+
+    if (form & EA_SIB) {
+        machine[len++] = mod_rm(mod, reg, 4);
+        machine[len++] = (unsigned char)((ea_scale_bits[m->scale] << 6) |
+                                         ((m->index >= 0 ? m->index : 4) << 3) | (m->base >= 0 ? m->base : 5));
+    } else {
+        machine[len++] = mod_rm(mod, reg, m->base >= 0 ? m->base : 5);
+    }
+
+    if (mod == 1) {
+        machine[len++] = (unsigned char)(disp & 0xFF);
+    } else if (mod == 2 || (form & EA_DISP32)) {
+        machine[len++] = (unsigned char)(disp & 0xFF);
+        machine[len++] = (unsigned char)((disp >> 8) & 0xFF);
+        machine[len++] = (unsigned char)((disp >> 16) & 0xFF);
+        machine[len++] = (unsigned char)((disp >> 24) & 0xFF);
+    }
+    return len;
+}
+
+// Memory operand of any form (RM, MR, M, MI). A symbol in the address is
+// added to the displacement and relocated like an absolute push imm32.
+static int encode_memory(ASSEMBLER *as, const IRNODE *node, const OPERAND *op, int reg,
+                         unsigned char *machine, int len, RELOCLIST *relocs)
+{
+    if (!op->sym.len)
+        return encode_modrm(machine, len, reg, &op->mem, op->mem.disp, 0);
+
+    operand_value(as, op, node->line, relocs != NULL);    // Reports undefined symbols
+    SYMBOL *sym = find_symbol_n(as, op->sym.ptr, op->sym.len);
+    int relocated = sym && (sym->defined || sym->type == SYM_EXTERN);
+    int disp = op->mem.disp + (relocated ? relocation_addend(sym, R_386_32) : 0);
+
+    len = encode_modrm(machine, len, reg, &op->mem, disp, 1);
+    if (relocs && relocated)
+        add_relocation(relocs, node->section, node->address + len - 4, R_386_32, sym - as->symbol_table);
+    return len;
+}
+
+// Append the immediate of an RI/MI instruction, sized by its opcode byte:
+// ib for the 83, C0/C1, 80 and E4/E6 forms, id otherwise. Group 83 /n ib
+// becomes 81 /n id when the value does not fit a sign-extended byte.
+static int encode_immediate(unsigned char *machine, int len, int imm)
+{
+    unsigned char b = machine[0];
+    if (b == 0x83 && (imm < -128 || imm > 127))
+        machine[0] = b = 0x81;
+
+    machine[len++] = (unsigned char)(imm & 0xFF);
+    if (b == 0x83 || b == 0xC1 || b == 0xC0 || b == 0x80 || b == 0xE4 || b == 0xE6)
+        return len;
+    machine[len++] = (unsigned char)((imm >> 8) & 0xFF);
+    machine[len++] = (unsigned char)((imm >> 16) & 0xFF);
+    machine[len++] = (unsigned char)((imm >> 24) & 0xFF);
+    return len;
+}
+
+// Encode an IR instruction into machine. With relocs set (pass 2), symbols
+// must be resolvable, branch displacements must fit, and relocations are
+// appended to relocs. Returns the length.
+int encode_instruction(ASSEMBLER *as, const IRNODE *node, unsigned char *machine, RELOCLIST *relocs)
+{
+    int final = relocs != NULL;
+    const OPCODE *opcode = node->opcode;
+    const OPERAND *op1 = &node->op1;
+    const OPERAND *op2 = &node->op2;
+    int len = 0;
+
+    // Copy the opcode byte(s)
+    memcpy(machine, opcode->bytes, opcode->len);
+    len = opcode->len;
+
+    switch (node->type) {
+    case OPT_NOOP:
+        // Opcode only
+        break;
+
+    case OPT_R:
+        if (opcode->ext >= 0) {
+            // Group opcode: /digit in ModR/M, e.g. neg eax = F7 /3
+            machine[len++] = mod_rm(3, opcode->ext, op1->reg);
+        } else {
+            // Register in the low bits of the opcode, e.g. push eax = 50+r
+            machine[len - 1] = (unsigned char)(machine[len - 1] + op1->reg);
+        }
+        break;
+
+    case OPT_I: {
+        unsigned int value = operand_value(as, op1, node->line, final);
+        int rel = branch_rel_size(opcode);
+
+        if (node->near) {
+            // Near form chosen by relax_branches()
+            if (machine[0] == 0xEB) {
+                machine[0] = 0xE9;
+            } else {
+                machine[1] = (unsigned char)(0x80 | (machine[0] & 0x0F));
+                machine[0] = 0x0F;
+                len = 2;
+            }
+            rel = 4;
+        }
+
+        SYMBOL *sym = op1->kind == OPD_SYM ? find_symbol_n(as, op1->sym.ptr, op1->sym.len) : NULL;
+        int reloc = 0;
+
+        if (rel) {
+            // Branch: displacement is relative to the next instruction.
+            // Targets outside this section are left to the linker.
+            int disp = 0;
+            if (!sym ? op1->kind == OPD_IMM : sym->defined && sym->section == node->section) {
+                disp = (int)(value - (node->address + len + rel));
+            } else if (sym && (sym->defined || sym->type == SYM_EXTERN) && rel == 4) {
+                disp = relocation_addend(sym, R_386_PC32);
+                reloc = R_386_PC32;
+            }
+            if (final && reloc)
+                add_relocation(relocs, node->section, node->address + len, reloc, sym - as->symbol_table);
+
+            if (rel == 1) {
+                // loop/jcxz have no rel32 form to carry a relocation
+                if (final && sym && (sym->defined || sym->type == SYM_EXTERN) &&
+                    (!sym->defined || sym->section != node->section)) {
+                    report_error(as, node->line, "short jump to '%.*s' cannot reach another section or an extern",
+                                 op1->sym.len, op1->sym.ptr);
+                } else if (final && (disp < -128 || disp > 127)) {
+                    report_error(as, node->line, "short jump to '%.*s' out of range (%d bytes)",
+                                 op1->sym.len, op1->sym.ptr, disp);
+                }
+                machine[len++] = (unsigned char)(disp & 0xFF);
+            } else {
+                machine[len++] = (unsigned char)(disp & 0xFF);
+                machine[len++] = (unsigned char)((disp >> 8) & 0xFF);
+                machine[len++] = (unsigned char)((disp >> 16) & 0xFF);
+                machine[len++] = (unsigned char)((disp >> 24) & 0xFF);
+            }
+        } else if (machine[0] == 0xC2) {
+            // ret imm16
+            machine[len++] = (unsigned char)(value & 0xFF);
+            machine[len++] = (unsigned char)((value >> 8) & 0xFF);
+        } else if (machine[0] == 0xC8) {
+            // enter imm16 = enter imm16, 0
+            machine[len++] = (unsigned char)(value & 0xFF);
+            machine[len++] = (unsigned char)((value >> 8) & 0xFF);
+            machine[len++] = 0;
+        } else {
+            // push imm32; symbol addresses are relocated
+            if (sym && (sym->defined || sym->type == SYM_EXTERN)) {
+                value = (unsigned int)relocation_addend(sym, R_386_32);
+                if (final)
+                    add_relocation(relocs, node->section, node->address + len, R_386_32, sym - as->symbol_table);
+            }
+            machine[len++] = (unsigned char)(value & 0xFF);
+            machine[len++] = (unsigned char)((value >> 8) & 0xFF);
+            machine[len++] = (unsigned char)((value >> 16) & 0xFF);
+            machine[len++] = (unsigned char)((value >> 24) & 0xFF);
+        }
+        break;
+    }
+
+    case OPT_RR:
+        // Both operands are registers
+        machine[len++] = mod_rm(3, op1->reg, op2->reg);
+        break;
+
+    case OPT_RI:
+        // Register and immediate: mov r, imm32 = B8+r id; add r, imm8 =
+        // 83 /0 ib (81 /0 id for larger values)
+        if (opcode->ext >= 0)
+            machine[len++] = mod_rm(3, opcode->ext, op1->reg);
+        else if (is_plus_r_opcode(opcode))
+            machine[len - 1] = (unsigned char)(machine[len - 1] + op1->reg);
+        len = encode_immediate(machine, len, op2->imm);
+        break;
+
+    case OPT_RM:
+        // Register to Memory: reg , [mem] (and lea)
+        len = encode_memory(as, node, op2, op1->reg, machine, len, relocs);
+        break;
+
+    case OPT_MR:
+        // mov [destination_memory], source_register
+        len = encode_memory(as, node, op1, op2->reg, machine, len, relocs);
+        break;
+
+    case OPT_M:
+        // inc dword [mem] = FF /0
+        len = encode_memory(as, node, op1, opcode->ext, machine, len, relocs);
+        break;
+
+    case OPT_MI:
+        // mov dword [mem], imm = C7 /0 id; add dword [mem], imm = 83 /0 ib or 81 /0 id
+        len = encode_memory(as, node, op1, opcode->ext, machine, len, relocs);
+        len = encode_immediate(machine, len, op2->imm);
+        break;
+
+    case OPT_II: {
+        // enter imm16, imm8 = C8 iw ib: frame size, then nesting level
+        unsigned int value = operand_value(as, op1, node->line, final);
+        machine[len++] = (unsigned char)(value & 0xFF);
+        machine[len++] = (unsigned char)((value >> 8) & 0xFF);
+        machine[len++] = (unsigned char)op2->imm;
+        break;
+    }
+    }
+    return len;
+}
+
+// Append a fresh IR node for the chunk's current line
+IRNODE* new_ir_node(CHUNK *c, IRKind kind, STRVIEW text) {
+    if (c->ir_count == c->ir_capacity) {
+        int capacity = c->ir_capacity ? c->ir_capacity * 2 : 1024;
+        IRNODE *grown = realloc(c->ir, capacity * sizeof(IRNODE));
+        if (!grown) {
+            fprintf(stderr, "Out of memory growing IR!\n");
+            exit(1);
+        }
+        c->ir = grown;
+        c->ir_capacity = capacity;
+    }
+
+    IRNODE *node = &c->ir[c->ir_count++];
+    memset(node, 0, sizeof(IRNODE));
+    node->kind = kind;
+    node->section = c->section;
+    node->line = c->line++;
+    node->text = text.ptr;
+    node->text_len = text.len;
+    node->address = c->address[c->section];
+    node->offset = node->address - c->referenced[c->section];
+    return node;
+}
+
+// Record a symbol definition or declaration. Chunks run in parallel, so
+// the symbol table is only updated afterwards, in source order.
+void chunk_symbol(CHUNK *c, STRVIEW name, unsigned int address, SymType type, Section section, int size, int defined, int node) {
+    if (c->sym_count == c->sym_capacity) {
+        int capacity = c->sym_capacity ? c->sym_capacity * 2 : 256;
+        SYMEVENT *grown = realloc(c->syms, capacity * sizeof(SYMEVENT));
+        if (!grown) {
+            fprintf(stderr, "Out of memory recording symbols!\n");
+            exit(1);
+        }
+        c->syms = grown;
+        c->sym_capacity = capacity;
+    }
+
+    SYMEVENT *e = &c->syms[c->sym_count++];
+    e->name = name;
+    e->address = address;
+    e->size = size;
+    e->node = node;
+    e->type = (unsigned char)type;
+    e->section = (unsigned char)section;
+    e->defined = (unsigned char)defined;
+}
+
+// Map the whole file read-only. Nothing is copied or modified: pass 1
+// scans lines out of the mapping as views, and the IR and listing point
+// straight back into it, so lines can be any length.
+int read_source(ASSEMBLER *as, const char *filename) {
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        perror("Cannot open .asm file");
+        return 0;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) < 0) {
+        perror("Cannot stat .asm file");
+        close(fd);
+        return 0;
+    }
+
+    free_source(as);
+    if (st.st_size > 0) {
+        void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map == MAP_FAILED) {
+            perror("Cannot map .asm file");
+            close(fd);
+            return 0;
+        }
+        madvise(map, st.st_size, MADV_SEQUENTIAL);
+        as->source = map;
+        as->source_size = st.st_size;
+        as->source_mapped = 1;
+    } else {
+        as->source = "";
+    }
+    close(fd);
+    return 1;
+}
+
+void free_source(ASSEMBLER *as) {
+    if (as->source_mapped)
+        munmap((void *)as->source, as->source_size);
+    as->source = NULL;
+    as->source_size = 0;
+    as->source_mapped = 0;
+}
+
+// Section selected by a directive line, or SEC_NONE
+static Section section_directive(STRVIEW line) {
+    // Only "section .data" (or segment) and a bare ".data" switch
+    // sections, so a long data line costs one comparison
+    if (view_starts_with(line, "section") || view_starts_with(line, "segment")) {
+        line.ptr += 7;
+        line.len -= 7;
+    } else if (line.len == 0 || line.ptr[0] != '.') {
+        return SEC_NONE;
+    }
+    const char *comment = memchr(line.ptr, ';', line.len);
+    if (comment) line.len = (int)(comment - line.ptr);
+    if (view_contains(line, ".data")) return SEC_DATA;
+    if (view_contains(line, ".text")) return SEC_TEXT;
+    if (view_contains(line, ".bss")) return SEC_BSS;
+    return SEC_NONE;
+}
+
+// Add each comma-separated name of a global/extern directive
+static void add_symbol_list(CHUNK *c, STRVIEW names, SymType type, Section section) {
+    while (names.len > 0) {
+        STRVIEW name = view_trim(next_field(&names, ","));
+        if (name.len > 0)
+            chunk_symbol(c, name, 0, type, section, 0, 0, -1);
+    }
+}
+
+// Run fn on n items of item_size bytes, one thread each; the calling
+// thread takes the first item. With n == 1 nothing is spawned.
+void run_parallel(void *(*fn)(void *), void *items, size_t item_size, int n) {
+    pthread_t threads[MAX_THREADS];
+    int started[MAX_THREADS] = {0};
+
+    for (int i = 1; i < n; i++)
+        started[i] = pthread_create(&threads[i], NULL, fn, (char *)items + i * item_size) == 0;
+    fn(items);
+    for (int i = 1; i < n; i++) {
+        if (started[i])
+            pthread_join(threads[i], NULL);
+        else
+            fn((char *)items + i * item_size);  // Could not start a thread: run it here
+    }
+}
+
+// Pass 1, step 1 (parallel chunks only): count the lines of a chunk and
+// find the section it leaves in effect, so the next chunk knows where it
+// starts. Only the last directive matters, so search backwards.
+static void* scan_chunk(void *arg) {
+    CHUNK *c = arg;
+
+    int lines = 0;
+    for (const char *p = c->start; (p = memchr(p, '\n', c->end - p)) != NULL; p++)
+        lines++;
+    if (c->end > c->start && c->end[-1] != '\n')
+        lines++;
+    c->line_count = lines;
+
+    // A match in a comment, a string or a label is not a directive: the
+    // whole line must parse as one, as in parse_line(), or the search goes on
+    c->last_section = SEC_NONE;
+    for (const char *p = c->end; p > c->start; ) {
+        if (*--p != '.') continue;
+        STRVIEW rest = { p, (int)(c->end - p) };
+        if (!view_starts_with(rest, ".data") && !view_starts_with(rest, ".text") && !view_starts_with(rest, ".bss"))
+            continue;
+
+        const char *line_start = p, *line_end = p;
+        while (line_start > c->start && line_start[-1] != '\n') line_start--;
+        while (line_end < c->end && *line_end != '\n') line_end++;
+        c->last_section = section_directive(view_trim((STRVIEW){ line_start, (int)(line_end - line_start) }));
+        if (c->last_section != SEC_NONE)
+            break;
+        p = line_start;
+    }
+    return NULL;
+}
+
+// Normalize an instruction for the encoding memo: lowercase, whitespace
+// dropped except one space between two words, quoted text kept as is.
+// Returns the key length and its FNV-1a hash, or 0 if it does not fit.
+static int memo_key(STRVIEW line, char *key, unsigned int *hash) {
+    unsigned int h = 2166136261u;
+    int n = 0, space = 0, word = 0;
+    char quote = 0;
+
+    for (int i = 0; i < line.len; i++) {
+        char ch = line.ptr[i];
+        int cls = char_class[(unsigned char)ch];
+        if (n >= MEMO_KEY_LEN - 1) return 0;
+        if (quote) {
+            if (ch == quote) quote = 0;
+        } else if (cls == CC_SPACE) {
+            space = 1;
+            continue;
+        } else {
+            int is_word = cls == CC_IDENT || cls == CC_DIGIT;
+            if (space && word && is_word) {
+                key[n++] = ' ';
+                h ^= ' ';
+                h *= 16777619u;
+            }
+            if (cls == CC_QUOTE) quote = ch;
+            if (ch >= 'A' && ch <= 'Z') ch += 'a' - 'A';
+            word = is_word;
+        }
+        key[n++] = ch;
+        h ^= (unsigned char)ch;
+        h *= 16777619u;
+        space = 0;
+    }
+    *hash = h;
+    return n;
+}
+
+// Assembly_line() through the chunk's encoding memo. An instruction seen
+// before with no symbol and no address-relative operand takes its opcode,
+// size and bytes from the memo; pass 2 copies the bytes.
+static int assemble_memoized(CHUNK *c, STRVIEW line, IRNODE *node) {
+    ENCODEMEMO *memo = c->memo;
+    int mask = c->as->memo_size - 1;
+    char key[MEMO_KEY_LEN];
+    unsigned int hash;
+    int len = mask > 0 ? memo_key(line, key, &hash) : 0;
+    if (!len)
+        return Assembly_line(c->as, line, node);
+
+    if (!memo->entries) {
+        memo->entries = calloc(mask + 1, sizeof(MEMOENTRY));
+        if (!memo->entries) {
+            fprintf(stderr, "Out of memory allocating the encoding memo!\n");
+            exit(1);
+        }
+    }
+
+    unsigned int slot = hash & mask;
+    MEMOENTRY *e;
+    for (; (e = &memo->entries[slot])->key_len; slot = (slot + 1) & mask) {
+        if (e->hash == hash && e->key_len == len && memcmp(e->key, key, len) == 0) {
+            memo->hits++;
+            node->kind = IR_INSN;
+            node->type = e->type;
+            node->opcode = e->opcode;
+            node->size = e->size;
+            node->bytes = e->bytes;
+            return 1;
+        }
+    }
+
+    memo->misses++;
+    if (!Assembly_line(c->as, line, node))
+        return 0;
+
+    // Keep the memo at most 3/4 full so probes stay short
+    if (cache_encodable(node) && memo->count < (mask + 1) / 4 * 3) {
+        e->hash = hash;
+        e->key_len = (unsigned char)len;
+        memcpy(e->key, key, len);
+        e->type = node->type;
+        e->opcode = node->opcode;
+        e->size = (unsigned char)encode_instruction(c->as, node, e->bytes, NULL);
+        node->bytes = e->bytes;
+        memo->count++;
+    }
+    return 1;
+}
+
+// Nanoseconds on a monotonic clock, for the preprocessor time in --stats
+// (0 when not timing)
+static long long preprocess_clock(ASSEMBLER *as) {
+    if (!as->stats) return 0;
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+// The directive name of a "%name ..." line, without the '%'
+static STRVIEW directive_word(STRVIEW line) {
+    STRVIEW word = { line.ptr + 1, 0 };
+    if (line.len == 0 || line.ptr[0] != '%') return (STRVIEW){ NULL, 0 };
+    while (word.len + 1 < line.len && char_class[(unsigned char)word.ptr[word.len]] == CC_IDENT)
+        word.len++;
+    return word;
+}
+
+// A line of [pos, end) as a view without its '\n' or '\r\n'; *next is the
+// start of the line after it
+static STRVIEW next_source_line(const char *pos, const char *end, const char **next) {
+    const char *newline = memchr(pos, '\n', end - pos);
+    STRVIEW text = { pos, (int)((newline ? newline : end) - pos) };
+    *next = newline ? newline + 1 : end;
+    if (text.len > 0 && text.ptr[text.len - 1] == '\r')
+        text.len--;
+    return text;
+}
+
+// Room for one more item in one of the macro table's arrays
+static void* macro_grow(void *items, int count, int *capacity, size_t size) {
+    if (count < *capacity) return items;
+    int grown_capacity = *capacity ? *capacity * 2 : 64;
+    void *grown = realloc(items, grown_capacity * size);
+    if (!grown) {
+        fprintf(stderr, "Out of memory growing macro table!\n");
+        exit(1);
+    }
+    *capacity = grown_capacity;
+    return grown;
+}
+
+static unsigned int macro_hash(const char *name, int len) {
+    // FNV-1a; macro names are case-sensitive
+    unsigned int h = 2166136261u;
+    for (int i = 0; i < len; i++) {
+        h ^= (unsigned char)name[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+// Index slot of name, or the empty slot where it belongs
+static unsigned int macro_slot(const MACROTABLE *mt, const char *name, int len, unsigned int hash) {
+    unsigned int slot = hash & mt->index_mask;
+    while (mt->index[slot]) {
+        const MACRO *m = &mt->macros[mt->index[slot] - 1];
+        if (m->hash == hash && m->name.len == len && memcmp(m->name.ptr, name, len) == 0)
+            break;
+        slot = (slot + 1) & mt->index_mask;
+    }
+    return slot;
+}
+
+// The definition of name in effect on a line, NULL if there is none
+static const MACRO* find_macro(const MACROTABLE *mt, STRVIEW name, int line) {
+    if (!mt->index) return NULL;
+    int i = mt->index[macro_slot(mt, name.ptr, name.len, macro_hash(name.ptr, name.len))] - 1;
+    while (i >= 0 && mt->macros[i].line >= line)
+        i = mt->macros[i].prev;
+    return i >= 0 && mt->macros[i].kind != MACRO_UNDEF ? &mt->macros[i] : NULL;
+}
+
+// Record a definition of name on a line; it becomes the newest of the name
+static MACRO* add_macro(MACROTABLE *mt, STRVIEW name, int line, MacroKind kind) {
+    if (!mt->index || (unsigned int)(mt->count + 1) * 2 > mt->index_mask + 1) {
+        unsigned int size = mt->index ? (mt->index_mask + 1) * 2 : 256;
+        int *index = realloc(mt->index, size * sizeof(int));
+        if (!index) {
+            fprintf(stderr, "Out of memory growing macro table!\n");
+            exit(1);
+        }
+        memset(index, 0, size * sizeof(int));
+        mt->index = index;
+        mt->index_mask = size - 1;
+        for (int i = 0; i < mt->count; i++)   // Later definitions replace earlier ones
+            mt->index[macro_slot(mt, mt->macros[i].name.ptr, mt->macros[i].name.len, mt->macros[i].hash)] = i + 1;
+    }
+    mt->macros = macro_grow(mt->macros, mt->count, &mt->capacity, sizeof(MACRO));
+    MACRO *m = &mt->macros[mt->count];
+    memset(m, 0, sizeof(MACRO));
+    m->name = name;
+    m->hash = macro_hash(name.ptr, name.len);
+    m->line = line;
+    m->kind = kind;
+    unsigned int slot = macro_slot(mt, name.ptr, name.len, m->hash);
+    m->prev = mt->index[slot] - 1;
+    mt->index[slot] = ++mt->count;
+    return m;
+}
+
+// Set or test ch in a first-character bitmap
+static void mark_first(unsigned int *first, char ch) {
+    first[(unsigned char)ch >> 5] |= 1u << (ch & 31);
+}
+
+static int may_start_name(const unsigned int *first, char ch) {
+    return first[(unsigned char)ch >> 5] >> (ch & 31) & 1;
+}
+
+// The next identifier on a line that might be a %define'd name, skipping
+// numbers, strings and comments; { NULL, 0 } at the end. Cheaper than
+// next_token(), which would also look up registers and parse numbers.
+static STRVIEW next_define_name(const MACROTABLE *mt, const char **pos, const char *end) {
+    const char *p = *pos;
+    while (p < end) {
+        int cls = char_class[(unsigned char)*p];
+        if (cls == CC_COMMENT) break;
+        if (cls == CC_QUOTE) {
+            const char *close = memchr(p + 1, *p, end - p - 1);
+            p = close ? close + 1 : end;
+            continue;
+        }
+        if (cls != CC_IDENT && cls != CC_DIGIT) {
+            p++;
+            continue;
+        }
+        const char *start = p;
+        while (p < end && (char_class[(unsigned char)*p] == CC_IDENT || char_class[(unsigned char)*p] == CC_DIGIT))
+            p++;
+        if (cls == CC_IDENT && may_start_name(mt->define_first, *start)) {
+            *pos = p;
+            return (STRVIEW){ start, p - start };
+        }
+    }
+    *pos = end;
+    return (STRVIEW){ NULL, 0 };
+}
+
+// Replace the %define'd names on a line by their values. Returns text
+// itself when there are none, or the new line built in arena.
+static STRVIEW substitute_defines(ASSEMBLER *as, ARENA *arena, STRVIEW text, int line) {
+    const MACROTABLE *mt = &as->macros;
+    const char *end = text.ptr + text.len, *p = text.ptr;
+    struct { STRVIEW name; const MACRO *m; } hits[16];   // The first ones found
+    int found = 0;
+    size_t len = text.len;
+    for (STRVIEW name = next_define_name(mt, &p, end); name.ptr; name = next_define_name(mt, &p, end)) {
+        const MACRO *m = find_macro(mt, name, line);
+        if (m && m->kind == MACRO_DEFINE) {
+            if (found < 16) {
+                hits[found].name = name;
+                hits[found].m = m;
+            }
+            found++;
+            len += m->value.len - name.len;
+        }
+    }
+    if (!found) return text;
+    COUNT(define_substitutions, found);
+
+    // Copy the text between the names and their values in their place,
+    // scanning the line again only if there were more than hits holds
+    char *dest = arena_alloc(arena, len);
+    const char *copied = text.ptr;
+    int n = 0;
+    p = text.ptr;
+    for (int i = 0; i < found; i++) {
+        STRVIEW name = i < 16 ? hits[i].name : (STRVIEW){ NULL, 0 };
+        const MACRO *m = i < 16 ? hits[i].m : NULL;
+        if (i == 16) p = copied;
+        while (!m) {
+            name = next_define_name(mt, &p, end);
+            m = find_macro(mt, name, line);
+            if (m && m->kind != MACRO_DEFINE) m = NULL;
+        }
+        memcpy(dest + n, copied, name.ptr - copied);
+        n += name.ptr - copied;
+        memcpy(dest + n, m->value.ptr, m->value.len);
+        n += m->value.len;
+        copied = name.ptr + name.len;
+    }
+    memcpy(dest + n, copied, end - copied);
+    n += end - copied;
+    return (STRVIEW){ dest, n };
+}
+
+// Lex one body line of a %macro into pieces: runs of literal text around
+// %1..%N, %0 and %%label references. Quoted strings and comments are
+// kept as they are.
+static void add_body_line(ASSEMBLER *as, MACRO *m, STRVIEW text, int line) {
+    MACROTABLE *mt = &as->macros;
+    mt->lines = macro_grow(mt->lines, mt->line_count, &mt->line_capacity, sizeof(MACROLINE));
+    MACROLINE *ml = &mt->lines[mt->line_count++];
+    ml->first = mt->piece_count;
+    ml->count = 0;
+
+    const char *end = text.ptr + text.len, *literal = text.ptr;
+    LEXER lx = { text.ptr, end };
+    TOKEN tok;
+    for (;;) {
+        next_token(&lx, &tok);
+        int last = tok.kind == TOK_END;
+        MACROPIECE ref = { PIECE_TEXT, 0, 0, NULL };
+        const char *p = last ? end : tok.text.ptr + 1;
+        if (!last && (tok.kind != TOK_ERROR || tok.text.ptr[0] != '%'))
+            continue;
+        if (!last && p < end && *p == '%' && p + 1 < end && char_class[(unsigned char)p[1]] == CC_IDENT) {
+            ref.kind = PIECE_LOCAL;
+            ref.text = ++p;
+            while (p < end && (char_class[(unsigned char)*p] == CC_IDENT || char_class[(unsigned char)*p] == CC_DIGIT))
+                p++;
+            ref.len = p - ref.text;
+            m->has_locals = 1;
+        } else if (!last && p < end && char_class[(unsigned char)*p] == CC_DIGIT) {
+            int n = 0;
+            while (p < end && char_class[(unsigned char)*p] == CC_DIGIT && n <= m->params)
+                n = n * 10 + (*p++ - '0');
+            if (n > m->params) {
+                report_error(as, line, "macro '%.*s' has no parameter %d", m->name.len, m->name.ptr, n);
+                continue;
+            }
+            ref.kind = n ? PIECE_PARAM : PIECE_COUNT;
+            ref.param = (unsigned char)n;
+        } else if (!last) {
+            continue;
+        }
+
+        // The literal text before the reference (or the rest of the line)
+        const char *literal_end = last ? end : tok.text.ptr;
+        if (literal_end > literal) {
+            mt->pieces = macro_grow(mt->pieces, mt->piece_count, &mt->piece_capacity, sizeof(MACROPIECE));
+            mt->pieces[mt->piece_count++] = (MACROPIECE){ PIECE_TEXT, 0, (int)(literal_end - literal), literal };
+            ml->count++;
+        }
+        if (last) break;
+        mt->pieces = macro_grow(mt->pieces, mt->piece_count, &mt->piece_capacity, sizeof(MACROPIECE));
+        mt->pieces[mt->piece_count++] = ref;
+        ml->count++;
+        literal = lx.pos = p;
+    }
+}
+
+// The name after a %define, %undef or %macro, and the rest of the line
+// after it (comment dropped) in *rest
+static STRVIEW directive_name(STRVIEW line, STRVIEW word, STRVIEW *rest) {
+    LEXER lx = { word.ptr + word.len, line.ptr + line.len };
+    TOKEN tok;
+    next_token(&lx, &tok);
+    STRVIEW name = tok.kind == TOK_IDENT ? tok.text : (STRVIEW){ NULL, 0 };
+
+    const char *start = NULL, *end = NULL;
+    for (next_token(&lx, &tok); tok.kind != TOK_END; next_token(&lx, &tok)) {
+        if (!start) start = tok.kind == TOK_STRING ? tok.text.ptr - 1 : tok.text.ptr;
+        end = lx.pos;
+    }
+    *rest = start ? (STRVIEW){ start, (int)(end - start) } : (STRVIEW){ lx.pos, 0 };
+    return name;
+}
+
+// Collect one source directive for scan_macros(): definitions go into the
+// macro table and %macro and %rep blocks are recorded whole. *line is the
+// number of line on entry and of the line at the returned position after.
+static const char* scan_directive(ASSEMBLER *as, STRVIEW line, const char *next, const char *end, int *line_number) {
+    MACROTABLE *mt = &as->macros;
+    STRVIEW word = directive_word(line), rest;
+    int number = (*line_number)++;
+
+    if (view_equal(word, "define") || view_equal(word, "undef")) {
+        int define = view_equal(word, "define");
+        STRVIEW name = directive_name(line, word, &rest);
+        if (!name.ptr) {
+            report_error(as, number, "%%%.*s needs a name", word.len, word.ptr);
+            return next;
+        }
+        MACRO *m = add_macro(mt, name, number, define ? MACRO_DEFINE : MACRO_UNDEF);
+        if (define) {
+            // Expanded now, with the names defined so far
+            m->value = mt->defines ? substitute_defines(as, &as->arena, rest, number) : rest;
+            mt->defines = 1;
+            mark_first(mt->define_first, name.ptr[0]);
+        }
+        return next;
+    }
+
+    if (view_equal(word, "macro")) {
+        STRVIEW name = directive_name(line, word, &rest);
+        if (!name.ptr) {
+            report_error(as, number, "%%macro needs a name");
+            name = (STRVIEW){ "", 0 };
+        }
+        MACRO *m = add_macro(mt, name, number, MACRO_MULTI);
+        if (rest.len && (view_to_int(rest) < 0 || view_to_int(rest) > 255 ||
+                         char_class[(unsigned char)rest.ptr[0]] != CC_DIGIT))
+            report_error(as, number, "%%macro takes 0 to 255 parameters, not '%.*s'", rest.len, rest.ptr);
+        else
+            m->params = rest.len ? view_to_int(rest) : 0;
+        m->first_line = mt->line_count;
+        mt->multi = 1;
+        mark_first(mt->macro_first, name.len ? name.ptr[0] : 0);
+
+        const char *block = line.ptr, *p = next;
+        int closed = 0;
+        while (p < end && !closed) {
+            STRVIEW body = next_source_line(p, end, &p);
+            STRVIEW inner = directive_word(view_trim(body));
+            int body_line = (*line_number)++;
+            if (view_equal(inner, "endmacro")) {
+                closed = 1;
+            } else if (view_equal(inner, "macro") || view_equal(inner, "define") || view_equal(inner, "undef")) {
+                report_error(as, body_line, "%%%.*s inside %%macro is not supported", inner.len, inner.ptr);
+            } else {
+                mt->sections |= section_directive(view_trim(body)) != SEC_NONE;
+                add_body_line(as, m, body, body_line);
+            }
+        }
+        if (!closed)
+            report_error(as, number, "%%macro %.*s has no %%endmacro", name.len, name.ptr);
+        m->line_count = mt->line_count - m->first_line;
+        while (block > as->source && block[-1] != '\n') block--;
+        mt->blocks = macro_grow(mt->blocks, mt->block_count, &mt->block_capacity, sizeof(MACROBLOCK));
+        mt->blocks[mt->block_count++] = (MACROBLOCK){ block, p };
+        return p;
+    }
+
+    if (view_equal(word, "rep")) {
+        // Expanded in pass 1; only its extent and what it may not hold are checked here
+        const char *block = line.ptr, *p = next;
+        int nesting = 0;
+        while (p < end) {
+            STRVIEW body = next_source_line(p, end, &p);
+            STRVIEW inner = directive_word(view_trim(body));
+            int body_line = (*line_number)++;
+            if (view_equal(inner, "rep")) {
+                nesting++;
+            } else if (view_equal(inner, "endrep")) {
+                if (nesting-- == 0) break;
+            } else if (view_equal(inner, "macro") || view_equal(inner, "endmacro") ||
+                       view_equal(inner, "define") || view_equal(inner, "undef")) {
+                report_error(as, body_line, "%%%.*s inside %%rep is not supported", inner.len, inner.ptr);
+            } else {
+                mt->sections |= section_directive(view_trim(body)) != SEC_NONE;
+            }
+        }
+        while (block > as->source && block[-1] != '\n') block--;
+        mt->blocks = macro_grow(mt->blocks, mt->block_count, &mt->block_capacity, sizeof(MACROBLOCK));
+        mt->blocks[mt->block_count++] = (MACROBLOCK){ block, p };
+        return p;
+    }
+
+    if (view_equal(word, "endmacro"))
+        report_error(as, number, "%%endmacro without %%macro");
+    return next;
+}
+
+// Before pass 1: collect the %define and %macro definitions of the source,
+// in order, so that chunks parsed in parallel all see them. Only lines
+// starting with '%' are looked at; a source without any costs one memchr().
+void scan_macros(ASSEMBLER *as) {
+    MACROTABLE *mt = &as->macros;
+    mt->count = mt->piece_count = mt->line_count = mt->block_count = 0;
+    mt->active = mt->defines = mt->multi = mt->sections = 0;
+    memset(mt->define_first, 0, sizeof(mt->define_first));
+    memset(mt->macro_first, 0, sizeof(mt->macro_first));
+    if (mt->index)
+        memset(mt->index, 0, (mt->index_mask + 1) * sizeof(int));
+
+    long long start = preprocess_clock(as);
+    const char *source = as->source, *end = source + as->source_size;
+    const char *counted = source;    // Start of line number `line`
+    int line = 1;
+    for (const char *p = source; p < end && (p = memchr(p, '%', end - p)) != NULL; ) {
+        const char *line_start = p;
+        while (line_start > counted && line_start[-1] != '\n') line_start--;
+        const char *next;
+        STRVIEW text = next_source_line(line_start, end, &next);
+        STRVIEW trimmed = view_trim(text);
+        if (trimmed.ptr != p) {      // Not at the start of its line
+            p = next;
+            continue;
+        }
+        for (const char *n = counted; (n = memchr(n, '\n', line_start - n)) != NULL; n++)
+            line++;
+        mt->active = 1;
+        p = counted = scan_directive(as, trimmed, next, end, &line);
+    }
+    COUNT(preprocess_ns, preprocess_clock(as) - start);
+}
+
+// Move a pass-1 chunk boundary out of a %macro or %rep block
+static const char* macro_safe_split(const MACROTABLE *mt, const char *split) {
+    int lo = 0, hi = mt->block_count;
+    while (lo < hi) {           // First block ending after split
+        int mid = (lo + hi) / 2;
+        if (mt->blocks[mid].end <= split) lo = mid + 1;
+        else hi = mid;
+    }
+    if (lo < mt->block_count && mt->blocks[lo].start < split)
+        return mt->blocks[lo].end;
+    return split;
+}
+
+static void grow_expansions(EXPANSIONS *x) {
+    unsigned int size = x->slots ? (x->mask + 1) * 2 : 256;
+    EXPANSION *slots = arena_alloc(&x->arena, size * sizeof(EXPANSION));
+    memset(slots, 0, size * sizeof(EXPANSION));
+    for (unsigned int i = 0; x->slots && i <= x->mask; i++) {
+        if (!x->slots[i].hash) continue;
+        unsigned int slot = x->slots[i].hash & (size - 1);
+        while (slots[slot].hash) slot = (slot + 1) & (size - 1);
+        slots[slot] = x->slots[i];
+    }
+    x->slots = slots;
+    x->mask = size - 1;
+}
+
+// The number of the next expansion with %%labels made by a source line.
+// Counting per line, rather than from the last line, keeps labels unique
+// when %rep revisits the line; a line is parsed by one worker only, so the
+// numbers are the same for any -j.
+static int next_local_seq(EXPANSIONS *x, int line) {
+    if ((unsigned int)(x->local_count + 1) * 2 > x->local_mask + 1) {
+        unsigned int size = x->local_lines ? (x->local_mask + 1) * 2 : 64;
+        int *lines = arena_alloc(&x->arena, size * sizeof(int));
+        int *seqs = arena_alloc(&x->arena, size * sizeof(int));
+        memset(lines, 0, size * sizeof(int));
+        for (unsigned int i = 0; x->local_lines && i <= x->local_mask; i++) {
+            if (!x->local_lines[i]) continue;
+            unsigned int slot = (unsigned int)x->local_lines[i] * 2654435761u & (size - 1);
+            while (lines[slot]) slot = (slot + 1) & (size - 1);
+            lines[slot] = x->local_lines[i];
+            seqs[slot] = x->local_seqs[i];
+        }
+        x->local_lines = lines;
+        x->local_seqs = seqs;
+        x->local_mask = size - 1;
+    }
+    unsigned int slot = (unsigned int)line * 2654435761u & x->local_mask;
+    while (x->local_lines[slot] && x->local_lines[slot] != line)
+        slot = (slot + 1) & x->local_mask;
+    if (!x->local_lines[slot]) {
+        x->local_lines[slot] = line;
+        x->local_seqs[slot] = 0;
+        x->local_count++;
+    }
+    return x->local_seqs[slot]++;
+}
+
+// The body of macro m with these arguments, as lines each ending in '\n'.
+// An expansion is kept per (macro, arguments), so invoking a macro again
+// with the same arguments reuses it; one with %%labels is built each time.
+static const char* macro_expansion(CHUNK *c, const MACRO *m, const STRVIEW *args, int argc, int line, int *len) {
+    const MACROTABLE *mt = &c->as->macros;
+    EXPANSIONS *x = c->expansions;
+    int index = (int)(m - mt->macros);
+    long long start = preprocess_clock(c->as);
+    COUNT(macro_expansions, 1);
+
+    EXPANSION *slot = NULL;
+    unsigned int hash = 0;
+    if (!m->has_locals) {
+        hash = 2166136261u ^ (unsigned int)index;
+        for (int i = 0; i < argc; i++) {
+            for (int j = 0; j < args[i].len; j++)
+                hash = (hash ^ (unsigned char)args[i].ptr[j]) * 16777619u;
+            hash = (hash ^ ',') * 16777619u;
+        }
+        hash |= 1;
+
+        if (!x->slots || (unsigned int)(x->count + 1) * 4 > (x->mask + 1) * 3)
+            grow_expansions(x);
+        unsigned int i = hash & x->mask;
+        for (; x->slots[i].hash; i = (i + 1) & x->mask) {
+            EXPANSION *e = &x->slots[i];
+            int same = e->hash == hash && e->macro == index && e->argc == argc;
+            for (int a = 0; same && a < argc; a++)
+                same = e->args[a].len == args[a].len && memcmp(e->args[a].ptr, args[a].ptr, args[a].len) == 0;
+            if (same) {
+                COUNT(macro_cached, 1);
+                COUNT(preprocess_ns, preprocess_clock(c->as) - start);
+                *len = e->len;
+                return e->text;
+            }
+        }
+        slot = &x->slots[i];
+    }
+
+    // %%name becomes ..@<line>.<n>.name, n counting expansions on the line
+    char prefix[32];
+    int prefix_len = 0;
+    if (m->has_locals)
+        prefix_len = snprintf(prefix, sizeof(prefix), "..@%d.%d.", line, next_local_seq(x, line));
+
+    size_t size = 0;
+    const MACROLINE *lines = mt->lines + m->first_line;
+    for (int l = 0; l < m->line_count; l++) {
+        for (int i = 0; i < lines[l].count; i++) {
+            const MACROPIECE *piece = &mt->pieces[lines[l].first + i];
+            size += piece->kind == PIECE_PARAM ? (size_t)args[piece->param - 1].len :
+                    piece->kind == PIECE_COUNT ? 3 :
+                    piece->kind == PIECE_LOCAL ? (size_t)(prefix_len + piece->len) : (size_t)piece->len;
+        }
+        size++;
+    }
+
+    char *text = arena_alloc(&x->arena, size), *d = text;
+    for (int l = 0; l < m->line_count; l++) {
+        for (int i = 0; i < lines[l].count; i++) {
+            const MACROPIECE *piece = &mt->pieces[lines[l].first + i];
+            switch (piece->kind) {
+                case PIECE_PARAM:
+                    memcpy(d, args[piece->param - 1].ptr, args[piece->param - 1].len);
+                    d += args[piece->param - 1].len;
+                    break;
+                case PIECE_COUNT:
+                    d += snprintf(d, 4, "%d", argc);
+                    break;
+                case PIECE_LOCAL:
+                    memcpy(d, prefix, prefix_len);
+                    memcpy(d + prefix_len, piece->text, piece->len);
+                    d += prefix_len + piece->len;
+                    break;
+                default:
+                    memcpy(d, piece->text, piece->len);
+                    d += piece->len;
+                    break;
+            }
+        }
+        *d++ = '\n';
+    }
+    *len = (int)(d - text);
+
+    if (slot) {
+        STRVIEW *kept = arena_alloc(&x->arena, argc * sizeof(STRVIEW) + 1);
+        memcpy(kept, args, argc * sizeof(STRVIEW));
+        *slot = (EXPANSION){ hash, index, argc, kept, text, *len };
+        x->count++;
+    }
+    COUNT(preprocess_ns, preprocess_clock(c->as) - start);
+    return text;
+}
+
+static void parse_text(CHUNK *c, STRVIEW text, int depth);
+static const char* parse_line(CHUNK *c, const char *pos, const char *end);
+static const char* preprocess_directive(CHUNK *c, STRVIEW text, const char *next, const char *end, int depth,
+                                        int fixed);
+
+// Parse the lines of an expansion [pos, end), all numbered as the line
+// that invoked it
+static void parse_expansion(CHUNK *c, const char *pos, const char *end, int line, int depth) {
+    while (pos < end) {
+        STRVIEW text = next_source_line(pos, end, &pos);
+        STRVIEW trimmed = view_trim(text);
+        c->line = line;
+        COUNT(expanded_lines, 1);
+        if (trimmed.len && trimmed.ptr[0] == '%')
+            pos = preprocess_directive(c, text, pos, end, depth, line);
+        else
+            parse_text(c, text, depth);
+    }
+}
+
+// If line invokes a %macro, list it and parse the macro's body with the
+// arguments in place. Returns 0 if it is not an invocation.
+static int expand_invocation(CHUNK *c, STRVIEW text, STRVIEW line, int depth) {
+    if (!may_start_name(c->as->macros.macro_first, line.ptr[0]))
+        return 0;
+    LEXER lx = { line.ptr, line.ptr + line.len };
+    TOKEN tok;
+    next_token(&lx, &tok);
+    const MACRO *m = tok.kind == TOK_IDENT ? find_macro(&c->as->macros, tok.text, c->line) : NULL;
+    if (!m || m->kind != MACRO_MULTI)
+        return 0;
+    STRVIEW name = tok.text;
+    next_token(&lx, &tok);
+    if (tok.kind == TOK_COLON)       // A label of the same name
+        return 0;
+
+    // Comma-separated arguments, each the text of its tokens
+    STRVIEW args[m->params + 1];
+    int argc = 0;
+    const char *arg = NULL, *arg_end = NULL;
+    for (; tok.kind != TOK_END; next_token(&lx, &tok)) {
+        if (tok.kind == TOK_COMMA) {
+            if (argc < m->params) args[argc] = arg ? (STRVIEW){ arg, (int)(arg_end - arg) } : (STRVIEW){ "", 0 };
+            argc++;
+            arg = NULL;
+        } else {
+            if (!arg) arg = tok.kind == TOK_STRING ? tok.text.ptr - 1 : tok.text.ptr;
+            arg_end = lx.pos;
+        }
+    }
+    if (arg || argc > 0) {
+        if (argc < m->params) args[argc] = arg ? (STRVIEW){ arg, (int)(arg_end - arg) } : (STRVIEW){ "", 0 };
+        argc++;
+    }
+
+    int number = c->line;
+    new_ir_node(c, IR_TEXT, text);
+    if (argc != m->params) {
+        report_error(c->as, number, "macro '%.*s' takes %d argument%s, not %d", name.len, name.ptr, m->params,
+                     m->params == 1 ? "" : "s", argc);
+    } else if (depth >= MAX_MACRO_DEPTH) {
+        report_error(c->as, number, "macro '%.*s' nested more than %d deep", name.len, name.ptr, MAX_MACRO_DEPTH);
+    } else {
+        int len;
+        const char *body = macro_expansion(c, m, args, argc, number, &len);
+        parse_expansion(c, body, body + len, number, depth + 1);
+    }
+    return 1;
+}
+
+// A line starting with '%'. Definitions were taken by scan_macros() and
+// are only listed here; %rep parses its body count times. fixed is the
+// line number of an expansion being parsed, 0 in the source. Returns the
+// position after the directive (after %endrep or %endmacro for blocks).
+static const char* preprocess_directive(CHUNK *c, STRVIEW text, const char *next, const char *end, int depth,
+                                        int fixed) {
+    ASSEMBLER *as = c->as;
+    int number = c->line;
+    STRVIEW line = view_trim(text);
+    STRVIEW word = directive_word(line);
+
+    if (view_equal(word, "rep")) {
+        // Find the matching %endrep
+        const char *body = next, *body_end = end, *after = end;
+        STRVIEW closing = { NULL, 0 };
+        int nesting = 0, body_lines = 0;
+        for (const char *p = next; p < end && !closing.ptr; ) {
+            const char *start = p;
+            STRVIEW inner = next_source_line(p, end, &p);
+            STRVIEW w = directive_word(view_trim(inner));
+            if (view_equal(w, "rep")) {
+                nesting++;
+            } else if (view_equal(w, "endrep") && nesting-- == 0) {
+                closing = inner;
+                body_end = start;
+                after = p;
+                break;
+            }
+            body_lines++;
+        }
+
+        STRVIEW field = view_trim((STRVIEW){ word.ptr + word.len, (int)(line.ptr + line.len - word.ptr - word.len) });
+        const char *comment = memchr(field.ptr, ';', field.len);
+        if (comment) field = view_trim((STRVIEW){ field.ptr, (int)(comment - field.ptr) });
+        if (as->macros.defines)
+            field = substitute_defines(as, &c->expansions->arena, field, number);
+        unsigned long long count;
+        int negative;
+        if (parse_data_number(field.ptr, field.ptr + field.len, &count, &negative) != field.ptr + field.len ||
+            field.len == 0 || negative || count > 0xFFFFFFFFull) {
+            report_error(as, number, "%%rep needs a constant count, not '%.*s'", field.len, field.ptr);
+            count = 0;
+        }
+        if (!closing.ptr)
+            report_error(as, number, "%%rep without %%endrep");
+
+        new_ir_node(c, IR_TEXT, text);
+        if (depth >= MAX_MACRO_DEPTH) {
+            report_error(as, number, "%%rep nested more than %d deep", MAX_MACRO_DEPTH);
+            count = 0;
+        }
+        for (unsigned long long i = 0; i < count; i++) {
+            if (fixed) {
+                parse_expansion(c, body, body_end, fixed, depth + 1);
+            } else {
+                c->line = number + 1;
+                for (const char *p = body; p < body_end; )
+                    p = parse_line(c, p, body_end);
+            }
+        }
+        if (!fixed)
+            COUNT(expanded_lines, (long)count * body_lines);
+        c->line = fixed ? fixed : number + 1 + body_lines;
+        if (closing.ptr)
+            new_ir_node(c, IR_TEXT, closing);
+        return after;
+    }
+
+    if (view_equal(word, "macro") && !fixed) {
+        // Listed through its %endmacro
+        new_ir_node(c, IR_TEXT, text);
+        const char *p = next;
+        while (p < end) {
+            STRVIEW inner = next_source_line(p, end, &p);
+            new_ir_node(c, IR_TEXT, inner);
+            if (view_equal(directive_word(view_trim(inner)), "endmacro"))
+                break;
+        }
+        return p;
+    }
+
+    if (fixed && (view_equal(word, "macro") || view_equal(word, "define") || view_equal(word, "undef"))) {
+        report_error(as, number, "%%%.*s inside a macro is not supported", word.len, word.ptr);
+    } else if (view_equal(word, "endrep")) {
+        report_error(as, number, "%%endrep without %%rep");
+    } else if (!view_equal(word, "define") && !view_equal(word, "undef") && !view_equal(word, "endmacro") &&
+               !view_equal(word, "macro")) {
+        report_error(as, number, "unknown directive '%%%.*s'", word.len, word.ptr);
+    }
+    new_ir_node(c, IR_TEXT, text);
+    return next;
+}
+
+// Parse the line at pos into an IR node, recording any symbols and giving
+// an instruction its chunk-relative address and size. Returns the start of
+// the next line.
+static const char* parse_line(CHUNK *c, const char *pos, const char *end) {
+    const char *next_line;
+    STRVIEW text = next_source_line(pos, end, &next_line);
+    STRVIEW line = view_trim(text);
+    if (line.len && line.ptr[0] == '%')
+        return preprocess_directive(c, text, next_line, end, 0, 0);
+
+    int number = c->line;
+    parse_text(c, text, 0);
+    c->line = number + 1;     // However many nodes a macro made
+    return next_line;
+}
+
+// Length of a text line without its comment, and in *colon the first ':'
+// before it (NULL if none). Quoted text is skipped as next_token() skips
+// it, so ';' and ':' character constants are neither comments nor labels.
+static int code_length(STRVIEW line, const char **colon) {
+    const char *p = line.ptr, *end = line.ptr + line.len;
+    *colon = NULL;
+    while (p < end) {
+        int cls = char_class[(unsigned char)*p];
+        if (cls == CC_COMMENT) break;
+        if (cls == CC_QUOTE) {
+            const char *close = memchr(p + 1, *p, end - p - 1);
+            p = close ? close + 1 : end;
+            continue;
+        }
+        if (*p == ':' && !*colon) *colon = p;
+        p++;
+    }
+    return (int)(p - line.ptr);
+}
+
+// Parse one line of source or of a macro expansion (depth: expansions it
+// is nested in) at line number c->line
+static void parse_text(CHUNK *c, STRVIEW text, int depth) {
+    const MACROTABLE *mt = &c->as->macros;
+    if (mt->defines) {
+        long long start = preprocess_clock(c->as);
+        text = substitute_defines(c->as, &c->expansions->arena, text, c->line);
+        COUNT(preprocess_ns, preprocess_clock(c->as) - start);
+    }
+    STRVIEW line = view_trim(text);
+
+    // Skip empty lines
+    if (line.len == 0) {
+        new_ir_node(c, IR_BLANK, text);
+        return;
+    }
+    if (mt->multi && expand_invocation(c, text, line, depth))
+        return;
+
+    // Each section keeps its own location counter
+    Section next = section_directive(line);
+    if (next != SEC_NONE) {
+        c->section = next;
+        new_ir_node(c, IR_TEXT, text);
+        return;
+    }
+
+    switch (c->section) {
+        case SEC_DATA: { 
+            IRNODE *node = new_ir_node(c, IR_DATA, text);
+            process_data_line(c, line, node);
+            break;
+        }
+        case SEC_BSS: { 
+            IRNODE *node = new_ir_node(c, IR_TEXT, text);
+            process_bss_line(c, line);
+            node->size = c->address[SEC_BSS] - node->address;
+            break;
+        }
+        case SEC_TEXT: {
+            // Drop trailing comments so they are not taken for labels
+            const char *colon;
+            line.len = code_length(line, &colon);
+            line = view_trim(line);
+            if (line.len == 0) {
+                new_ir_node(c, IR_TEXT, text);
+                return;
+            }
+
+            // Parse global/extern directives: add the symbols (global ones
+            // are not yet defined)
+            if (view_starts_with(line, "global")) {
+                add_symbol_list(c, (STRVIEW){ line.ptr + 6, line.len - 6 }, SYM_GLOBAL, c->section);
+                new_ir_node(c, IR_TEXT, text);
+                return;
+            }
+            if (view_starts_with(line, "extern")) {
+                add_symbol_list(c, (STRVIEW){ line.ptr + 6, line.len - 6 }, SYM_EXTERN, SEC_NONE);
+                new_ir_node(c, IR_TEXT, text);
+                return;
+            }
+
+            // Check if it's a label (ends with ':'); it is linked to this
+            // line's IR node
+            STRVIEW label = { NULL, 0 };
+            if (colon != NULL) {
+                label = view_trim((STRVIEW){ line.ptr, (int)(colon - line.ptr) });
+                chunk_symbol(c, label, c->address[SEC_TEXT], SYM_LABEL, c->section, 0, 1, c->ir_count);
+                
+                // Check if there's code after the label
+                line = view_trim((STRVIEW){ colon + 1, (int)(line.ptr + line.len - colon - 1) });
+                if (line.len == 0) {
+                    new_ir_node(c, IR_LABEL, text);
+                    break;
+                }
+            }
+
+            // It's a regular instruction - process it. With a times
+            // prefix it is encoded once and repeated in the output, so it
+            // must not depend on its address.
+            STRVIEW times = split_times(&line);
+            IRNODE *node = new_ir_node(c, IR_TEXT, text);
+            if (!assemble_memoized(c, line, node))
+                break;
+            unsigned int count = times.ptr ? times_count(c->as, times, node->line) : 1;
+            if (count > 1 && !cache_encodable(node)) {
+                report_error(c->as, node->line, "times cannot repeat a branch or a symbol reference");
+                count = 1;
+            }
+            c->address[SEC_TEXT] += repeat_node(c, node, count);
+            break;				      
+        }
+        default:
+            new_ir_node(c, IR_TEXT, text);
+            break;
+    }
+}
+
+// Append a run of cache entries, extending the last one when contiguous
+static void add_piece(PIECELIST *list, const unsigned char *mapped, size_t offset, size_t size) {
+    if (list->count > 0) {
+        CACHEPIECE *last = &list->items[list->count - 1];
+        if (mapped ? last->mapped && last->mapped + last->size == mapped
+                   : !last->mapped && last->offset + last->size == offset) {
+            last->size += size;
+            return;
+        }
+    }
+    if (list->count == list->capacity) {
+        int capacity = list->capacity ? list->capacity * 2 : 64;
+        CACHEPIECE *grown = realloc(list->items, capacity * sizeof(CACHEPIECE));
+        if (!grown) {
+            fprintf(stderr, "Out of memory growing cache!\n");
+            exit(1);
+        }
+        list->items = grown;
+        list->capacity = capacity;
+    }
+    list->items[list->count++] = (CACHEPIECE){ mapped, offset, size };
+}
+
+// FNV-1a (64-bit) of a block of source text
+static unsigned long long block_hash(const char *text, size_t len) {
+    unsigned long long h = 14695981039346656037ull;
+    for (size_t i = 0; i < len; i++) {
+        h ^= (unsigned char)text[i];
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+// Second hash of a block, independent of block_hash(): a word at a time,
+// multiply-rotate mixing and a MurmurHash3 finish. A stale entry is only
+// replayed if both 64-bit hashes of a different text collide.
+static unsigned long long block_check(const char *text, size_t len) {
+    unsigned long long h = len * 0x9E3779B97F4A7C15ull;
+    for (size_t i = 0; i < len; i += 8) {
+        unsigned long long word = 0;
+        memcpy(&word, text + i, len - i < 8 ? len - i : 8);
+        h ^= word * 0x87C37B91114253D5ull;
+        h = (h << 31 | h >> 33) * 0x4CF5AD432745937Full;
+    }
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    return h ^ h >> 33;
+}
+
+// End of the cache block that starts at pos: before the next line that
+// defines a label (a ':' ahead of any ';'), after CACHE_BLOCK_LINES lines,
+// or at end. Blocks start at labels so an edit only changes its own block.
+static const char* find_block_end(const char *pos, const char *end, int *lines) {
+    int n = 0;
+    while (pos < end && n < CACHE_BLOCK_LINES) {
+        const char *newline = memchr(pos, '\n', end - pos);
+        const char *line_end = newline ? newline : end;
+        if (n > 0) {
+            const char *colon = memchr(pos, ':', line_end - pos);
+            if (colon && !memchr(pos, ';', colon - pos))
+                break;
+        }
+        n++;
+        pos = newline ? newline + 1 : end;
+    }
+    *lines = n;
+    return pos;
+}
+
+// The entry for a block of text_len bytes at text with the given
+// block_hash(); block_check() is only computed when an entry matches that
+static const CACHEENTRY* cache_find(const BLOCKCACHE *cache, unsigned long long hash, const char *text,
+                                    int text_len, Section section) {
+    if (!cache->index) return NULL;
+
+    unsigned int slot = (unsigned int)hash & cache->index_mask;
+    for (const CACHEENTRY *e; (e = cache->index[slot]) != NULL; slot = (slot + 1) & cache->index_mask) {
+        if (e->hash == hash && e->text_len == (unsigned int)text_len && e->section == section)
+            return e->hash2 == block_check(text, text_len) ? e : NULL;
+    }
+    return NULL;
+}
+
+// Parts of an entry, each 8-byte aligned after the one before
+static const CACHENODE* entry_nodes(const CACHEENTRY *e) {
+    return (const CACHENODE *)(e + 1);
+}
+
+static const CACHESYM* entry_syms(const CACHEENTRY *e) {
+    return (const CACHESYM *)((const char *)entry_nodes(e) + align_up(e->node_count * sizeof(CACHENODE), 8));
+}
+
+static const OPERAND* entry_operands(const CACHEENTRY *e) {
+    return (const OPERAND *)((const char *)entry_syms(e) + align_up(e->sym_count * sizeof(CACHESYM), 8));
+}
+
+static const unsigned char* entry_bytes(const CACHEENTRY *e) {
+    return (const unsigned char *)(entry_operands(e) + 2 * e->operand_count);
+}
+
+// Checksum of an entry: everything but the check itself, a word at a time.
+// Entries need not be 8-byte aligned in the file.
+static unsigned int entry_check(const CACHEENTRY *e) {
+    const unsigned char *p = (const unsigned char *)e;
+    unsigned long long h = 14695981039346656037ull;
+    for (size_t i = 0; i < offsetof(CACHEENTRY, check); i++)
+        h = (h ^ p[i]) * 1099511628211ull;
+    for (size_t i = sizeof(CACHEENTRY); i < e->size; i += 8) {
+        unsigned long long word;
+        memcpy(&word, p + i, 8);
+        h = (h ^ word) * 1099511628211ull;
+    }
+    return (unsigned int)(h ^ h >> 32);
+}
+
+// Instructions whose bytes depend on neither symbols nor their address
+// are cached encoded; pass 2 copies them instead of encoding
+static int cache_encodable(const IRNODE *node) {
+    if (node->op1.sym.len || node->op2.sym.len) return 0;
+    return !(node->type == OPT_I && branch_rel_size(node->opcode));
+}
+
+// Operand symbol views are stored as offsets into the block text
+static OPERAND operand_to_cache(OPERAND op, const char *text) {
+    if (op.sym.len) op.sym.ptr = (const char *)(size_t)(op.sym.ptr - text);
+    return op;
+}
+
+static OPERAND operand_from_cache(OPERAND op, const char *text) {
+    if (op.sym.len) op.sym.ptr = text + (size_t)op.sym.ptr;
+    return op;
+}
+
+// An operand read from the cache: register ids and the scale in range, and
+// the symbol within the block text of text_len bytes
+static int valid_cached_operand(const OPERAND *op, unsigned int text_len) {
+    if (op->sym.len < 0 || (op->sym.len > 0 && ((size_t)op->sym.ptr > text_len ||
+                                                 (size_t)op->sym.len > text_len - (size_t)op->sym.ptr)))
+        return 0;
+    if (op->kind == OPD_REG)
+        return op->reg >= 0 && op->reg < 8;
+    if (op->kind == OPD_MEM)
+        return op->mem.base >= -1 && op->mem.base < 8 && op->mem.index >= -1 && op->mem.index < 8 &&
+               (op->mem.scale == 1 || op->mem.scale == 2 || op->mem.scale == 4 || op->mem.scale == 8);
+    return op->kind <= OPD_SYM;
+}
+
+// Check everything replay_block() and pass 2 take from an entry without
+// looking at the block text: the parts add up to the entry's size and its
+// checksum matches, the sections, kinds and opcodes exist, instructions have the size their
+// operands encode to, and symbols point into the text and at its nodes.
+static int valid_entry(ASSEMBLER *as, const CACHEENTRY *e) {
+    size_t size = sizeof(CACHEENTRY) + align_up((size_t)e->node_count * sizeof(CACHENODE), 8) +
+                  align_up((size_t)e->sym_count * sizeof(CACHESYM), 8) +
+                  2 * (size_t)e->operand_count * sizeof(OPERAND) + align_up(e->byte_count, 8);
+    if (size != e->size || e->check != entry_check(e) || e->section >= SEC_COUNT ||
+        e->node_count > e->text_len + 1)
+        return 0;
+
+    const CACHENODE *cn = entry_nodes(e);
+    const OPERAND *ops = entry_operands(e);
+    unsigned int operands = 0, bytes = 0;
+    for (unsigned int i = 0; i < e->node_count; i++, cn++) {
+        if (cn->section >= SEC_COUNT || cn->kind > IR_DATA)
+            return 0;
+        if (cn->kind == IR_DATA) {
+            if (cn->section != SEC_DATA) return 0;
+            continue;                   // Sized against the text by entry_fits_text()
+        }
+        if (cn->kind != IR_INSN) {
+            if (cn->size && cn->section != SEC_BSS) return 0;
+            continue;
+        }
+
+        IRNODE node = {0};
+        node.section = SEC_TEXT;
+        node.type = cn->type;
+        node.opcode = opcode_by_id(cn->opcode);
+        if (cn->section != SEC_TEXT || !node.opcode || cn->type >= OPT_INVALID ||
+            strcmp(node.opcode->type, operand_type_name[cn->type]) != 0 || cn->size > MAX_INSN_LEN)
+            return 0;
+        if (cn->encoded) {
+            bytes += cn->size;
+            continue;
+        }
+        if (++operands > e->operand_count)
+            return 0;
+        node.op1 = *ops++;
+        node.op2 = *ops++;
+        if (!valid_cached_operand(&node.op1, e->text_len) || !valid_cached_operand(&node.op2, e->text_len) ||
+            operand_type(&node.op1, &node.op2) != cn->type)
+            return 0;
+        if ((cn->type == OPT_R && node.opcode->ext < 0 && !is_plus_r_opcode(node.opcode)) ||
+            ((cn->type == OPT_M || cn->type == OPT_MI) && node.opcode->ext < 0))
+            return 0;
+
+        // Sized as in pass 1, before any symbol is known
+        if (node.op1.sym.len) node.op1.sym = (STRVIEW){ "?", 1 };
+        if (node.op2.sym.len) node.op2.sym = (STRVIEW){ "?", 1 };
+        unsigned char machine[MAX_INSN_LEN];
+        if ((unsigned int)encode_instruction(as, &node, machine, NULL) != cn->size)
+            return 0;
+    }
+    if (operands != e->operand_count || bytes != e->byte_count)
+        return 0;
+
+    const CACHESYM *cs = entry_syms(e);
+    for (unsigned int i = 0; i < e->sym_count; i++, cs++) {
+        if (cs->section >= SEC_COUNT || cs->type > SYM_GLOBAL || cs->name_len <= 0 || cs->name > e->text_len ||
+            (unsigned int)cs->name_len > e->text_len - cs->name || cs->node < -1 ||
+            cs->node >= (int)e->node_count)
+            return 0;
+    }
+    return 1;
+}
+
+// What valid_entry() cannot check without the block: one node per line,
+// and each data line the size its values take
+static int entry_fits_text(ASSEMBLER *as, const CACHEENTRY *e, const char *text, const char *end, int lines) {
+    if (e->node_count != (unsigned int)lines)
+        return 0;
+    const CACHENODE *cn = entry_nodes(e);
+    const char *pos = text;
+    for (unsigned int i = 0; i < e->node_count; i++, cn++) {
+        const char *newline = memchr(pos, '\n', end - pos);
+        STRVIEW line = { pos, (int)((newline ? newline : end) - pos) };
+        pos = newline ? newline + 1 : end;
+        if (cn->kind != IR_DATA)
+            continue;
+
+        STRVIEW name, times, directive;
+        STRVIEW values = data_directive(view_trim(line), &name, &times, &directive);
+        int width = data_width(directive);
+        if (cn->size != (width ? emit_data(as, values, width, NULL, 0) : 0))   // times 1 at most
+            return 0;
+    }
+    return 1;
+}
+
+// Rebuild a block's IR nodes and symbols from its cache entry, exactly as
+// parse_line() would have produced them from text
+static void replay_block(CHUNK *c, const CACHEENTRY *e, const char *text, const char *end) {
+    const CACHENODE *cn = entry_nodes(e);
+    const CACHESYM *cs = entry_syms(e);
+    const OPERAND *ops = entry_operands(e);
+    const unsigned char *bytes = entry_bytes(e);
+    int first_node = c->ir_count;
+    unsigned int start[SEC_COUNT];
+    memcpy(start, c->address, sizeof(start));
+
+    const char *pos = text;
+    for (unsigned int i = 0; i < e->node_count; i++, cn++) {
+        const char *newline = memchr(pos, '\n', end - pos);
+        const char *line_end = newline ? newline : end;
+        STRVIEW line = { pos, (int)(line_end - pos) };
+        pos = newline ? newline + 1 : end;
+        if (line.len > 0 && line.ptr[line.len - 1] == '\r')
+            line.len--;
+
+        c->section = cn->section;
+        IRNODE *node = new_ir_node(c, cn->kind, line);
+        node->size = cn->size;
+        c->address[cn->section] += cn->size;
+        if (cn->kind != IR_INSN)
+            continue;
+
+        node->type = cn->type;
+        node->opcode = opcode_by_id(cn->opcode);
+        if (cn->encoded) {
+            node->bytes = bytes;
+            bytes += cn->size;
+        } else {
+            node->op1 = operand_from_cache(ops[0], text);
+            node->op2 = operand_from_cache(ops[1], text);
+            ops += 2;
+        }
+    }
+
+    for (unsigned int i = 0; i < e->sym_count; i++, cs++) {
+        STRVIEW name = { text + cs->name, cs->name_len };
+        unsigned int address = cs->defined ? cs->address + start[cs->section] : cs->address;
+        chunk_symbol(c, name, address, cs->type, cs->section, cs->size, cs->defined,
+                     cs->node >= 0 ? first_node + cs->node : -1);
+    }
+}
+
+// Append a cache entry for the block just parsed from text: nodes from
+// first_node and symbols from first_sym on, with start[] the section
+// counters at the block's first line
+static void store_block(CHUNK *c, unsigned long long hash, const char *text, int text_len, Section section,
+                        int first_node, int first_sym, const unsigned int *start) {
+    unsigned int node_count = c->ir_count - first_node;
+    unsigned int sym_count = c->sym_count - first_sym;
+    unsigned int operand_count = 0, byte_count = 0;
+
+    for (int i = first_node; i < c->ir_count; i++) {
+        const IRNODE *node = &c->ir[i];
+        if (node->kind != IR_INSN) continue;
+        if (cache_encodable(node)) byte_count += node->size;
+        else operand_count++;
+    }
+
+    size_t size = sizeof(CACHEENTRY) + align_up(node_count * sizeof(CACHENODE), 8) +
+                  align_up(sym_count * sizeof(CACHESYM), 8) + 2 * operand_count * sizeof(OPERAND) +
+                  align_up(byte_count, 8);
+    CACHEENTRY *e = (CACHEENTRY *)buffer_reserve(&c->cache_out, size, "cache");
+    memset(e, 0, size);
+    e->hash = hash;
+    e->hash2 = block_check(text, text_len);
+    e->text_len = text_len;
+    e->size = (unsigned int)size;
+    e->node_count = node_count;
+    e->sym_count = sym_count;
+    e->operand_count = operand_count;
+    e->byte_count = byte_count;
+    e->section = (unsigned char)section;
+
+    CACHENODE *cn = (CACHENODE *)entry_nodes(e);
+    OPERAND *ops = (OPERAND *)entry_operands(e);
+    unsigned char *bytes = (unsigned char *)entry_bytes(e);
+    for (int i = first_node; i < c->ir_count; i++, cn++) {
+        const IRNODE *node = &c->ir[i];
+        cn->kind = node->kind;
+        cn->section = node->section;
+        cn->size = node->size;
+        if (node->kind != IR_INSN) continue;
+
+        cn->type = node->type;
+        cn->opcode = opcode_id(node->opcode);
+        cn->encoded = (unsigned char)cache_encodable(node);
+        if (cn->encoded && node->bytes) {
+            memcpy(bytes, node->bytes, node->size);
+            bytes += node->size;
+        } else if (cn->encoded) {
+            bytes += encode_instruction(c->as, node, bytes, NULL);
+        } else {
+            *ops++ = operand_to_cache(node->op1, text);
+            *ops++ = operand_to_cache(node->op2, text);
+        }
+    }
+
+    CACHESYM *cs = (CACHESYM *)entry_syms(e);
+    for (int i = first_sym; i < c->sym_count; i++, cs++) {
+        const SYMEVENT *ev = &c->syms[i];
+        cs->name = (unsigned int)(ev->name.ptr - text);
+        cs->name_len = ev->name.len;
+        cs->address = ev->defined ? ev->address - start[ev->section] : ev->address;
+        cs->size = ev->size;
+        cs->node = ev->node >= 0 ? ev->node - first_node : -1;
+        cs->type = ev->type;
+        cs->section = ev->section;
+        cs->defined = ev->defined;
+    }
+
+    e->check = entry_check(e);
+    add_piece(&c->cache_pieces, NULL, c->cache_out.size, size);
+    c->cache_out.size += size;
+    c->cache_count++;
+}
+
+// Parse the block of lines at pos, or replay it from the cache when the
+// same text was assembled before in the same section. Returns the end of
+// the block.
+static const char* parse_block(CHUNK *c, const char *pos, const char *end) {
+    int lines;
+    const char *block_end = find_block_end(pos, end, &lines);
+    int text_len = (int)(block_end - pos);
+    unsigned long long hash = block_hash(pos, text_len);
+    const CACHEENTRY *e = cache_find(&c->as->cache, hash, pos, text_len, c->section);
+    if (e && !entry_fits_text(c->as, e, pos, block_end, lines))
+        e = NULL;
+
+    c->cache_blocks++;
+    c->cache_lines += lines;
+    if (e) {
+        replay_block(c, e, pos, block_end);
+        add_piece(&c->cache_pieces, (const unsigned char *)e, 0, e->size);
+        c->cache_count++;
+        c->cache_hits++;
+        c->cache_hit_lines += lines;
+        return block_end;
+    }
+
+    Section section = c->section;
+    int first_node = c->ir_count, first_sym = c->sym_count, first_ref = c->refs.count;
+    long errors = thread_errors;
+    unsigned int start[SEC_COUNT];
+    memcpy(start, c->address, sizeof(start));
+
+    for (const char *p = pos; p < block_end; )
+        p = parse_line(c, p, block_end);
+
+    // Blocks that recorded section refs are not cached: an incbin's size
+    // comes from its file, not the text, and entries have no place for
+    // the refs of times lines. Nor is a block with errors, so that they
+    // are reported again.
+    if (c->refs.count == first_ref && thread_errors == errors)
+        store_block(c, hash, pos, text_len, section, first_node, first_sym, start);
+    return block_end;
+}
+
+// Pass 1, step 2: parse every line of a chunk once, recording symbols and
+// giving each instruction a chunk-relative address and its size. With
+// --cache, lines go in blocks, and unchanged blocks are replayed.
+static void* parse_chunk(void *arg) {
+    CHUNK *c = arg;
+    const char *pos = c->start;
+    const char *end = c->end;
+
+    c->section = c->first_section;
+    c->line = c->first_line;
+
+    if (c->as->cache.dir && !c->as->macros.active) {
+        while (pos < end)
+            pos = parse_block(c, pos, end);
+    } else {
+        while (pos < end)
+            pos = parse_line(c, pos, end);
+    }
+    collect_counters(c->as);
+    return NULL;
+}
+
+// Pass 1, step 3: move a chunk's IR into place, rebasing its addresses by
+// the sizes of the chunks before it
+static void* merge_chunk(void *arg) {
+    CHUNK *c = arg;
+    ASSEMBLER *as = c->as;
+    IRNODE *dest = as->ir + c->ir_offset;
+
+    for (int i = 0; i < c->ir_count; i++) {
+        dest[i] = c->ir[i];
+        dest[i].address += c->base[dest[i].section];
+        dest[i].offset += c->base[dest[i].section] - c->referenced_base[dest[i].section];
+    }
+    return NULL;
+}
+
+// Cache file of an input: <dir>/<hash of the input path>.asmc
+static char* cache_path(const char *dir, const char *input) {
+    size_t len = strlen(dir) + 1 + 16 + 5 + 1;
+    char *path = malloc(len);
+    if (path)
+        snprintf(path, len, "%s/%016llx.asmc", dir, block_hash(input, strlen(input)));
+    return path;
+}
+
+// Drop the previous build's entries
+void cache_close(ASSEMBLER *as) {
+    BLOCKCACHE *cache = &as->cache;
+    if (cache->map) munmap(cache->map, cache->map_size);
+    free(cache->index);
+    cache->map = NULL;
+    cache->map_size = 0;
+    cache->index = NULL;
+    cache->index_mask = 0;
+    cache->entry_count = 0;
+}
+
+// Map the cache file of input and index its entries. A missing, damaged
+// or outdated file just means every block is parsed again.
+void cache_open(ASSEMBLER *as, const char *input) {
+    BLOCKCACHE *cache = &as->cache;
+    cache_close(as);
+    cache->out.size = 0;
+    cache->pieces.count = 0;
+    cache->out_count = 0;
+    cache->blocks = cache->hits = cache->lines = cache->hit_lines = 0;
+
+    char *path = cache_path(cache->dir, input);
+    int fd = path ? open(path, O_RDONLY) : -1;
+    free(path);
+    if (fd < 0) return;
+
+    struct stat st;
+    if (fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(CACHEHEADER)) {
+        void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map != MAP_FAILED) {
+            cache->map = map;
+            cache->map_size = st.st_size;
+        }
+    }
+    close(fd);
+    if (!cache->map) return;
+
+    const CACHEHEADER *header = (const CACHEHEADER *)cache->map;
+    if (memcmp(header->magic, "ASMC", 4) != 0 || header->format != CACHE_FORMAT ||
+        header->opcodes != opcode_table_version() || header->optimize_size != (unsigned int)as->optimize_size) {
+        cache_close(as);
+        return;
+    }
+
+    if (header->entry_count > (cache->map_size - sizeof(CACHEHEADER)) / sizeof(CACHEENTRY)) {
+        cache_close(as);
+        return;
+    }
+    size_t size = 16;
+    while (size < (size_t)header->entry_count * 2) size <<= 1;
+    cache->index = calloc(size, sizeof(CACHEENTRY *));
+    if (!cache->index) {
+        cache_close(as);
+        return;
+    }
+    cache->index_mask = (unsigned int)size - 1;
+
+    // Walk the entries, checking each fits in the file and holds only what
+    // a build could have stored; any damage drops the whole file
+    size_t offset = sizeof(CACHEHEADER);
+    for (unsigned int i = 0; i < header->entry_count; i++) {
+        const CACHEENTRY *e = (const CACHEENTRY *)(cache->map + offset);
+        if (offset + sizeof(CACHEENTRY) > cache->map_size || e->size < sizeof(CACHEENTRY) ||
+            e->size % 8 || e->size > cache->map_size - offset || !valid_entry(as, e)) {
+            cache_close(as);
+            return;
+        }
+        unsigned int slot = (unsigned int)e->hash & cache->index_mask;
+        while (cache->index[slot]) slot = (slot + 1) & cache->index_mask;
+        cache->index[slot] = e;
+        cache->entry_count++;
+        offset += e->size;
+    }
+}
+
+// Save this build's blocks for the next one, unless nothing changed.
+// Written to a temporary file and renamed, so a reader never sees half.
+int cache_save(ASSEMBLER *as, const char *input) {
+    BLOCKCACHE *cache = &as->cache;
+    if (cache->hits == cache->blocks && cache->out_count == cache->entry_count)
+        return 1;
+
+    char *path = cache_path(cache->dir, input);
+    if (!path) return 0;
+    size_t len = strlen(path) + 32;
+    char *temp = malloc(len);
+    if (!temp) {
+        free(path);
+        return 0;
+    }
+    snprintf(temp, len, "%s.%ld.%lx", path, (long)getpid(), (unsigned long)pthread_self());
+
+    CACHEHEADER header = { {'A', 'S', 'M', 'C'}, CACHE_FORMAT, opcode_table_version(),
+                           (unsigned int)as->optimize_size, cache->out_count };
+    int ok = 0;
+    int fd = open(temp, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd >= 0) {
+        // Reused entries go out straight from the old file's mapping
+        struct iovec iov[64];
+        int niov = 0;
+        ssize_t expected = sizeof(header);
+        iov[niov++] = (struct iovec){ &header, sizeof(header) };
+        ok = 1;
+        for (int i = 0; ok && i < cache->pieces.count; i++) {
+            if (niov == 64) {
+                ok = writev(fd, iov, niov) == expected;
+                niov = 0;
+                expected = 0;
+            }
+            CACHEPIECE *piece = &cache->pieces.items[i];
+            iov[niov].iov_base = (void *)(piece->mapped ? piece->mapped : cache->out.data + piece->offset);
+            iov[niov++].iov_len = piece->size;
+            expected += piece->size;
+        }
+        if (ok && niov > 0)
+            ok = writev(fd, iov, niov) == expected;
+        close(fd);
+        ok = ok && rename(temp, path) == 0;
+        if (!ok) unlink(temp);
+    }
+    if (!ok) fprintf(stderr, "warning: cannot write cache file %s\n", path);
+    free(temp);
+    free(path);
+    return ok;
+}
+
+// Pass 1: parse every line once, define all symbols, and assign an
+// address and size to every instruction. Large sources are split at line
+// boundaries into one chunk per thread; the result does not depend on the
+// number of chunks.
+void pass1(ASSEMBLER *as) {
+    scan_macros(as);
+
+    int n = as->thread_count;
+    if ((size_t)n > as->source_size / MIN_CHUNK_SIZE) n = (int)(as->source_size / MIN_CHUNK_SIZE);
+    if (n < 1 || as->macros.sections) n = 1;   // Chunks cannot tell where a macro changes section
+
+    // Chunks fill buffers kept from the last assembly: a single chunk builds
+    // the IR in place, several use their worker's
+    CHUNK chunks[MAX_THREADS];
+    memset(chunks, 0, n * sizeof(CHUNK));
+    for (int i = 0; i < n; i++) {
+        WORKERBUFS *w = &as->workers[i];
+        chunks[i].ir = n == 1 ? as->ir : w->ir;
+        chunks[i].ir_capacity = n == 1 ? as->ir_capacity : w->ir_capacity;
+        chunks[i].syms = w->syms;
+        chunks[i].sym_capacity = w->sym_capacity;
+        chunks[i].refs = w->refs;
+        chunks[i].refs.count = 0;
+        chunks[i].expansions = &w->expansions;
+    }
+
+    // Each chunk has a memo to itself; one left full by the last assembly
+    // starts over. A table loaded since then may have the same contents at
+    // another address, so both are compared.
+    unsigned int opcodes = opcode_table_version();
+    for (int i = 0; i < n; i++) {
+        ENCODEMEMO *memo = &as->memo[i];
+        if (memo->entries && (memo->count >= as->memo_size / 4 * 3 || memo->optimize_size != as->optimize_size ||
+                              memo->table != opcode_table || memo->opcodes != opcodes)) {
+            memset(memo->entries, 0, as->memo_size * sizeof(MEMOENTRY));
+            memo->count = 0;
+        }
+        memo->optimize_size = as->optimize_size;
+        memo->table = opcode_table;
+        memo->opcodes = opcodes;
+        memo->hits = memo->misses = 0;
+        chunks[i].memo = memo;
+    }
+
+    const char *pos = as->source, *end = as->source + as->source_size;
+    for (int i = 0; i < n; i++) {
+        const char *split = i == n - 1 ? end : as->source + as->source_size / n * (i + 1);
+        if (split < pos) split = pos;
+        while (split < end && split[-1] != '\n') split++;
+        if (as->macros.block_count)
+            split = macro_safe_split(&as->macros, split);
+        chunks[i].as = as;
+        chunks[i].start = pos;
+        chunks[i].end = split;
+        pos = split;
+    }
+
+    // Where each chunk starts: line number and section in effect
+    if (n > 1)
+        run_parallel(scan_chunk, chunks, sizeof(CHUNK), n);
+    chunks[0].first_line = 1;
+    chunks[0].first_section = SEC_NONE;
+    for (int i = 1; i < n; i++) {
+        chunks[i].first_line = chunks[i - 1].first_line + chunks[i - 1].line_count;
+        chunks[i].first_section = chunks[i - 1].last_section != SEC_NONE ?
+                                  chunks[i - 1].last_section : chunks[i - 1].first_section;
+    }
+
+    run_parallel(parse_chunk, chunks, sizeof(CHUNK), n);
+    end_phase(as, PHASE_PARSE);
+
+    as->memo_hits = as->memo_misses = 0;
+    for (int i = 0; i < n; i++) {
+        as->memo_hits += as->memo[i].hits;
+        as->memo_misses += as->memo[i].misses;
+    }
+
+    // Prefix sums: each chunk's offset in the IR and in every section
+    unsigned int total[SEC_COUNT] = {0};
+    unsigned int referenced[SEC_COUNT] = {0};
+    int nodes = 0;
+    for (int i = 0; i < n; i++) {
+        chunks[i].ir_offset = nodes;
+        nodes += chunks[i].ir_count;
+        for (int s = 0; s < SEC_COUNT; s++) {
+            chunks[i].base[s] = total[s];
+            chunks[i].referenced_base[s] = referenced[s];
+            total[s] += chunks[i].address[s];
+            referenced[s] += chunks[i].referenced[s];
+        }
+    }
+
+    if (n == 1) {
+        // Nothing to rebase: the chunk's IR is the IR
+        as->ir = chunks[0].ir;
+        as->ir_capacity = chunks[0].ir_capacity;
+    } else {
+        if (nodes > as->ir_capacity) {
+            IRNODE *grown = realloc(as->ir, nodes * sizeof(IRNODE));
+            if (!grown) {
+                fprintf(stderr, "Out of memory growing IR!\n");
+                exit(1);
+            }
+            as->ir = grown;
+            as->ir_capacity = nodes;
+        }
+        run_parallel(merge_chunk, chunks, sizeof(CHUNK), n);
+    }
+    as->ir_count = nodes;
+
+    // Cache entries in source order, for cache_save()
+    if (as->cache.dir) {
+        BLOCKCACHE *cache = &as->cache;
+        for (int i = 0; i < n; i++) {
+            CHUNK *c = &chunks[i];
+            for (int j = 0; j < c->cache_pieces.count; j++) {
+                CACHEPIECE *piece = &c->cache_pieces.items[j];
+                add_piece(&cache->pieces, piece->mapped, piece->offset + cache->out.size, piece->size);
+            }
+            memcpy(buffer_reserve(&cache->out, c->cache_out.size, "cache"), c->cache_out.data, c->cache_out.size);
+            cache->out.size += c->cache_out.size;
+            cache->out_count += c->cache_count;
+            cache->blocks += c->cache_blocks;
+            cache->hits += c->cache_hits;
+            cache->lines += c->cache_lines;
+            cache->hit_lines += c->cache_hit_lines;
+            free(c->cache_out.data);
+            free(c->cache_pieces.items);
+        }
+    }
+
+    // Symbols go in sequentially, in source order, so the table (and the
+    // object file symbol order) is the same for any number of chunks
+    for (int i = 0; i < n; i++) {
+        CHUNK *c = &chunks[i];
+        for (int j = 0; j < c->sym_count; j++) {
+            SYMEVENT *e = &c->syms[j];
+            unsigned int address = e->address + (e->defined ? c->base[e->section] : 0);
+            if (e->defined) {
+                const SYMBOL *old = find_symbol_n(as, e->name.ptr, e->name.len);
+                if (old && old->defined)
+                    report_error(as, e->node >= 0 ? as->ir[c->ir_offset + e->node].line : 0,
+                                 "symbol '%.*s' is already defined", e->name.len, e->name.ptr);
+            }
+            add_symbol_n(as, e->name.ptr, e->name.len, address, e->type, e->section, e->size, e->defined);
+            if (e->node >= 0)
+                as->ir[c->ir_offset + e->node].label = find_symbol_n(as, e->name.ptr, e->name.len) - as->symbol_table + 1;
+        }
+
+        // Included blobs, rebased like the IR
+        for (int j = 0; j < c->refs.count; j++) {
+            SECTIONREF *ref = new_ref(&as->refs);
+            *ref = c->refs.items[j];
+            ref->address += c->base[ref->section];
+        }
+
+        // Hand the (possibly grown) buffers back for the next assembly
+        WORKERBUFS *w = &as->workers[i];
+        if (n > 1) {
+            w->ir = c->ir;
+            w->ir_capacity = c->ir_capacity;
+        }
+        w->syms = c->syms;
+        w->sym_capacity = c->sym_capacity;
+        w->refs = c->refs;
+    }
+
+    memcpy(as->section_size, total, sizeof(as->section_size));
+}
+
+// Lay out .text from the current instruction sizes, moving labels along
+static unsigned int layout_text(ASSEMBLER *as) {
+    unsigned int address = 0, referenced = 0;
+    SECTIONREF *ref = as->refs.items;
+
+    for (int i = 0; i < as->ir_count; i++) {
+        IRNODE *node = &as->ir[i];
+        if (node->section != SEC_TEXT) continue;
+
+        node->address = address;
+        node->offset = address - referenced;
+        if (node->label)
+            as->symbol_table[node->label - 1].address = address;
+        if (node->kind != IR_INSN)
+            continue;
+        address += node->size;
+
+        // Repeats of a times line move along with it (never branches, so
+        // their size is fixed)
+        if (node->repeat) {
+            while (ref->section != SEC_TEXT) ref++;
+            ref->address = address;
+            address += ref->size;
+            referenced += ref->size;
+            ref++;
+        }
+    }
+    return address;
+}
+
+// Branch relaxation: every jmp/jcc starts in its short (rel8) form and
+// only branches whose target is out of range are widened to rel32. Widening
+// moves later code, which can push other branches out of range, so repeat
+// until nothing changes. Branches only ever grow, so this converges; past
+// MAX_RELAX_PASSES the remaining short branches are widened outright.
+void relax_branches(ASSEMBLER *as) {
+    unsigned char machine[16];
+
+    // Resolve branch targets to symbol indices once
+    for (int i = 0; i < as->ir_count; i++) {
+        IRNODE *node = &as->ir[i];
+        if (node->kind == IR_INSN && node->op1.kind == OPD_SYM) {
+            SYMBOL *sym = find_symbol_n(as, node->op1.sym.ptr, node->op1.sym.len);
+            if (sym) node->target = sym - as->symbol_table + 1;
+        }
+    }
+
+    as->relax_passes = 0;
+    int changed = 1;
+    while (changed) {
+        changed = 0;
+        as->relax_passes++;
+        layout_text(as);
+
+        for (int i = 0; i < as->ir_count; i++) {
+            IRNODE *node = &as->ir[i];
+            if (node->kind != IR_INSN || node->near || !is_relaxable_branch(node->opcode))
+                continue;
+
+            int widen = as->relax_passes >= MAX_RELAX_PASSES;
+            if (!widen) {
+                SYMBOL *sym = node->target ? &as->symbol_table[node->target - 1] : NULL;
+                if (sym && (!sym->defined || sym->section != SEC_TEXT)) {
+                    widen = 1;  // Externs and other sections are never in rel8 range
+                } else if (sym || node->op1.kind == OPD_IMM) {
+                    unsigned int target = sym ? sym->address : (unsigned int)node->op1.imm;
+                    int disp = (int)(target - (node->address + node->size));
+                    widen = disp < -128 || disp > 127;
+                }
+            }
+
+            if (widen) {
+                node->near = 1;
+                node->size = encode_instruction(as, node, machine, NULL);
+                changed = 1;
+            }
+        }
+    }
+
+    // Final sizes for everything after the last widening
+    as->section_size[SEC_TEXT] = layout_text(as);
+
+    as->short_branches = as->near_branches = 0;
+    for (int i = 0; i < as->ir_count; i++) {
+        IRNODE *node = &as->ir[i];
+        if (node->kind != IR_INSN || node->type != OPT_I) continue;
+        int rel = branch_rel_size(node->opcode);
+        if (!rel || node->opcode->bytes[0] == 0xE8) continue;  // calls are always near
+        if (rel == 1 && !node->near) as->short_branches++;
+        else as->near_branches++;
+    }
+}
+
+// Pass 2 worker: encode a range of IR nodes at their final addresses
+static void* encode_range(void *arg) {
+    ENCODEJOB *job = arg;
+    ASSEMBLER *as = job->as;
+
+    for (int i = job->begin; i < job->end; i++) {
+        IRNODE *node = &as->ir[i];
+        unsigned char *dest = as->section_buf[node->section].data + node->offset;
+        if (node->kind == IR_DATA) {
+            STRVIEW name, times, directive;
+            STRVIEW values = data_directive(view_trim((STRVIEW){ node->text, node->text_len }), &name, &times, &directive);
+            int width = data_width(directive);
+            if (width)
+                emit_data(as, values, width, dest, node->line);
+            continue;
+        }
+        if (node->kind != IR_INSN)
+            continue;
+
+        if (node->bytes)
+            memcpy(dest, node->bytes, node->size);   // Pre-encoded, from the cache
+        else
+            encode_instruction(as, node, dest, &job->relocs);
+    }
+    collect_counters(as);
+    return NULL;
+}
+
+// Write the listing from the IR and the encoded section bytes
+static void list_ir(ASSEMBLER *as) {
+    for (int i = 0; i < as->ir_count; i++) {
+        IRNODE *node = &as->ir[i];
+        const char *text = node->text;
+        int text_len = node->text_len;
+
+        switch (node->kind) {
+            case IR_BLANK:
+                list_row(as, node->line, -1, NULL, 0, NULL, 0, 0);
+                break;
+            case IR_LABEL:
+                list_row(as, node->line, node->address, NULL, 0, text, text_len, 30);
+                break;
+            case IR_INSN:
+                list_row(as, node->line, node->address, as->section_buf[node->section].data + node->offset,
+                         node->size, text, text_len, 24);
+                break;
+            case IR_DATA:
+                list_row(as, node->line, node->address, as->section_buf[node->section].data + node->offset,
+                         node->size < MAX_LIST_DATA ? node->size : MAX_LIST_DATA, text, text_len, 24);
+                break;
+            case IR_BLOB:
+                list_row(as, node->line, node->address, NULL, 0, text, text_len, 24);
+                break;
+            default:
+                list_row(as, node->line, -1, NULL, 0, text, text_len, 28);
+                break;
+        }
+    }
+}
+
+// Pass 2: encode every instruction from the IR with all symbols known,
+// straight into the section buffers at its final address. Every address is
+// fixed by now, so the IR is split into one range per thread; relocations
+// are collected per range and concatenated in order. The source is not
+// parsed again.
+void pass2(ASSEMBLER *as) {
+    // The buffers hold everything but included blobs. Every .data byte is
+    // written by its line; .text starts zero-filled.
+    for (int s = SEC_DATA; s <= SEC_TEXT; s++) {
+        unsigned int stored = buffer_offset(as, s, as->section_size[s]);
+        section_reserve(as, s, stored + MAX_INSN_LEN);
+        if (s != SEC_DATA)
+            memset(as->section_buf[s].data, 0, stored);
+        as->section_buf[s].size = stored;
+    }
+
+    int n = as->thread_count;
+    if (n > as->ir_count / MIN_ENCODE_NODES) n = as->ir_count / MIN_ENCODE_NODES;
+    if (n < 1) n = 1;
+
+    ENCODEJOB jobs[MAX_THREADS];
+    memset(jobs, 0, n * sizeof(ENCODEJOB));
+    for (int i = 0; i < n; i++) {
+        jobs[i].as = as;
+        jobs[i].begin = (int)((long)as->ir_count * i / n);
+        jobs[i].end = (int)((long)as->ir_count * (i + 1) / n);
+        jobs[i].relocs = as->workers[i].relocs;
+        jobs[i].relocs.count = 0;
+    }
+    run_parallel(encode_range, jobs, sizeof(ENCODEJOB), n);
+
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < jobs[i].relocs.count; j++) {
+            RELOC *r = &jobs[i].relocs.items[j];
+            add_relocation(&as->relocations, r->section, r->offset, r->type, r->symbol);
+        }
+        as->workers[i].relocs = jobs[i].relocs;
+    }
+
+    if (as->listing_fd >= 0)
+        list_ir(as);
+}
+
+// Make room for len more bytes at the end of buf. Returns NULL, leaving
+// buf as it was, if there is not enough memory.
+unsigned char* buffer_try_reserve(SECTIONBUF *buf, size_t len) {
+    if (buf->size + len > buf->capacity || !buf->data) {
+        size_t capacity = buf->capacity ? buf->capacity : 4096;
+        while (capacity < buf->size + len) capacity *= 2;
+        unsigned char *grown = realloc(buf->data, capacity);
+        if (!grown)
+            return NULL;
+        buf->data = grown;
+        buf->capacity = capacity;
+    }
+    return buf->data + buf->size;
+}
+
+// Make room for len more bytes at the end of buf; what names it in errors
+unsigned char* buffer_reserve(SECTIONBUF *buf, size_t len, const char *what) {
+    unsigned char *dest = buffer_try_reserve(buf, len);
+    if (!dest) {
+        fprintf(stderr, "Out of memory growing %s!\n", what);
+        exit(1);
+    }
+    return dest;
+}
+
+// Make room for len more bytes at the end of a section and return where
+// they go. The encoder writes there directly; callers then bump size.
+unsigned char* section_reserve(ASSEMBLER *as, Section section, size_t len) {
+    return buffer_reserve(&as->section_buf[section], len, section_name(section));
+}
+
+void clear_sections(ASSEMBLER *as) {
+    for (int i = 0; i < SEC_COUNT; i++)
+        as->section_buf[i].size = 0;
+    as->refs.count = 0;
+    as->relocations.count = 0;
+}
+
+// Where a section address is in the section buffer: included blobs and
+// times copies before it are not stored there
+unsigned int buffer_offset(ASSEMBLER *as, Section section, unsigned int address) {
+    unsigned int offset = address;
+    for (int i = 0; i < as->refs.count; i++) {
+        const SECTIONREF *ref = &as->refs.items[i];
+        if (ref->section == section && ref->address < address)
+            offset -= ref->size;
+    }
+    return offset;
+}
+
+static void add_iov(IOVLIST *list, const void *base, size_t len) {
+    if (len == 0) return;
+    if (list->count == list->capacity) {
+        int capacity = list->capacity ? list->capacity * 2 : 32;
+        struct iovec *grown = realloc(list->items, capacity * sizeof(struct iovec));
+        if (!grown) {
+            fprintf(stderr, "Out of memory writing output!\n");
+            exit(1);
+        }
+        list->items = grown;
+        list->capacity = capacity;
+    }
+    list->items[list->count].iov_base = (void *)base;
+    list->items[list->count++].iov_len = len;
+}
+
+// Add a section's contents to an output: runs of its buffer, with each
+// included blob mapped from its file and spliced in between, so blob
+// bytes go from the page cache to the output without being copied here.
+// times copies are expanded into an arena buffer of at most
+// REPEAT_FILL_SIZE that is handed to writev() as often as needed.
+// Returns 0 if a blob cannot be mapped; unmap_refs() releases them.
+static int add_section_iovs(ASSEMBLER *as, Section section, IOVLIST *list) {
+    const unsigned char *buf = as->section_buf[section].data;
+    unsigned int address = 0, stored = 0;
+
+    for (int i = 0; i < as->refs.count; i++) {
+        SECTIONREF *ref = &as->refs.items[i];
+        if (ref->section != section) continue;
+
+        add_iov(list, buf + stored, ref->address - address);
+        stored += ref->address - address;
+        address = ref->address + ref->size;
+
+        if (ref->kind == REF_REPEAT) {
+            // The one stored copy ends where the repeats start
+            size_t fill = REPEAT_FILL_SIZE - REPEAT_FILL_SIZE % ref->unit;
+            if (fill < ref->unit) fill = ref->unit;
+            if (fill > ref->size) fill = ref->size;
+            unsigned char *copies = arena_alloc(&as->arena, fill);
+            memcpy(copies, buf + stored - ref->unit, ref->unit);
+            for (size_t filled = ref->unit; filled < fill; filled *= 2)
+                memcpy(copies + filled, copies, filled < fill - filled ? filled : fill - filled);
+            ref->map = copies;
+            ref->map_size = fill;
+            for (size_t left = ref->size; left > 0; left -= left < fill ? left : fill)
+                add_iov(list, copies, left < fill ? left : fill);
+            continue;
+        }
+
+        char name[4096];
+        memcpy(name, ref->path.ptr, ref->path.len);
+        name[ref->path.len] = '\0';
+        int fd = open(name, O_RDONLY);
+        struct stat st;
+        if (fd < 0 || fstat(fd, &st) != 0 || (unsigned long long)st.st_size < (unsigned long long)ref->offset + ref->size) {
+            fprintf(stderr, "error: cannot read %u bytes of '%s' for incbin\n", ref->size, name);
+            if (fd >= 0) close(fd);
+            return 0;
+        }
+        off_t page = ref->offset & ~(off_t)(sysconf(_SC_PAGESIZE) - 1);
+        ref->map_size = ref->size + (size_t)(ref->offset - page);
+        ref->map = mmap(NULL, ref->map_size, PROT_READ, MAP_PRIVATE, fd, page);
+        close(fd);
+        if (ref->map == MAP_FAILED) {
+            ref->map = NULL;
+            perror("Cannot map incbin file");
+            return 0;
+        }
+        madvise(ref->map, ref->map_size, MADV_SEQUENTIAL);
+        add_iov(list, (unsigned char *)ref->map + (ref->offset - page), ref->size);
+    }
+    add_iov(list, buf + stored, as->section_size[section] - address);
+    return 1;
+}
+
+static void unmap_refs(ASSEMBLER *as) {
+    for (int i = 0; i < as->refs.count; i++) {
+        SECTIONREF *ref = &as->refs.items[i];
+        if (ref->kind == REF_BLOB && ref->map)
+            munmap(ref->map, ref->map_size);
+        ref->map = NULL;
+    }
+}
+
+// Move past n written bytes of an iovec array of left entries
+static void skip_written(struct iovec **iov, int *left, size_t n) {
+    while (*left > 0 && n >= (*iov)->iov_len) {
+        n -= (*iov)->iov_len;
+        (*iov)++;
+        (*left)--;
+    }
+    if (*left > 0) {
+        (*iov)->iov_base = (char *)(*iov)->iov_base + n;
+        (*iov)->iov_len -= n;
+    }
+}
+
+// Write a whole output file: writev() in MAX_WRITE_IOVS batches, picking up
+// after short writes. Returns 0 on failure.
+static int write_iovs(int fd, IOVLIST *list) {
+    struct iovec *iov = list->items;
+    int left = list->count;
+    while (left > 0) {
+        ssize_t n = writev(fd, iov, left < MAX_WRITE_IOVS ? left : MAX_WRITE_IOVS);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return 0;
+        }
+        skip_written(&iov, &left, n);
+    }
+    return 1;
+}
+
+void add_relocation(RELOCLIST *list, Section section, unsigned int offset, int type, int symbol) {
+    if (list->count == list->capacity) {
+        int capacity = list->capacity ? list->capacity * 2 : 256;
+        RELOC *grown = realloc(list->items, capacity * sizeof(RELOC));
+        if (!grown) {
+            fprintf(stderr, "Out of memory growing relocations!\n");
+            exit(1);
+        }
+        list->items = grown;
+        list->capacity = capacity;
+    }
+    RELOC *r = &list->items[list->count++];
+    r->offset = offset;
+    r->section = (unsigned char)section;
+    r->type = (unsigned char)type;
+    r->symbol = symbol;
+}
+
+// Value to store at a relocated field. REL relocations keep the addend in
+// place: a symbol's offset within its section (we relocate against the
+// section symbol), and 0 for undefined symbols. PC32 fields also subtract
+// the 4 bytes between the field and the end of the instruction.
+int relocation_addend(const SYMBOL *sym, int type) {
+    int addend = sym->defined ? (int)sym->address : 0;
+    return type == R_386_PC32 ? addend - 4 : addend;
+}
+
+static size_t align_up(size_t n, size_t align) {
+    return (n + align - 1) & ~(align - 1);
+}
+
+// Offset of name in a string table of NUL-separated names
+static Elf32_Word shstrtab_offset(const char *table, size_t size, const char *name) {
+    for (size_t i = 1; i < size; i += strlen(table + i) + 1) {
+        if (strcmp(table + i, name) == 0) return (Elf32_Word)i;
+    }
+    return 0;
+}
+
+// Write the pieces in as->iovs to a new file, then release the blob
+// mappings they point into. what names the file in errors.
+static int write_pieces(ASSEMBLER *as, int ok, const char *filename, const char *what) {
+    int fd = ok ? open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644) : -1;
+    if (ok && fd < 0) {
+        fprintf(stderr, "Cannot create %s file %s: %s\n", what, filename, strerror(errno));
+        ok = 0;
+    } else if (ok) {
+        ok = write_iovs(fd, &as->iovs);
+        if (!ok) fprintf(stderr, "Cannot write %s file %s: %s\n", what, filename, strerror(errno));
+        close(fd);
+    }
+    unmap_refs(as);
+    return ok;
+}
+
+// Lay out an ELF32 relocatable object with .text, .data, .bss, a symbol
+// table built from the SYMBOL entries, and .rel.text/.rel.data as a list
+// of pieces in as->iovs, to be written with one writev(). The headers and
+// tables are built in the arena. Returns 0 if an included blob cannot be
+// mapped; unmap_refs() once the pieces are written.
+static int elf32_pieces(ASSEMBLER *as) {
+    enum { ELF_NULL, ELF_TEXT, ELF_DATA, ELF_BSS, ELF_SHSTRTAB, ELF_SYMTAB, ELF_STRTAB,
+           ELF_REL_TEXT, ELF_REL_DATA, ELF_SECTIONS };
+    static const char shstrtab[] =
+        "\0.text\0.data\0.bss\0.shstrtab\0.symtab\0.strtab\0.rel.text\0.rel.data";
+    static const int section_index[SEC_COUNT] = { 0, ELF_DATA, ELF_TEXT, ELF_BSS };
+    static const unsigned char zeros[16] = {0};
+
+    // Symbols: null, one per section, then locals, then globals/externs
+    // (tables built in the arena, which the next assembly takes back)
+    int nsyms = 4 + as->symbol_count;
+    Elf32_Sym *syms = arena_alloc(&as->arena, nsyms * sizeof(Elf32_Sym));
+    memset(syms, 0, nsyms * sizeof(Elf32_Sym));
+    int *elf_index = arena_alloc(&as->arena, (as->symbol_count + 1) * sizeof(int));
+    size_t strtab_size = 1;
+    for (int i = 0; i < as->symbol_count; i++)
+        strtab_size += strlen(as->symbol_table[i].name) + 1;
+    char *strtab = arena_alloc(&as->arena, strtab_size);
+    Elf32_Rel *rels = arena_alloc(&as->arena, (as->relocations.count + 1) * sizeof(Elf32_Rel));
+
+    int n = 1;
+    for (int s = ELF_TEXT; s <= ELF_BSS; s++, n++) {
+        syms[n].st_info = ELF32_ST_INFO(STB_LOCAL, STT_SECTION);
+        syms[n].st_shndx = s;
+    }
+
+    size_t str_used = 1;
+    strtab[0] = '\0';
+    int first_global = 0;
+    for (int bind = 0; bind < 2; bind++) {
+        if (bind == 1) first_global = n;
+        for (int i = 0; i < as->symbol_count; i++) {
+            SYMBOL *sym = &as->symbol_table[i];
+            int global = sym->is_global || sym->type == SYM_EXTERN || !sym->defined;
+            if (global != bind) continue;
+
+            Elf32_Sym *es = &syms[n];
+            es->st_name = str_used;
+            size_t len = strlen(sym->name) + 1;
+            memcpy(strtab + str_used, sym->name, len);
+            str_used += len;
+
+            if (sym->defined) {
+                es->st_value = sym->address;
+                es->st_size = sym->size;
+                es->st_shndx = section_index[sym->section];
+            } else {
+                es->st_shndx = SHN_UNDEF;
+            }
+            es->st_info = ELF32_ST_INFO(global ? STB_GLOBAL : STB_LOCAL,
+                                        sym->type == SYM_VARIABLE ? STT_OBJECT : STT_NOTYPE);
+            elf_index[i] = n++;
+        }
+    }
+
+    // Relocations: defined symbols go through their section symbol
+    int rel_count[SEC_COUNT] = {0};
+    int r = 0;
+    for (int s = SEC_DATA; s <= SEC_TEXT; s++) {
+        for (int i = 0; i < as->relocations.count; i++) {
+            RELOC *rel = &as->relocations.items[i];
+            if (rel->section != s) continue;
+            SYMBOL *sym = &as->symbol_table[rel->symbol];
+            int target = sym->defined ? section_index[sym->section] : elf_index[rel->symbol];
+            rels[r].r_offset = rel->offset;
+            rels[r].r_info = ELF32_R_INFO(target, rel->type);
+            r++;
+            rel_count[s]++;
+        }
+    }
+
+    // File layout: header, section contents, then the section header table
+    Elf32_Shdr *sh = arena_alloc(&as->arena, ELF_SECTIONS * sizeof(Elf32_Shdr));
+    memset(sh, 0, ELF_SECTIONS * sizeof(Elf32_Shdr));
+    IOVLIST *iov = &as->iovs;   // Reused from file to file
+    iov->count = 0;
+    size_t offset = sizeof(Elf32_Ehdr);
+
+    Elf32_Ehdr *eh = arena_alloc(&as->arena, sizeof(Elf32_Ehdr));
+    memset(eh, 0, sizeof(*eh));
+    memcpy(eh->e_ident, ELFMAG, SELFMAG);
+    eh->e_ident[EI_CLASS] = ELFCLASS32;
+    eh->e_ident[EI_DATA] = ELFDATA2LSB;
+    eh->e_ident[EI_VERSION] = EV_CURRENT;
+    eh->e_type = ET_REL;
+    eh->e_machine = EM_386;
+    eh->e_version = EV_CURRENT;
+    eh->e_ehsize = sizeof(Elf32_Ehdr);
+    eh->e_shentsize = sizeof(Elf32_Shdr);
+    eh->e_shnum = ELF_SECTIONS;
+    eh->e_shstrndx = ELF_SHSTRTAB;
+    add_iov(iov, eh, sizeof(*eh));
+
+    // .text and .data come from the section buffers and included blobs
+    struct {
+        int index;
+        const char *name;
+        Elf32_Word type;
+        Elf32_Word flags;
+        Section section;
+        const void *data;
+        size_t size;
+        size_t align;
+    } contents[] = {
+        {ELF_TEXT, ".text", SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR,
+         SEC_TEXT, NULL, as->section_size[SEC_TEXT], 16},
+        {ELF_DATA, ".data", SHT_PROGBITS, SHF_ALLOC | SHF_WRITE,
+         SEC_DATA, NULL, as->section_size[SEC_DATA], 4},
+        {ELF_BSS, ".bss", SHT_NOBITS, SHF_ALLOC | SHF_WRITE, SEC_NONE, NULL, as->section_size[SEC_BSS], 4},
+        {ELF_SHSTRTAB, ".shstrtab", SHT_STRTAB, 0, SEC_NONE, shstrtab, sizeof(shstrtab), 1},
+        {ELF_SYMTAB, ".symtab", SHT_SYMTAB, 0, SEC_NONE, syms, n * sizeof(Elf32_Sym), 4},
+        {ELF_STRTAB, ".strtab", SHT_STRTAB, 0, SEC_NONE, strtab, str_used, 1},
+        {ELF_REL_TEXT, ".rel.text", SHT_REL, 0, SEC_NONE, rels + rel_count[SEC_DATA],
+         rel_count[SEC_TEXT] * sizeof(Elf32_Rel), 4},
+        {ELF_REL_DATA, ".rel.data", SHT_REL, 0, SEC_NONE, rels, rel_count[SEC_DATA] * sizeof(Elf32_Rel), 4},
+    };
+
+    int ok = 1;
+    for (size_t c = 0; ok && c < sizeof(contents) / sizeof(contents[0]); c++) {
+        Elf32_Shdr *h = &sh[contents[c].index];
+        size_t aligned = align_up(offset, contents[c].align);
+        if (aligned > offset && contents[c].type != SHT_NOBITS) {
+            add_iov(iov, zeros, aligned - offset);
+            offset = aligned;
+        }
+
+        h->sh_name = shstrtab_offset(shstrtab, sizeof(shstrtab), contents[c].name);
+        h->sh_type = contents[c].type;
+        h->sh_flags = contents[c].flags;
+        h->sh_offset = offset;
+        h->sh_size = contents[c].size;
+        h->sh_addralign = contents[c].align;
+
+        if (contents[c].type != SHT_NOBITS && contents[c].size) {
+            if (contents[c].section != SEC_NONE)
+                ok = add_section_iovs(as, contents[c].section, iov);
+            else
+                add_iov(iov, contents[c].data, contents[c].size);
+            offset += contents[c].size;
+        }
+    }
+
+    sh[ELF_SYMTAB].sh_link = ELF_STRTAB;
+    sh[ELF_SYMTAB].sh_info = first_global;
+    sh[ELF_SYMTAB].sh_entsize = sizeof(Elf32_Sym);
+    sh[ELF_REL_TEXT].sh_link = ELF_SYMTAB;
+    sh[ELF_REL_TEXT].sh_info = ELF_TEXT;
+    sh[ELF_REL_TEXT].sh_entsize = sizeof(Elf32_Rel);
+    sh[ELF_REL_DATA].sh_link = ELF_SYMTAB;
+    sh[ELF_REL_DATA].sh_info = ELF_DATA;
+    sh[ELF_REL_DATA].sh_entsize = sizeof(Elf32_Rel);
+
+    size_t aligned = align_up(offset, 4);
+    add_iov(iov, zeros, aligned - offset);
+    eh->e_shoff = aligned;
+    add_iov(iov, sh, ELF_SECTIONS * sizeof(Elf32_Shdr));
+    return ok;
+}
+
+int write_elf32(ASSEMBLER *as, const char *filename) {
+    return write_pieces(as, elf32_pieces(as), filename, "object");
+}
+
+// Lay out a flat binary in as->iovs: .text at offset 0, then .data aligned
+// to 4 bytes. .bss is not stored. With no linker to run, relocations are
+// resolved here (once) against the final section bases; externs cannot be.
+static int bin_pieces(ASSEMBLER *as) {
+    static const unsigned char zeros[4] = {0};
+    unsigned int base[SEC_COUNT] = {0};
+    base[SEC_TEXT] = 0;
+    base[SEC_DATA] = (unsigned int)align_up(as->section_size[SEC_TEXT], 4);
+    base[SEC_BSS] = (unsigned int)align_up(base[SEC_DATA] + as->section_size[SEC_DATA], 4);
+
+    int ok = 1;
+    for (int i = 0; i < as->relocations.count; i++) {
+        RELOC *r = &as->relocations.items[i];
+        SYMBOL *sym = &as->symbol_table[r->symbol];
+        if (!sym->defined) {
+            report_error(as, 0, "symbol '%s' is not defined and cannot be resolved in bin output", sym->name);
+            ok = 0;
+            continue;
+        }
+
+        // The field holds the addend; add the symbol's section base, and for
+        // PC-relative fields subtract the field's final address
+        unsigned char *field = as->section_buf[r->section].data + buffer_offset(as, r->section, r->offset);
+        unsigned int value = (unsigned int)field[0] | (unsigned int)field[1] << 8 |
+                             (unsigned int)field[2] << 16 | (unsigned int)field[3] << 24;
+        value += base[sym->section];
+        if (r->type == R_386_PC32)
+            value -= base[r->section] + r->offset;
+        field[0] = (unsigned char)(value & 0xFF);
+        field[1] = (unsigned char)((value >> 8) & 0xFF);
+        field[2] = (unsigned char)((value >> 16) & 0xFF);
+        field[3] = (unsigned char)((value >> 24) & 0xFF);
+    }
+    if (!ok) return 0;
+
+    // Section bytes go out straight from the encoder's buffers and the
+    // included files
+    IOVLIST *iov = &as->iovs;   // Reused from file to file
+    iov->count = 0;
+    ok = add_section_iovs(as, SEC_TEXT, iov);
+    if (ok && as->section_size[SEC_DATA]) {
+        add_iov(iov, zeros, base[SEC_DATA] - as->section_size[SEC_TEXT]);
+        ok = add_section_iovs(as, SEC_DATA, iov);
+    }
+    return ok;
+}
+
+int write_bin(ASSEMBLER *as, const char *filename) {
+    return write_pieces(as, bin_pieces(as), filename, "binary");
+}
+
+// The output of the last assembly, in the selected format, as pieces in
+// as->iovs instead of a file (used by --serve). Returns 0 on failure.
+// The pieces stay valid until unmap_refs() or the next assembly.
+int output_pieces(ASSEMBLER *as) {
+    return as->output_format == OUT_ELF32 ? elf32_pieces(as) : bin_pieces(as);
+}
+
+void init_assembler(ASSEMBLER *as) {
+    memset(as, 0, sizeof(*as));
+    as->output_format = OUT_ELF32;
+    as->thread_count = 1;
+    as->memo_size = MEMO_SLOTS;
+    as->listing_fd = -1;
+    pthread_mutex_init(&as->diag_lock, NULL);
+}
+
+// Release everything an assembler holds. The opcode table is shared and
+// freed separately by free_opcode_table().
+void free_assembler(ASSEMBLER *as) {
+    cache_close(as);
+    for (int i = 0; i < MAX_THREADS; i++)
+        free(as->memo[i].entries);
+    free(as->cache.out.data);
+    free(as->cache.pieces.items);
+    clear_symbol_table(as);
+    arena_free(&as->arena);
+    free(as->symbol_table);
+    free(as->symbol_index);
+    for (int i = 0; i < SEC_COUNT; i++) {
+        free(as->section_buf[i].data);
+        free(as->contents[i].data);
+    }
+    for (int i = 0; i < MAX_THREADS; i++) {
+        free(as->workers[i].ir);
+        free(as->workers[i].syms);
+        free(as->workers[i].refs.items);
+        free(as->workers[i].relocs.items);
+        arena_free(&as->workers[i].expansions.arena);
+    }
+    free(as->macros.macros);
+    free(as->macros.pieces);
+    free(as->macros.lines);
+    free(as->macros.blocks);
+    free(as->macros.index);
+    free(as->refs.items);
+    free(as->relocations.items);
+    free(as->iovs.items);
+    free(as->diagnostics.data);
+    free_source(as);
+    free(as->ir);
+    pthread_mutex_destroy(&as->diag_lock);
+    init_assembler(as);
+}
+
+// Drop the results of the last assembly but keep every buffer, table and
+// memo, so the next assembly of a similar source allocates nothing. The
+// arena goes back to empty in one step.
+void reset_assembler(ASSEMBLER *as) {
+    as->error_count = 0;
+    as->diagnostics.size = 0;
+    memset(as->phase_wall, 0, sizeof(as->phase_wall));
+    memset(as->phase_cpu, 0, sizeof(as->phase_cpu));
+    collect_counters(as);   // Drop what this thread counted before
+    memset(&as->counters, 0, sizeof(as->counters));
+    free_source(as);
+    clear_symbol_table(as);
+    arena_reset(&as->arena);
+    for (int i = 0; i < MAX_THREADS; i++) {
+        EXPANSIONS *x = &as->workers[i].expansions;
+        arena_reset(&x->arena);
+        x->slots = NULL;
+        x->mask = 0;
+        x->local_lines = x->local_seqs = NULL;
+        x->count = x->local_mask = x->local_count = 0;
+    }
+    clear_sections(as);
+    as->ir_count = 0;
+    as->footprint_start = assembler_footprint(as);
+}
+
+// Report an error on a source line (0: not tied to a line), prefixed with
+// the input name in batch mode. Safe to call from any worker.
+void report_error(ASSEMBLER *as, int line, const char *fmt, ...) {
+    thread_errors++;
+    char where[32] = "";
+    if (line > 0)
+        snprintf(where, sizeof(where), "line %d: ", line);
+    const char *input = as->input ? as->input : "";
+    const char *sep = as->input ? ": " : "";
+
+    va_list args;
+    va_start(args, fmt);
+    if (!as->capture_diagnostics) {
+        flockfile(stderr);
+        fprintf(stderr, "%s%s%serror: ", input, sep, where);
+        vfprintf(stderr, fmt, args);
+        fputc('\n', stderr);
+        funlockfile(stderr);
+    } else {
+        va_list copy;
+        va_copy(copy, args);
+        int prefix = snprintf(NULL, 0, "%s%s%serror: ", input, sep, where);
+        int len = prefix + vsnprintf(NULL, 0, fmt, copy) + 1;
+        va_end(copy);
+
+        pthread_mutex_lock(&as->diag_lock);
+        SECTIONBUF *buf = &as->diagnostics;
+        char *dest = (char *)buffer_reserve(buf, len + 1, "diagnostics");
+        snprintf(dest, prefix + 1, "%s%s%serror: ", input, sep, where);
+        vsnprintf(dest + prefix, len - prefix, fmt, args);
+        dest[len - 1] = '\n';
+        dest[len] = '\0';
+        buf->size += len;
+        pthread_mutex_unlock(&as->diag_lock);
+    }
+    va_end(args);
+    as->error_count++;
+}
+
+// Messages of the last assembly collected with capture_diagnostics, one
+// per line ("" if there were none)
+const char* assembler_diagnostics(ASSEMBLER *as) {
+    return as->diagnostics.size ? (const char *)as->diagnostics.data : "";
+}
+
+ASSEMBLER* new_assembler(void) {
+    ASSEMBLER *as = malloc(sizeof(ASSEMBLER));
+    if (as) init_assembler(as);
+    return as;
+}
+
+void delete_assembler(ASSEMBLER *as) {
+    if (!as) return;
+    free_assembler(as);
+    pthread_mutex_destroy(&as->diag_lock);   // free_assembler() leaves it initialized for reuse
+    free(as);
+}
+
+void set_assembler_options(ASSEMBLER *as, int threads, int optimize_size, int capture_diagnostics) {
+    as->thread_count = threads < 1 ? 1 : threads > MAX_THREADS ? MAX_THREADS : threads;
+    as->optimize_size = optimize_size != 0;
+    as->capture_diagnostics = capture_diagnostics != 0;
+}
+
+int assembler_symbol_count(ASSEMBLER *as) {
+    return as->symbol_count;
+}
+
+// Copy symbol index of the last assembly to info. Returns 0 if there is none.
+int assembler_symbol(ASSEMBLER *as, int index, SYMBOLINFO *info) {
+    if (index < 0 || index >= as->symbol_count)
+        return 0;
+    const SYMBOL *sym = &as->symbol_table[index];
+    info->name = sym->name;
+    info->address = sym->address;
+    info->size = sym->size;
+    info->section = sym->section;
+    info->type = sym->type;
+    info->defined = sym->defined;
+    info->is_global = sym->is_global;
+    return 1;
+}
+
+int assembler_relocation_count(ASSEMBLER *as) {
+    return as->relocations.count;
+}
+
+// Copy relocation index of the last assembly to info. Returns 0 if there is none.
+int assembler_relocation(ASSEMBLER *as, int index, RELOCINFO *info) {
+    if (index < 0 || index >= as->relocations.count)
+        return 0;
+    const RELOC *rel = &as->relocations.items[index];
+    info->section = rel->section;
+    info->offset = rel->offset;
+    info->type = rel->type;
+    info->symbol = rel->symbol;
+    return 1;
+}
+
+// Assemble a .asm file in two passes over an in-memory IR. The assembler
+// can be reused for the next file; its buffers are kept.
+void assembly_file(ASSEMBLER *as, const char *filename) {
+    reset_assembler(as);
+
+    start_phase(as);
+    if (!read_source(as, filename)) {
+        as->error_count++;
+        return;
+    }
+    if (as->cache.dir)
+        cache_open(as, filename);
+    end_phase(as, PHASE_READ);
+
+    pass1(as);
+    if (as->cache.dir && !as->macros.active)   // Blocks are not cached through macros
+        cache_save(as, filename);
+    relax_branches(as);
+    end_phase(as, PHASE_LAYOUT);
+    pass2(as);
+    end_phase(as, PHASE_ENCODE);
+    collect_counters(as);
+}
+
+// Assemble source text held in memory, e.g. a snippet from a code
+// generator, with no file I/O. The buffer is not copied and must stay
+// unchanged until the next assembly or reset_assembler(); name (may be
+// NULL) prefixes messages like a file name. Results stay in the
+// assembler: section_contents(), the symbol table, relocations and
+// assembler_diagnostics(). Returns 0 if there were errors.
+//
+// Contexts share nothing writable but the (read-only) opcode table, so
+// separate ASSEMBLERs can be used on different threads at once; one
+// context must not be. Once its buffers have grown to fit, a context
+// assembles without allocating.
+int assemble_buffer(ASSEMBLER *as, const char *source, size_t size, const char *name) {
+    reset_assembler(as);
+    as->input = name;
+
+    start_phase(as);
+    as->source = size ? source : "";
+    as->source_size = size;
+    end_phase(as, PHASE_READ);
+
+    pass1(as);
+    relax_branches(as);
+    end_phase(as, PHASE_LAYOUT);
+    pass2(as);
+    end_phase(as, PHASE_ENCODE);
+    collect_counters(as);
+    return as->error_count == 0;
+}
+
+// Bytes of a section after assembly, with incbin files and times copies
+// filled in. Sections without either are returned straight from their
+// buffer; others are expanded once into a buffer kept for the next call.
+// .bss has no bytes: NULL with *size its length. Returns NULL after an
+// error reading an incbin file.
+const unsigned char* section_contents(ASSEMBLER *as, Section section, size_t *size) {
+    *size = as->section_size[section];
+    if (section != SEC_DATA && section != SEC_TEXT)
+        return NULL;
+
+    const unsigned char *buf = as->section_buf[section].data;
+    int refs = 0;
+    for (int i = 0; i < as->refs.count; i++)
+        refs += as->refs.items[i].section == section;
+    if (!refs)
+        return buf;
+
+    SECTIONBUF *out = &as->contents[section];
+    out->size = 0;
+    unsigned char *dest = buffer_reserve(out, *size, section_name(section));
+    unsigned int address = 0, stored = 0;
+    for (int i = 0; i < as->refs.count; i++) {
+        SECTIONREF *ref = &as->refs.items[i];
+        if (ref->section != section) continue;
+
+        memcpy(dest + address, buf + stored, ref->address - address);
+        stored += ref->address - address;
+        address = ref->address;
+
+        if (ref->kind == REF_REPEAT) {
+            // Double the copies made so far until the run is filled
+            unsigned char *run = dest + address - ref->unit;
+            for (size_t filled = ref->unit; filled < ref->unit + (size_t)ref->size; filled *= 2) {
+                size_t n = ref->unit + (size_t)ref->size - filled;
+                memcpy(run + filled, run, n < filled ? n : filled);
+            }
+        } else {
+            char name[4096];
+            memcpy(name, ref->path.ptr, ref->path.len);
+            name[ref->path.len] = '\0';
+            int fd = open(name, O_RDONLY);
+            size_t done = 0;
+            while (fd >= 0 && done < ref->size) {
+                ssize_t n = pread(fd, dest + address + done, ref->size - done, ref->offset + done);
+                if (n <= 0) break;
+                done += n;
+            }
+            if (fd >= 0) close(fd);
+            if (done < ref->size) {
+                report_error(as, 0, "cannot read %u bytes of '%s' for incbin", ref->size, name);
+                return NULL;
+            }
+        }
+        address += ref->size;
+    }
+    memcpy(dest + address, buf + stored, *size - address);
+    out->size = *size;
+    return dest;
+}
+
+// Default output name: input with its extension replaced
+char* output_name(const char *input, const char *ext) {
+    const char *slash = strrchr(input, '/');
+    const char *dot = strrchr(input, '.');
+    size_t stem = (dot && (!slash || dot > slash)) ? (size_t)(dot - input) : strlen(input);
+    char *name = malloc(stem + strlen(ext) + 1);
+    if (name) {
+        memcpy(name, input, stem);
+        strcpy(name + stem, ext);
+    }
+    return name;
+}
+
+// Write the assembled object or binary to output, or when output is NULL
+// to the input's name with .o or .bin. Returns 0 on failure, which counts
+// as an error if it was not reported as one.
+int write_output(ASSEMBLER *as, const char *input, const char *output) {
+    int elf = as->output_format == OUT_ELF32;
+    char *name = output ? NULL : output_name(input, elf ? ".o" : ".bin");
+    const char *path = output ? output : name;
+    int errors = as->error_count;
+    start_phase(as);
+    int ok = path && (elf ? write_elf32(as, path) : write_bin(as, path));
+    if (!ok && as->error_count == errors)
+        as->error_count++;
+    free(name);
+    end_phase(as, PHASE_OUTPUT);
+    collect_counters(as);
+    return ok;
+}
+
+// Cache hit rate, on stderr so it does not mix with a listing on stdout
+void print_cache_stats(int blocks, int hits, int lines, int hit_lines) {
+    fprintf(stderr, "cache: %d of %d blocks reused (%.1f%%), %d of %d lines\n",
+            hits, blocks, blocks ? 100.0 * hits / blocks : 0.0, hit_lines, lines);
+}
+
+// Add this thread's counters to the assembler's totals and start over
+void collect_counters(ASSEMBLER *as) {
+#ifndef ASSEMBLER_NO_STATS
+    COUNTERS *c = &as->counters;
+    __atomic_fetch_add(&c->parsed, thread_counters.parsed, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&c->opcode_lookups, thread_counters.opcode_lookups, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&c->opcode_probes, thread_counters.opcode_probes, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&c->symbol_lookups, thread_counters.symbol_lookups, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&c->symbol_probes, thread_counters.symbol_probes, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&c->macro_expansions, thread_counters.macro_expansions, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&c->macro_cached, thread_counters.macro_cached, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&c->expanded_lines, thread_counters.expanded_lines, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&c->define_substitutions, thread_counters.define_substitutions, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&c->preprocess_ns, thread_counters.preprocess_ns, __ATOMIC_RELAXED);
+    memset(&thread_counters, 0, sizeof(thread_counters));
+#else
+    (void)as;
+#endif
+}
+
+static double clock_seconds(clockid_t clock) {
+    struct timespec ts;
+    clock_gettime(clock, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Phase timing for --stats: end_phase() charges the time since the last
+// start_phase() or end_phase() to phase. CPU time is the whole process's,
+// so it includes every pass 1 and pass 2 thread.
+void start_phase(ASSEMBLER *as) {
+    if (!as->stats) return;
+    as->phase_start_wall = clock_seconds(CLOCK_MONOTONIC);
+    as->phase_start_cpu = clock_seconds(CLOCK_PROCESS_CPUTIME_ID);
+}
+
+void end_phase(ASSEMBLER *as, Phase phase) {
+    if (!as->stats) return;
+    double wall = clock_seconds(CLOCK_MONOTONIC), cpu = clock_seconds(CLOCK_PROCESS_CPUTIME_ID);
+    as->phase_wall[phase] += wall - as->phase_start_wall;
+    as->phase_cpu[phase] += cpu - as->phase_start_cpu;
+    as->phase_start_wall = wall;
+    as->phase_start_cpu = cpu;
+}
+
+static const char *const phase_name[PHASE_COUNT] = { "read", "parse", "layout", "encode", "output" };
+
+static int count_instructions(ASSEMBLER *as) {
+    int n = 0;
+    for (int i = 0; i < as->ir_count; i++)
+        n += as->ir[i].kind == IR_INSN;
+    return n;
+}
+
+static long peak_rss_kb() {
+    struct rusage usage;
+    return getrusage(RUSAGE_SELF, &usage) == 0 ? usage.ru_maxrss : 0;
+}
+
+// --stats report on stderr
+void print_stats(ASSEMBLER *as, const char *input) {
+    double wall = 0, cpu = 0;
+    fprintf(stderr, "stats: %s\n  phase      wall ms     cpu ms\n", input);
+    for (int p = 0; p < PHASE_COUNT; p++) {
+        fprintf(stderr, "  %-8s %9.3f  %9.3f\n", phase_name[p], as->phase_wall[p] * 1e3, as->phase_cpu[p] * 1e3);
+        wall += as->phase_wall[p];
+        cpu += as->phase_cpu[p];
+    }
+    fprintf(stderr, "  %-8s %9.3f  %9.3f\n", "total", wall * 1e3, cpu * 1e3);
+
+    fprintf(stderr, "  lines %d, instructions %d (memo %d hits, %d misses)\n",
+            as->ir_count, count_instructions(as), as->memo_hits, as->memo_misses);
+    fprintf(stderr, "  branches: %d short, %d near, %d relaxation pass%s\n", as->short_branches,
+            as->near_branches, as->relax_passes, as->relax_passes == 1 ? "" : "es");
+#ifndef ASSEMBLER_NO_STATS
+    const COUNTERS *c = &as->counters;
+    fprintf(stderr, "  parsed %ld, opcode lookups %ld (%.2f probes each)\n", c->parsed, c->opcode_lookups,
+            c->opcode_lookups ? (double)c->opcode_probes / c->opcode_lookups : 0.0);
+    if (as->macros.active)
+        fprintf(stderr, "  macros: %d definitions, %ld expansions (%ld reused), %ld expanded lines, "
+                        "%ld %%define substitutions, %.3f ms\n", as->macros.count, c->macro_expansions,
+                c->macro_cached, c->expanded_lines, c->define_substitutions, c->preprocess_ns / 1e6);
+    fprintf(stderr, "  symbol lookups %ld (%.2f probes each), ", c->symbol_lookups,
+            c->symbol_lookups ? (double)c->symbol_probes / c->symbol_lookups : 0.0);
+#else
+    fprintf(stderr, "  counters compiled out (ASSEMBLER_NO_STATS), ");
+#endif
+    unsigned int slots = as->symbol_index ? as->symbol_index_mask + 1 : 0;
+    fprintf(stderr, "%d symbols in %u slots (load %.2f)\n", as->symbol_count, slots,
+            slots ? (double)as->symbol_count / slots : 0.0);
+    fprintf(stderr, "  bytes: .text %u, .data %u, .bss %u; peak RSS %ld KB\n", as->section_size[SEC_TEXT],
+            as->section_size[SEC_DATA], as->section_size[SEC_BSS], peak_rss_kb());
+    size_t footprint = assembler_footprint(as);
+    fprintf(stderr, "  memory: %zu KB held, %zu KB allocated by this assembly; arena %zu KB in use, "
+                    "high water %zu KB, %zu KB of blocks\n", footprint >> 10,
+            (footprint - as->footprint_start) >> 10, as->arena.in_use >> 10, as->arena.high_water >> 10,
+            as->arena.allocated >> 10);
+}
+
+// --stats-json: the same as one JSON object. Returns 0 on failure.
+int write_stats_json(ASSEMBLER *as, const char *input, const char *filename) {
+    FILE *fp = fopen(filename, "w");
+    if (!fp) {
+        perror("Cannot create stats file");
+        return 0;
+    }
+
+    fprintf(fp, "{\n  \"input\": \"");
+    for (const char *p = input; *p; p++) {
+        if (*p == '"' || *p == '\\') fputc('\\', fp);
+        fputc(*p, fp);
+    }
+    fprintf(fp, "\",\n  \"phases\": {");
+    for (int p = 0; p < PHASE_COUNT; p++)
+        fprintf(fp, "%s\n    \"%s\": {\"wall_ms\": %.3f, \"cpu_ms\": %.3f}", p ? "," : "",
+                phase_name[p], as->phase_wall[p] * 1e3, as->phase_cpu[p] * 1e3);
+    fprintf(fp, "\n  },\n  \"lines\": %d,\n  \"instructions\": %d,\n  \"memo_hits\": %d,\n  \"memo_misses\": %d,\n",
+            as->ir_count, count_instructions(as), as->memo_hits, as->memo_misses);
+    fprintf(fp, "  \"short_branches\": %d,\n  \"near_branches\": %d,\n  \"relax_passes\": %d,\n",
+            as->short_branches, as->near_branches, as->relax_passes);
+#ifndef ASSEMBLER_NO_STATS
+    const COUNTERS *c = &as->counters;
+    fprintf(fp, "  \"parsed\": %ld,\n  \"opcode_lookups\": %ld,\n  \"opcode_probes\": %ld,\n"
+                "  \"symbol_lookups\": %ld,\n  \"symbol_probes\": %ld,\n",
+            c->parsed, c->opcode_lookups, c->opcode_probes, c->symbol_lookups, c->symbol_probes);
+    fprintf(fp, "  \"macros\": {\"definitions\": %d, \"expansions\": %ld, \"reused\": %ld, "
+                "\"expanded_lines\": %ld, \"define_substitutions\": %ld, \"ms\": %.3f},\n",
+            as->macros.count, c->macro_expansions, c->macro_cached, c->expanded_lines, c->define_substitutions,
+            c->preprocess_ns / 1e6);
+#endif
+    fprintf(fp, "  \"symbols\": %d,\n  \"symbol_slots\": %u,\n", as->symbol_count,
+            as->symbol_index ? as->symbol_index_mask + 1 : 0);
+    fprintf(fp, "  \"bytes\": {\".text\": %u, \".data\": %u, \".bss\": %u},\n", as->section_size[SEC_TEXT],
+            as->section_size[SEC_DATA], as->section_size[SEC_BSS]);
+    size_t footprint = assembler_footprint(as);
+    fprintf(fp, "  \"memory\": {\"held\": %zu, \"allocated\": %zu, \"arena_in_use\": %zu, "
+                "\"arena_high_water\": %zu, \"arena_blocks\": %zu},\n", footprint,
+            footprint - as->footprint_start, as->arena.in_use, as->arena.high_water, as->arena.allocated);
+    fprintf(fp, "  \"peak_rss_kb\": %ld\n}\n", peak_rss_kb());
+    return fclose(fp) == 0;
+}
+
+// Inputs assembled by a pool of workers in one process. Each worker claims
+// the next file until none are left, reusing one ASSEMBLER (and its grown
+// buffers) across the files it takes. The opcode index is only read.
+typedef struct {
+    const char *const *inputs;
+    int count;
+    OutputFormat output_format;
+    const char *cache_dir;
+    int optimize_size;
+    atomic_int next;
+    atomic_int failed;
+
+    // Cache blocks and lines, over all files
+    atomic_int cache_blocks;
+    atomic_int cache_hits;
+    atomic_int cache_lines;
+    atomic_int cache_hit_lines;
+} BATCH;
+
+static void* batch_worker(void *arg) {
+    BATCH *batch = *(BATCH **)arg;
+    ASSEMBLER as;
+    init_assembler(&as);
+
+    for (;;) {
+        int i = atomic_fetch_add(&batch->next, 1);
+        if (i >= batch->count) break;
+
+        const char *input = batch->inputs[i];
+        as.output_format = batch->output_format;
+        as.cache.dir = batch->cache_dir;
+        as.optimize_size = batch->optimize_size;
+        as.input = input;
+        assembly_file(&as, input);
+        batch->cache_blocks += as.cache.blocks;
+        batch->cache_hits += as.cache.hits;
+        batch->cache_lines += as.cache.lines;
+        batch->cache_hit_lines += as.cache.hit_lines;
+        if (!as.error_count)
+            write_output(&as, input, NULL);
+        if (as.error_count) {
+            int errors = as.error_count;
+            fprintf(stderr, "%s: %d error%s, no output\n", input, errors, errors == 1 ? "" : "s");
+            batch->failed++;
+        }
+    }
+
+    free_assembler(&as);
+    return NULL;
+}
+
+// Assemble count files on up to threads workers, each file to its default
+// output name. Returns the number of files that failed.
+int assemble_batch(const char *const *inputs, int count, OutputFormat format, const char *cache_dir, int threads,
+                   int optimize_size) {
+    BATCH batch;
+    BATCH *workers[MAX_THREADS];
+
+    memset(&batch, 0, sizeof(batch));
+    batch.inputs = inputs;
+    batch.count = count;
+    batch.output_format = format;
+    batch.cache_dir = cache_dir;
+    batch.optimize_size = optimize_size;
+
+    if (threads > count) threads = count;
+    if (threads < 1) threads = 1;
+    for (int i = 0; i < threads; i++)
+        workers[i] = &batch;
+    run_parallel(batch_worker, workers, sizeof(BATCH *), threads);
+    if (cache_dir)
+        print_cache_stats(batch.cache_blocks, batch.cache_hits, batch.cache_lines, batch.cache_hit_lines);
+    return batch.failed;
+}
+
+// --serve: a resident assembler behind a local Unix domain socket. Each
+// worker thread keeps one ASSEMBLER, so the opcode index, the encoding
+// memo, the arena and every grown buffer stay warm from request to
+// request; a request costs a socket round trip instead of a process start.
+//
+// A connection carries any number of requests, one at a time. A request is
+// a SERVEREQUEST followed by name_len bytes of name (used in messages) and
+// source_len bytes of source; the reply is a SERVERESPONSE followed by
+// diag_len bytes of diagnostics and output_len bytes of object or binary
+// (none if there were errors). Fields are in host byte order: the socket
+// is local. incbin paths are relative to the server's directory.
+//
+// One thread polls the listening socket and every idle connection. A
+// connection with a request waiting is queued for the next free worker,
+// which answers that one request and hands the connection back, so any
+// number of clients can stay connected to a pool of -j workers.
+#define SERVE_MAGIC 0x31534d41u         // "AMS1"
+#define SERVE_MAX_SOURCE (1u << 30)
+#define SERVE_MAX_NAME 4096
+#define SERVE_TIMEOUT 10                // Seconds a request may stall, and a reply may take
+
+enum { SERVE_BIN = 1, SERVE_OPTIMIZE_SIZE = 2 };   // SERVEREQUEST flags
+
+typedef struct {
+    unsigned int magic;
+    unsigned int flags;
+    unsigned int name_len;
+    unsigned int source_len;
+} SERVEREQUEST;
+
+typedef struct {
+    unsigned int magic;
+    unsigned int errors;
+    unsigned int diag_len;
+    unsigned int output_len;
+} SERVERESPONSE;
+
+// Connections with a request waiting, shared by the poll thread and the
+// workers. A worker that has answered a request writes the connection's
+// descriptor to wake so that the poll thread watches it again.
+typedef struct {
+    int listen_fd;
+    int wake[2];                    // Pipe of answered connections
+    pthread_mutex_t lock;
+    pthread_cond_t ready;
+    int *fds;                       // Ring of queued connections
+    int head, count, capacity;
+    int stopped;                    // Poll thread gone: workers drain and stop
+} SERVEQUEUE;
+
+typedef struct {
+    SERVEQUEUE *queue;
+    ASSEMBLER as;
+    SECTIONBUF request;             // Name, NUL, then source; reused
+} SERVEWORKER;
+
+static const char *serve_socket;    // Removed on SIGINT/SIGTERM
+
+static void serve_stop(int sig) {
+    (void)sig;
+    unlink(serve_socket);
+    _exit(0);
+}
+
+// read() all of len bytes. Returns 0 on error or end of file.
+static int read_full(int fd, void *buf, size_t len) {
+    for (char *p = buf; len > 0; ) {
+        ssize_t n = read(fd, p, len);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return 0;
+        p += n;
+        len -= n;
+    }
+    return 1;
+}
+
+// Read len bytes from fd onto the end of buf. buf grows only as the bytes
+// arrive, so a header alone cannot make the server reserve memory. Returns
+// 1, 0 on error or end of file, or -1 if buf cannot grow.
+static int read_onto(int fd, SECTIONBUF *buf, size_t len) {
+    while (len > 0) {
+        size_t step = buf->size > 65536 ? buf->size : 65536;
+        if (step > len) step = len;
+        unsigned char *dest = buffer_try_reserve(buf, step);
+        if (!dest) return -1;
+        if (!read_full(fd, dest, step)) return 0;
+        buf->size += step;
+        len -= step;
+    }
+    return 1;
+}
+
+// Send pieces of a reply without blocking, waiting for the socket to
+// drain until deadline (clock_seconds(CLOCK_MONOTONIC)). Returns 0 on
+// error or when the deadline passes, so a client that does not read its
+// replies only holds a worker for SERVE_TIMEOUT seconds.
+static int send_reply(int fd, IOVLIST *list, double deadline) {
+    struct iovec *iov = list->items;
+    int left = list->count;
+    while (left > 0) {
+        struct msghdr msg = {0};
+        msg.msg_iov = iov;
+        msg.msg_iovlen = left < MAX_WRITE_IOVS ? left : MAX_WRITE_IOVS;
+        ssize_t n = sendmsg(fd, &msg, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            if (errno != EAGAIN && errno != EWOULDBLOCK) return 0;
+            int wait = (int)((deadline - clock_seconds(CLOCK_MONOTONIC)) * 1e3);
+            struct pollfd ready = { fd, POLLOUT, 0 };
+            if (wait <= 0 || (poll(&ready, 1, wait) < 0 && errno != EINTR)) return 0;
+            continue;
+        }
+        skip_written(&iov, &left, n);
+    }
+    return 1;
+}
+
+// Answer a request that will not be assembled with a single error
+static void serve_refuse(int fd, const char *message) {
+    SERVERESPONSE resp = { SERVE_MAGIC, 1, (unsigned int)strlen(message), 0 };
+    IOVLIST head = {0};
+    struct iovec items[2] = { { &resp, sizeof(resp) }, { (void *)message, resp.diag_len } };
+    head.items = items;
+    head.count = 2;
+    send_reply(fd, &head, clock_seconds(CLOCK_MONOTONIC) + SERVE_TIMEOUT);
+}
+
+// Read one request from fd, assemble it and send the reply. Returns 0 when
+// the client has gone, sent something that is not a request, or sent one
+// too large to take in (which is answered with an error first).
+static int serve_request(SERVEWORKER *w, int fd) {
+    SERVEREQUEST req;
+    if (!read_full(fd, &req, sizeof(req)) || req.magic != SERVE_MAGIC)
+        return 0;
+    if (req.name_len > SERVE_MAX_NAME || req.source_len > SERVE_MAX_SOURCE) {
+        serve_refuse(fd, "error: request too large\n");
+        return 0;
+    }
+
+    SECTIONBUF *buf = &w->request;
+    buf->size = 0;
+    int got = read_onto(fd, buf, req.name_len);
+    if (got > 0) {
+        unsigned char *nul = buffer_try_reserve(buf, 1);
+        if (nul) {
+            *nul = '\0';
+            buf->size++;
+            got = read_onto(fd, buf, req.source_len);
+        } else {
+            got = -1;
+        }
+    }
+    if (got < 0) {
+        char message[80];
+        snprintf(message, sizeof(message), "error: out of memory for a %u-byte source\n", req.source_len);
+        serve_refuse(fd, message);
+        return 0;                   // The rest of the request is still unread
+    }
+    if (!got)
+        return 0;
+    char *name = (char *)buf->data;
+    char *source = name + req.name_len + 1;
+
+    ASSEMBLER *as = &w->as;
+    as->output_format = req.flags & SERVE_BIN ? OUT_BIN : OUT_ELF32;
+    as->optimize_size = (req.flags & SERVE_OPTIMIZE_SIZE) != 0;
+    int ok = assemble_buffer(as, source, req.source_len, req.name_len ? name : NULL) && output_pieces(as);
+
+    SERVERESPONSE resp = { SERVE_MAGIC, as->error_count, as->diagnostics.size, 0 };
+    if (ok) {
+        for (int i = 0; i < as->iovs.count; i++)
+            resp.output_len += as->iovs.items[i].iov_len;
+    }
+    IOVLIST head = {0};
+    struct iovec items[2] = { { &resp, sizeof(resp) }, { as->diagnostics.data, resp.diag_len } };
+    head.items = items;
+    head.count = resp.diag_len ? 2 : 1;
+    double deadline = clock_seconds(CLOCK_MONOTONIC) + SERVE_TIMEOUT;
+    int sent = send_reply(fd, &head, deadline) && (!ok || send_reply(fd, &as->iovs, deadline));
+    unmap_refs(as);
+    return sent;
+}
+
+static void serve_enqueue(SERVEQUEUE *q, int fd) {
+    pthread_mutex_lock(&q->lock);
+    if (q->count == q->capacity) {
+        int capacity = q->capacity ? q->capacity * 2 : 64;
+        int *grown = malloc(capacity * sizeof(int));
+        if (!grown) {
+            fprintf(stderr, "Out of memory queueing connections!\n");
+            exit(1);
+        }
+        for (int i = 0; i < q->count; i++)
+            grown[i] = q->fds[(q->head + i) % q->capacity];
+        free(q->fds);
+        q->fds = grown;
+        q->head = 0;
+        q->capacity = capacity;
+    }
+    q->fds[(q->head + q->count++) % q->capacity] = fd;
+    pthread_cond_signal(&q->ready);
+    pthread_mutex_unlock(&q->lock);
+}
+
+// Add fd to the poll set, growing it as needed
+static struct pollfd* watch_fd(struct pollfd *fds, int *count, int *capacity, int fd) {
+    if (*count == *capacity) {
+        *capacity = *capacity ? *capacity * 2 : 64;
+        fds = realloc(fds, *capacity * sizeof(struct pollfd));
+        if (!fds) {
+            fprintf(stderr, "Out of memory watching connections!\n");
+            exit(1);
+        }
+    }
+    fds[(*count)++] = (struct pollfd){ fd, POLLIN, 0 };
+    return fds;
+}
+
+// Poll thread: accept connections and queue every idle one on which a
+// request (or a hang-up) arrives. Entries 0 and 1 of the poll set are the
+// listening socket and the wake pipe.
+static void* serve_poll(void *arg) {
+    SERVEQUEUE *q = arg;
+    struct pollfd *fds = NULL;
+    int count = 0, capacity = 0;
+    fds = watch_fd(fds, &count, &capacity, q->listen_fd);
+    fds = watch_fd(fds, &count, &capacity, q->wake[0]);
+
+    for (;;) {
+        if (poll(fds, count, -1) < 0) {
+            if (errno == EINTR) continue;
+            perror("poll");
+            break;
+        }
+        int idle = 2;
+        for (int i = 2; i < count; i++) {
+            if (fds[i].revents)
+                serve_enqueue(q, fds[i].fd);
+            else
+                fds[idle++] = fds[i];
+        }
+        count = idle;
+
+        short listening = fds[0].revents, woken = fds[1].revents;
+        if (woken & POLLIN) {
+            int answered[64];
+            ssize_t n = read(q->wake[0], answered, sizeof(answered));
+            for (ssize_t i = 0; i < n / (ssize_t)sizeof(int); i++)
+                fds = watch_fd(fds, &count, &capacity, answered[i]);
+        }
+        if (listening & POLLIN) {
+            int fd = accept(q->listen_fd, NULL, NULL);
+            if (fd >= 0) {
+                // A client that stops mid-request only holds a worker this
+                // long; replies have a deadline of their own (send_reply)
+                struct timeval timeout = { SERVE_TIMEOUT, 0 };
+                setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+                fds = watch_fd(fds, &count, &capacity, fd);
+            } else if (errno != EINTR && errno != ECONNABORTED && errno != EAGAIN && errno != EWOULDBLOCK) {
+                perror("accept");
+                break;
+            }
+        }
+    }
+
+    for (int i = 2; i < count; i++)
+        close(fds[i].fd);
+    free(fds);
+    pthread_mutex_lock(&q->lock);
+    q->stopped = 1;
+    pthread_cond_broadcast(&q->ready);
+    pthread_mutex_unlock(&q->lock);
+    return NULL;
+}
+
+// Worker: answer one queued request at a time, then give the connection
+// back to the poll thread
+static void* serve_worker(void *arg) {
+    SERVEWORKER *w = arg;
+    SERVEQUEUE *q = w->queue;
+    for (;;) {
+        pthread_mutex_lock(&q->lock);
+        while (q->count == 0 && !q->stopped)
+            pthread_cond_wait(&q->ready, &q->lock);
+        if (q->count == 0) {
+            pthread_mutex_unlock(&q->lock);
+            break;
+        }
+        int fd = q->fds[q->head];
+        q->head = (q->head + 1) % q->capacity;
+        q->count--;
+        pthread_mutex_unlock(&q->lock);
+
+        if (!serve_request(w, fd) || write(q->wake[1], &fd, sizeof(fd)) != sizeof(fd))
+            close(fd);
+    }
+    return NULL;
+}
+
+// Serve assemble requests on the Unix domain socket at path with a pool of
+// workers, until killed. An existing socket at path is replaced. The
+// format and -Os come with each request. Returns only on failure (0).
+int serve(const char *path, int workers) {
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        fprintf(stderr, "Socket path too long: %s\n", path);
+        return 0;
+    }
+    strcpy(addr.sun_path, path);
+
+    struct stat st;
+    if (lstat(path, &st) == 0 && S_ISSOCK(st.st_mode))
+        unlink(path);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || bind(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(fd, 128) < 0 ||
+        fcntl(fd, F_SETFL, O_NONBLOCK) < 0) {
+        fprintf(stderr, "Cannot listen on %s: %s\n", path, strerror(errno));
+        if (fd >= 0) close(fd);
+        return 0;
+    }
+    SERVEQUEUE queue = { .listen_fd = fd };
+    if (pipe(queue.wake) < 0) {
+        perror("pipe");
+        close(fd);
+        return 0;
+    }
+    pthread_mutex_init(&queue.lock, NULL);
+    pthread_cond_init(&queue.ready, NULL);
+    serve_socket = path;
+    signal(SIGPIPE, SIG_IGN);       // A client that hangs up only ends its connection
+    signal(SIGINT, serve_stop);
+    signal(SIGTERM, serve_stop);
+
+    if (workers < 1) workers = 1;
+    SERVEWORKER *pool = calloc(workers, sizeof(SERVEWORKER));
+    if (!pool) {
+        fprintf(stderr, "Out of memory starting server!\n");
+        exit(1);
+    }
+    for (int i = 0; i < workers; i++) {
+        pool[i].queue = &queue;
+        init_assembler(&pool[i].as);
+        pool[i].as.capture_diagnostics = 1;
+    }
+    pthread_t poller;
+    if (pthread_create(&poller, NULL, serve_poll, &queue) != 0) {
+        fprintf(stderr, "Cannot start the poll thread\n");
+        queue.stopped = 1;
+    } else {
+        fprintf(stderr, "serving on %s with %d worker%s\n", path, workers, workers == 1 ? "" : "s");
+        run_parallel(serve_worker, pool, sizeof(SERVEWORKER), workers);
+        pthread_join(poller, NULL);
+    }
+
+    for (int i = 0; i < workers; i++) {
+        free_assembler(&pool[i].as);
+        free(pool[i].request.data);
+    }
+    free(pool);
+    free(queue.fds);
+    pthread_cond_destroy(&queue.ready);
+    pthread_mutex_destroy(&queue.lock);
+    close(queue.wake[0]);
+    close(queue.wake[1]);
+    close(fd);
+    unlink(path);
+    return 0;
+}
+
+// Client side: connect to a --serve socket. Returns the descriptor, or -1.
+int connect_server(const char *path) {
+    struct sockaddr_un addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (strlen(path) >= sizeof(addr.sun_path)) {
+        errno = ENAMETOOLONG;
+        return -1;
+    }
+    strcpy(addr.sun_path, path);
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd >= 0 && connect(fd, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+        close(fd);
+        fd = -1;
+    }
+    return fd;
+}
+
+// Send one source to a server on fd and wait for the reply: the object or
+// binary replaces the contents of output and the messages those of
+// diagnostics (NUL-terminated). flags are SERVE_BIN and
+// SERVE_OPTIMIZE_SIZE. Returns the server's error count, or -1 if the
+// connection failed.
+int remote_assemble(int fd, const char *name, const char *source, size_t size, unsigned int flags,
+                    SECTIONBUF *output, SECTIONBUF *diagnostics) {
+    size_t name_len = name ? strlen(name) : 0;
+    if (size > SERVE_MAX_SOURCE || name_len > SERVE_MAX_NAME) {
+        errno = EFBIG;
+        return -1;
+    }
+    SERVEREQUEST req = { SERVE_MAGIC, flags, name_len, size };
+    IOVLIST list = {0};
+    struct iovec items[3] = { { &req, sizeof(req) }, { (void *)name, name_len }, { (void *)source, size } };
+    list.items = items;
+    list.count = 3;
+    SERVERESPONSE resp;
+    if (!write_iovs(fd, &list) || !read_full(fd, &resp, sizeof(resp)) || resp.magic != SERVE_MAGIC)
+        return -1;
+
+    diagnostics->size = 0;
+    char *text = (char *)buffer_reserve(diagnostics, resp.diag_len + 1, "diagnostics");
+    output->size = 0;
+    unsigned char *bytes = buffer_reserve(output, resp.output_len, "output");
+    if (!read_full(fd, text, resp.diag_len) || !read_full(fd, bytes, resp.output_len))
+        return -1;
+    text[resp.diag_len] = '\0';
+    diagnostics->size = resp.diag_len;
+    output->size = resp.output_len;
+    return resp.errors;
+}
+
+#ifndef ASSEMBLER_NO_MAIN
+void usage(const char *prog) {
+    fprintf(stderr, "Usage: %s [-f elf32|bin] [-o output] [-l listing] [-j threads] [-Os] [--opcodes table.csv] "
+                    "[--cache dir] [--stats | --stats-json file] [input.asm | @inputs.txt]...\n"
+                    "       %s [-j workers] [--opcodes table.csv] --serve socket\n", prog, prog);
+}
+
+// Input list for batch mode, from the command line and @response files
+typedef struct {
+    char **items;
+    int count;
+    int capacity;
+} INPUTLIST;
+
+static void add_input(INPUTLIST *list, char *name) {
+    if (list->count == list->capacity) {
+        int capacity = list->capacity ? list->capacity * 2 : 64;
+        char **grown = realloc(list->items, capacity * sizeof(char *));
+        if (!grown) {
+            fprintf(stderr, "Out of memory reading inputs!\n");
+            exit(1);
+        }
+        list->items = grown;
+        list->capacity = capacity;
+    }
+    list->items[list->count++] = name;
+}
+
+// Read a response file: one input path per line, blank lines ignored.
+// The paths point into the returned buffer, which the caller frees.
+static char* read_response_file(const char *filename, INPUTLIST *list) {
+    FILE *fp = fopen(filename, "rb");
+    if (!fp) {
+        perror("Cannot open response file");
+        return NULL;
+    }
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    char *text = size >= 0 ? malloc(size + 1) : NULL;
+    if (!text || fread(text, 1, size, fp) != (size_t)size) {
+        fprintf(stderr, "Cannot read response file %s\n", filename);
+        free(text);
+        fclose(fp);
+        return NULL;
+    }
+    fclose(fp);
+    text[size] = '\0';
+
+    for (char *line = text; *line; ) {
+        char *next = strchr(line, '\n');
+        if (next) *next++ = '\0';
+        else next = line + strlen(line);
+
+        STRVIEW path = view_trim(view_of(line));
+        if (path.len) {
+            ((char *)path.ptr)[path.len] = '\0';
+            add_input(list, (char *)path.ptr);
+        }
+        line = next;
+    }
+    return text;
+}
+
+int main(int argc, char **argv) {
+    ASSEMBLER assembler;
+    ASSEMBLER *as = &assembler;
+    INPUTLIST inputs = {0};
+    INPUTLIST responses = {0};     // Response file buffers the inputs point into
+    const char *opcode_file = NULL;
+    const char *output = NULL;
+    const char *listing = NULL;
+    const char *stats_json = NULL;
+    const char *serve_path = NULL;
+    int status = 0;
+
+    init_assembler(as);
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--opcodes") == 0 && i + 1 < argc) {
+            opcode_file = argv[++i];
+        } else if (strcmp(argv[i], "--cache") == 0 && i + 1 < argc) {
+            as->cache.dir = argv[++i];
+            if (mkdir(as->cache.dir, 0755) < 0 && errno != EEXIST) {
+                perror("Cannot create cache directory");
+                return 1;
+            }
+        } else if (strcmp(argv[i], "--stats") == 0) {
+            as->stats = 1;
+        } else if (strcmp(argv[i], "--stats-json") == 0 && i + 1 < argc) {
+            as->stats = 1;
+            stats_json = argv[++i];
+        } else if (strcmp(argv[i], "--serve") == 0 && i + 1 < argc) {
+            serve_path = argv[++i];
+        } else if (strcmp(argv[i], "-Os") == 0) {
+            as->optimize_size = 1;
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else if (strcmp(argv[i], "-l") == 0 && i + 1 < argc) {
+            listing = argv[++i];
+        } else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc) {
+            as->thread_count = atoi(argv[++i]);
+            if (as->thread_count < 1 || as->thread_count > MAX_THREADS) {
+                fprintf(stderr, "-j takes 1 to %d threads\n", MAX_THREADS);
+                return 1;
+            }
+        } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            const char *format = argv[++i];
+            if (strcmp(format, "elf32") == 0 || strcmp(format, "elf") == 0) {
+                as->output_format = OUT_ELF32;
+            } else if (strcmp(format, "bin") == 0) {
+                as->output_format = OUT_BIN;
+            } else {
+                fprintf(stderr, "Unknown output format '%s'\n", format);
+                return 1;
+            }
+        } else if (argv[i][0] == '@') {
+            char *text = read_response_file(argv[i] + 1, &inputs);
+            if (!text)
+                return 1;
+            add_input(&responses, text);
+        } else if (argv[i][0] == '-') {
+            usage(argv[0]);
+            return 1;
+        } else {
+            add_input(&inputs, argv[i]);
+        }
+    }
+    if (serve_path && (inputs.count || responses.count || output || listing || as->stats || as->cache.dir)) {
+        fprintf(stderr, "--serve takes no inputs: they come from the socket\n");
+        return 1;
+    }
+    if (inputs.count == 0 && responses.count == 0 && !serve_path)
+        add_input(&inputs, "input1.asm");
+
+    // -o and -l name one file's output; a batch writes each to its default name
+    if (inputs.count != 1 && (output || listing)) {
+        fprintf(stderr, "-o and -l take a single input file\n");
+        return 1;
+    }
+    if (inputs.count != 1 && as->stats) {
+        fprintf(stderr, "--stats takes a single input file\n");
+        return 1;
+    }
+
+    // The built-in table needs no loading; a CSV only overrides it
+    if (opcode_file && !load_opcode_table(opcode_file)) {
+        fprintf(stderr, "Failed to load %s\n", opcode_file);
+        return 1;
+    }
+
+    if (serve_path) {
+        // -j is the number of requests assembled at once
+        status = !serve(serve_path, as->thread_count);
+    } else if (inputs.count > 1) {
+        // Batch: -j is the number of files assembled at once
+        int failed = assemble_batch((const char *const *)inputs.items, inputs.count,
+                                    as->output_format, as->cache.dir, as->thread_count, as->optimize_size);
+        if (failed)
+            fprintf(stderr, "%d of %d files failed\n", failed, inputs.count);
+        status = failed != 0;
+    } else if (inputs.count == 1) {
+        const char *input = inputs.items[0];
+        if (listing) {
+            if (!open_listing(as, listing))
+                return 1;
+            listing_printf(as, "Line   Address   Machine Code             Assembly\n");
+            listing_printf(as, "---- ---------- ------------------------ -------------------------\n");
+        }
+        assembly_file(as, input);
+
+        if (listing) {
+            print_symbol_table(as);
+            listing_printf(as, "\nBranches: %d short, %d near (%d relaxation pass%s)\n",
+                           as->short_branches, as->near_branches, as->relax_passes, as->relax_passes == 1 ? "" : "es");
+            close_listing(as);
+        }
+        if (!as->error_count)
+            write_output(as, input, output);
+        if (as->cache.dir)
+            print_cache_stats(as->cache.blocks, as->cache.hits, as->cache.lines, as->cache.hit_lines);
+        if (stats_json) {
+            if (!write_stats_json(as, input, stats_json))
+                as->error_count++;
+        } else if (as->stats) {
+            print_stats(as, input);
+        }
+        status = as->error_count != 0;
+    }
+
+    free_assembler(as);
+    free(inputs.items);
+    for (int i = 0; i < responses.count; i++)
+        free(responses.items[i]);
+    free(responses.items);
+    free_opcode_table();
+    return status;
+}
+#endif
@@ -0,0 +1,84 @@
+// Library interface of the assembler: what a program that assembles
+// source held in memory needs, without the command line driver. Build
+// Assembler.c as an object and link it in:
+//     gcc -O2 -pthread -DASSEMBLER_NO_MAIN -c Assembler.c -o assembler.o
+//     gcc -O2 -pthread -o app app.c assembler.o
+// The context is opaque; everything it holds is reached through the
+// functions below.
+#ifndef ASSEMBLER_H
+#define ASSEMBLER_H
+
+#include <stddef.h>
+
+typedef enum {
+    SEC_NONE,
+    SEC_DATA,
+    SEC_TEXT,
+    SEC_BSS,
+    SEC_COUNT
+} Section;
+
+typedef enum {
+    SYM_LABEL,
+    SYM_VARIABLE,
+    SYM_EXTERN,
+    SYM_GLOBAL
+} SymType;
+
+typedef enum {
+    OUT_ELF32,      // ELF32 relocatable object
+    OUT_BIN         // Flat binary of raw section bytes
+} OutputFormat;
+
+// Everything one assembly owns. Separate contexts may be used on
+// different threads at once; one context must not be.
+typedef struct ASSEMBLER ASSEMBLER;
+
+// A symbol of the last assembly
+typedef struct {
+    const char *name;        // Valid until the next assembly
+    unsigned int address;    // Offset within its section
+    int size;                // Bytes, for data variables
+    Section section;         // SEC_NONE for externs
+    SymType type;
+    int defined;             // 0 for externs and undefined references
+    int is_global;
+} SYMBOLINFO;
+
+// A relocation of the last assembly: a field the linker must fill in
+typedef struct {
+    Section section;         // Section holding the field
+    unsigned int offset;     // Offset of the field within it
+    int type;                // R_386_32 or R_386_PC32
+    int symbol;              // Index for assembler_symbol()
+} RELOCINFO;
+
+// A context with the defaults of the command line (one thread, no -Os,
+// messages printed on stderr), or NULL if out of memory
+ASSEMBLER* new_assembler(void);
+void delete_assembler(ASSEMBLER *as);
+
+// threads: workers for large sources (-j); optimize_size: -Os;
+// capture_diagnostics: collect messages for assembler_diagnostics()
+// instead of printing them
+void set_assembler_options(ASSEMBLER *as, int threads, int optimize_size, int capture_diagnostics);
+
+// Replace the built-in opcode table with a CSV file (--opcodes), for all
+// contexts. Returns 0 on failure.
+int load_opcode_table(const char *filename);
+void free_opcode_table();
+
+// Assemble source text held in memory; name (may be NULL) prefixes
+// messages. The buffer must stay unchanged until the next assembly.
+// Returns 0 if there were errors.
+int assemble_buffer(ASSEMBLER *as, const char *source, size_t size, const char *name);
+
+// Results of the last assembly, valid until the next one
+const unsigned char* section_contents(ASSEMBLER *as, Section section, size_t *size);
+const char* assembler_diagnostics(ASSEMBLER *as);
+int assembler_symbol_count(ASSEMBLER *as);
+int assembler_symbol(ASSEMBLER *as, int index, SYMBOLINFO *info);
+int assembler_relocation_count(ASSEMBLER *as);
+int assembler_relocation(ASSEMBLER *as, int index, RELOCINFO *info);
+
+#endif
@@ -0,0 +1,1294 @@
+// Micro-benchmarks for the assembler's hot paths.
+//
+// Build (from the repository root, so opcode.csv is found):
+//     gcc -O2 -pthread -o asm_bench bench/bench.c
+// Run all benchmarks, or only the named ones:
+//     ./asm_bench [opcode|symbol|listing|tokenizer|parallel|batch|cache|memo|data|incbin|times|immsize|library|arena|serve|macro ...]
+// The batch, library and serve benchmarks also time one process per file
+// when the assembler has been built as ./assembler (or $ASSEMBLER).
+
+#define ASSEMBLER_NO_MAIN
+#include "../Assembler.c"
+#include "rss.h"
+
+#include <time.h>
+#include <spawn.h>
+#include <sys/wait.h>
+
+#define MAXLINE_LEGACY 1024
+
+extern char **environ;
+
+// Assembler state shared by the single-file benchmarks
+static ASSEMBLER bench_as;
+
+static double now_seconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// The original per-instruction lookup: reopen and rescan opcode.csv every call.
+static int legacy_search_opcode(char *mnemonic, const char *type, char *out)
+{
+    FILE *fp = fopen(OPCODE_FILE, "r");
+    if (!fp) return 0;
+
+    char row[128], col1[32], col2[8], col3[32];
+    for (int i = 0; mnemonic[i]; i++)
+        mnemonic[i] = toupper((unsigned char)mnemonic[i]);
+
+    if (fgets(row, sizeof(row), fp) == NULL) {
+        fclose(fp);
+        return 0;
+    }
+
+    while (fgets(row, sizeof(row), fp)) {
+        if (sscanf(row, "%31[^,],%7[^,],%31[^\n]", col1, col2, col3) != 3)
+            continue;
+        for (int i = 0; col1[i]; i++)
+            col1[i] = toupper((unsigned char)col1[i]);
+        if (strcmp(col1, mnemonic) == 0 && strcmp(col2, type) == 0) {
+            strcpy(out, col3);
+            fclose(fp);
+            return 1;
+        }
+    }
+
+    fclose(fp);
+    return 0;
+}
+
+// Typical instruction mix, plus a couple of misses
+static const char *opcode_queries[][2] = {
+    {"mov", "RR"}, {"mov", "RM"}, {"mov", "MR"}, {"mov", "RI"},
+    {"add", "RR"}, {"sub", "RI"}, {"push", "R"}, {"pop", "R"},
+    {"cmp", "RR"}, {"jne", "I"},  {"call", "I"}, {"ret", "NOOP"},
+    {"lea", "RM"}, {"xor", "RR"}, {"movsd", "NOOP"}, {"mov", "??"},
+};
+#define OPCODE_QUERY_COUNT (int)(sizeof(opcode_queries) / sizeof(opcode_queries[0]))
+
+static void bench_opcode()
+{
+    if (!load_opcode_table(OPCODE_FILE)) {
+        fprintf(stderr, "Failed to load %s\n", OPCODE_FILE);
+        return;
+    }
+
+    char mnemonic[32], out[32];
+    long hits = 0;
+
+    // Legacy scan: a few thousand lookups is plenty to get a stable rate
+    long legacy_iters = 20000;
+    double start = now_seconds();
+    for (long i = 0; i < legacy_iters; i++) {
+        strcpy(mnemonic, opcode_queries[i % OPCODE_QUERY_COUNT][0]);
+        hits += legacy_search_opcode(mnemonic, opcode_queries[i % OPCODE_QUERY_COUNT][1], out);
+    }
+    double legacy_time = now_seconds() - start;
+
+    long indexed_iters = 50000000;
+    start = now_seconds();
+    for (long i = 0; i < indexed_iters; i++) {
+        hits += find_opcode(opcode_queries[i % OPCODE_QUERY_COUNT][0],
+                            opcode_queries[i % OPCODE_QUERY_COUNT][1]) != NULL;
+    }
+    double indexed_time = now_seconds() - start;
+
+    start = now_seconds();
+    for (long i = 0; i < indexed_iters; i++) {
+        const char *mnemonic = opcode_queries[i % OPCODE_QUERY_COUNT][0];
+        hits += find_builtin_opcode(mnemonic, strlen(mnemonic),
+                                    opcode_queries[i % OPCODE_QUERY_COUNT][1]) != NULL;
+    }
+    double builtin_time = now_seconds() - start;
+
+    double legacy_rate = legacy_iters / legacy_time;
+    double indexed_rate = indexed_iters / indexed_time;
+    double builtin_rate = indexed_iters / builtin_time;
+    printf("opcode: %d entries\n", opcode_count);
+    printf("  csv scan (before):   %12.0f lookups/sec\n", legacy_rate);
+    printf("  runtime hash index:  %12.0f lookups/sec  (%.0fx)\n",
+           indexed_rate, indexed_rate / legacy_rate);
+    printf("  built-in perfect:    %12.0f lookups/sec  (%.0fx, hits=%ld)\n",
+           builtin_rate, builtin_rate / legacy_rate, hits);
+
+    free_opcode_table();
+}
+
+#define SYMBOL_BENCH_COUNT 1000000
+
+static void bench_symbol()
+{
+    ASSEMBLER *as = &bench_as;
+    char name[32];
+
+    reset_assembler(as);
+    double start = now_seconds();
+    for (int i = 0; i < SYMBOL_BENCH_COUNT; i++) {
+        snprintf(name, sizeof(name), "label_%d", i);
+        add_symbol(as, name, i, SYM_LABEL, SEC_TEXT, 0, 1);
+    }
+    double insert_time = now_seconds() - start;
+
+    long found = 0;
+    start = now_seconds();
+    for (int i = 0; i < SYMBOL_BENCH_COUNT; i++) {
+        snprintf(name, sizeof(name), "label_%d", (int)((i * 7919L) % SYMBOL_BENCH_COUNT));
+        found += find_symbol(as, name) != NULL;
+    }
+    double lookup_time = now_seconds() - start;
+
+    printf("symbol: %d symbols, index load factor %.2f\n",
+           as->symbol_count, as->symbol_count / (double)(as->symbol_index_mask + 1));
+    printf("  insert: %12.0f symbols/sec\n", SYMBOL_BENCH_COUNT / insert_time);
+    printf("  lookup: %12.0f lookups/sec  (found=%ld)\n", SYMBOL_BENCH_COUNT / lookup_time, found);
+
+    reset_assembler(as);
+}
+
+// Write a synthetic source of roughly `lines` lines: a .data block, then
+// .text with a label every 16 instructions. Returns the number of lines.
+static int write_synthetic_source(const char *path, int lines)
+{
+    static const char *insns[] = {
+        "    mov eax, ebx", "    add ecx, edx", "    sub esi, edi", "    mov eax, 42",
+        "    mov eax, [ebx]", "    mov ecx, [edx+8]", "    mov ebx, [eax+ebx*4+32]",
+        "    mov [ecx+12], edx", "    mov [eax+edi*8+40], ecx", "    push eax",
+        "    pop ebx", "    cmp eax, ebx", "    ; comment line", "",
+    };
+    FILE *fp = fopen(path, "w");
+    if (!fp) return 0;
+
+    int n = 0;
+    fprintf(fp, "section .data\n    count dd 10\nsection .text\n    global main\nmain:\n");
+    n += 5;
+    for (int block = 0; n < lines; block++) {
+        fprintf(fp, "block%d:\n", block);
+        n++;
+        for (int i = 0; i < 16; i++, n++)
+            fprintf(fp, "%s\n", insns[(block * 7 + i) % (int)(sizeof(insns) / sizeof(insns[0]))]);
+        fprintf(fp, "    jne block%d\n", block);
+        n++;
+    }
+    fclose(fp);
+    return n;
+}
+
+#define LISTING_BENCH_LINES 500000
+
+static void bench_listing()
+{
+    ASSEMBLER *as = &bench_as;
+    const char *path = "/tmp/asm_bench_listing.asm";
+    int lines = write_synthetic_source(path, LISTING_BENCH_LINES);
+    if (!lines) {
+        perror("Cannot write benchmark source");
+        return;
+    }
+
+    double start = now_seconds();
+    assembly_file(as, path);
+    double off_time = now_seconds() - start;
+
+    open_listing(as, "/dev/null");
+    start = now_seconds();
+    assembly_file(as, path);
+    print_symbol_table(as);
+    close_listing(as);
+    double on_time = now_seconds() - start;
+
+    printf("listing: %d lines\n", lines);
+    printf("  listing off: %12.0f lines/sec\n", lines / off_time);
+    printf("  listing on:  %12.0f lines/sec\n", lines / on_time);
+
+    remove(path);
+}
+
+// The original operand parsing: copy the line, strtok it on " ," and
+// classify the pieces with strstr-based string tests
+static int legacy_is_register(const char *s)
+{
+    return s[0] == 'e' && (strstr(s, "ax") || strstr(s, "bx") || strstr(s, "cx") || strstr(s, "dx") ||
+                           strstr(s, "si") || strstr(s, "di") || strstr(s, "sp") || strstr(s, "bp"));
+}
+
+static int legacy_is_immediate(const char *s)
+{
+    return isdigit((unsigned char)s[0]) || (s[0] == '-' && isdigit((unsigned char)s[1]));
+}
+
+static int legacy_parse_line(const char *line, char *type)
+{
+    char line_copy[MAXLINE_LEGACY], mnemonic[32], op1[32], op2[32];
+
+    mnemonic[0] = op1[0] = op2[0] = '\0';
+    strcpy(line_copy, line);
+    for (char *p = line_copy; *p; p++)
+        *p = tolower((unsigned char)*p);
+
+    char *tok = strtok(line_copy, " ,");
+    if (!tok) return 0;
+    strcpy(mnemonic, tok);
+    tok = strtok(NULL, " ,");
+    if (tok) {
+        strcpy(op1, tok);
+        tok = strtok(NULL, " ,");
+        if (tok) strcpy(op2, tok);
+    }
+
+    if (!op1[0] && !op2[0]) strcpy(type, "NOOP");
+    else if (!op2[0] && legacy_is_register(op1)) strcpy(type, "R");
+    else if (!op2[0] && legacy_is_immediate(op1)) strcpy(type, "I");
+    else if (legacy_is_register(op1) && legacy_is_register(op2)) strcpy(type, "RR");
+    else if (legacy_is_register(op1) && legacy_is_immediate(op2)) strcpy(type, "RI");
+    else if (op1[0] == '[' && legacy_is_register(op2)) strcpy(type, "MR");
+    else if (legacy_is_register(op1) && op2[0] == '[') strcpy(type, "RM");
+    else strcpy(type, "??");
+    return 1;
+}
+
+static const char *tokenizer_lines[] = {
+    "mov eax, ebx", "add ecx, edx", "sub esi, edi", "mov eax, 42",
+    "mov eax, [ebx]", "mov ecx, [edx+8]", "mov ebx, [eax+ebx*4+32]",
+    "mov [ecx+12], edx", "mov [eax+edi*8+40], ecx", "push eax",
+    "pop ebx", "cmp eax, ebx", "jne block17", "call printf", "ret",
+    "mov edx, [esi*2+16]",
+};
+#define TOKENIZER_LINE_COUNT (int)(sizeof(tokenizer_lines) / sizeof(tokenizer_lines[0]))
+#define TOKENIZER_BENCH_ITERS 10000000L
+
+static void bench_tokenizer()
+{
+    STRVIEW views[TOKENIZER_LINE_COUNT];
+    for (int i = 0; i < TOKENIZER_LINE_COUNT; i++)
+        views[i] = view_of(tokenizer_lines[i]);
+
+    long checksum = 0;
+    char type[8];
+    double start = now_seconds();
+    for (long i = 0; i < TOKENIZER_BENCH_ITERS; i++) {
+        legacy_parse_line(tokenizer_lines[i % TOKENIZER_LINE_COUNT], type);
+        checksum += type[0];
+    }
+    double legacy_time = now_seconds() - start;
+
+    STRVIEW mnemonic;
+    OPERAND op1, op2;
+    start = now_seconds();
+    for (long i = 0; i < TOKENIZER_BENCH_ITERS; i++) {
+        parse_instruction(views[i % TOKENIZER_LINE_COUNT], &mnemonic, &op1, &op2);
+        checksum += operand_type(&op1, &op2);
+    }
+    double lexer_time = now_seconds() - start;
+
+    printf("tokenizer: %ld instruction lines\n", TOKENIZER_BENCH_ITERS);
+    printf("  strtok + strstr: %12.0f lines/sec\n", TOKENIZER_BENCH_ITERS / legacy_time);
+    printf("  DFA lexer:       %12.0f lines/sec  (%.1fx, checksum=%ld)\n",
+           TOKENIZER_BENCH_ITERS / lexer_time, legacy_time / lexer_time, checksum);
+}
+
+// FNV-1a over the assembled sections and relocations, to check that every
+// thread count produces the same output
+static unsigned int output_checksum(const ASSEMBLER *as)
+{
+    unsigned int h = 2166136261u;
+    for (int s = 0; s < SEC_COUNT; s++) {
+        for (size_t i = 0; i < as->section_buf[s].size; i++) {
+            h ^= as->section_buf[s].data[i];
+            h *= 16777619u;
+        }
+    }
+    for (int i = 0; i < as->relocations.count; i++) {
+        h ^= as->relocations.items[i].offset ^ (as->relocations.items[i].symbol << 8);
+        h *= 16777619u;
+    }
+    return h;
+}
+
+#define PARALLEL_BENCH_LINES 2000000
+
+static void bench_parallel()
+{
+    static const int threads[] = {1, 2, 4, 8, 16};
+    ASSEMBLER *as = &bench_as;
+    const char *path = "/tmp/asm_bench_parallel.asm";
+    int lines = write_synthetic_source(path, PARALLEL_BENCH_LINES);
+    if (!lines) {
+        perror("Cannot write benchmark source");
+        return;
+    }
+
+    printf("parallel: %d lines, %ld cores online\n", lines, sysconf(_SC_NPROCESSORS_ONLN));
+    double base_time = 0;
+    unsigned int base_sum = 0;
+    for (int i = 0; i < (int)(sizeof(threads) / sizeof(threads[0])); i++) {
+        as->thread_count = threads[i];
+        assembly_file(as, path);    // Warm up the page cache and allocations
+
+        double start = now_seconds();
+        assembly_file(as, path);
+        double elapsed = now_seconds() - start;
+
+        unsigned int sum = output_checksum(as);
+        if (i == 0) {
+            base_time = elapsed;
+            base_sum = sum;
+        }
+        printf("  %2d threads: %12.0f lines/sec  (%.2fx, output %s)\n", threads[i], lines / elapsed,
+               base_time / elapsed, sum == base_sum ? "identical" : "DIFFERS");
+    }
+    as->thread_count = 1;
+
+    remove(path);
+}
+
+#define BATCH_BENCH_FILES 5000
+#define BATCH_BENCH_LINES 200
+
+// Run the assembler binary once per file, as a build without batch mode does
+static double spawn_per_file(const char *assembler, char **paths, int count)
+{
+    double start = now_seconds();
+    for (int i = 0; i < count; i++) {
+        char *args[] = {(char *)assembler, paths[i], NULL};
+        pid_t pid;
+        int status;
+        if (posix_spawn(&pid, assembler, NULL, NULL, args, environ) != 0 ||
+            waitpid(pid, &status, 0) < 0 || status != 0)
+            return -1;
+    }
+    return now_seconds() - start;
+}
+
+static void bench_batch()
+{
+    static const int threads[] = {1, 4, 16};
+    const char *dir = "/tmp/asm_bench_batch";
+    const char *assembler = getenv("ASSEMBLER") ? getenv("ASSEMBLER") : "./assembler";
+    char **paths = calloc(BATCH_BENCH_FILES, sizeof(char *));
+    char path[256];
+
+    mkdir(dir, 0755);
+    for (int i = 0; paths && i < BATCH_BENCH_FILES; i++) {
+        snprintf(path, sizeof(path), "%s/f%d.asm", dir, i);
+        paths[i] = strdup(path);
+        if (!paths[i] || !write_synthetic_source(paths[i], BATCH_BENCH_LINES)) {
+            perror("Cannot write benchmark source");
+            return;
+        }
+    }
+
+    printf("batch: %d files of %d lines, %ld cores online\n",
+           BATCH_BENCH_FILES, BATCH_BENCH_LINES, sysconf(_SC_NPROCESSORS_ONLN));
+    double spawn_time = access(assembler, X_OK) == 0 ?
+                        spawn_per_file(assembler, paths, BATCH_BENCH_FILES) : -1;
+    if (spawn_time > 0)
+        printf("  process per file: %10.0f files/sec\n", BATCH_BENCH_FILES / spawn_time);
+    else
+        printf("  process per file: skipped (%s not found)\n", assembler);
+
+    for (int i = 0; i < (int)(sizeof(threads) / sizeof(threads[0])); i++) {
+        double start = now_seconds();
+        int failed = assemble_batch((const char *const *)paths, BATCH_BENCH_FILES, OUT_ELF32, NULL, threads[i], 0);
+        double elapsed = now_seconds() - start;
+        printf("  batch, %2d workers: %9.0f files/sec", threads[i], BATCH_BENCH_FILES / elapsed);
+        if (spawn_time > 0) printf("  (%.1fx)", spawn_time / elapsed);
+        printf("%s\n", failed ? "  FAILED" : "");
+    }
+
+    for (int i = 0; i < BATCH_BENCH_FILES; i++) {
+        char *object = output_name(paths[i], ".o");
+        remove(paths[i]);
+        remove(object);
+        free(object);
+        free(paths[i]);
+    }
+    free(paths);
+    rmdir(dir);
+}
+
+#define CACHE_BENCH_LINES 100000
+
+// Replace line `line` (1-based) of a file with text
+static int edit_line(const char *path, int line, const char *text)
+{
+    FILE *fp = fopen(path, "rb");
+    if (!fp) return 0;
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    char *source = malloc(size);
+    int ok = source && fread(source, 1, size, fp) == (size_t)size;
+    fclose(fp);
+
+    char *start = source, *end = source + size;
+    for (int i = 1; ok && i < line; i++) {
+        start = memchr(start, '\n', end - start);
+        if (!start) ok = 0;
+        else start++;
+    }
+    char *stop = ok ? memchr(start, '\n', end - start) : NULL;
+    if (ok && stop && (fp = fopen(path, "wb")) != NULL) {
+        fwrite(source, 1, start - source, fp);
+        fputs(text, fp);
+        fwrite(stop, 1, end - stop, fp);
+        fclose(fp);
+    } else {
+        ok = 0;
+    }
+    free(source);
+    return ok;
+}
+
+static double time_assembly(ASSEMBLER *as, const char *path)
+{
+    double start = now_seconds();
+    assembly_file(as, path);
+    return now_seconds() - start;
+}
+
+static void bench_cache()
+{
+    ASSEMBLER *as = &bench_as;
+    const char *path = "/tmp/asm_bench_cache.asm";
+    const char *dir = "/tmp/asm_bench_cache";
+    int lines = write_synthetic_source(path, CACHE_BENCH_LINES);
+    if (!lines) {
+        perror("Cannot write benchmark source");
+        return;
+    }
+    mkdir(dir, 0755);
+
+    time_assembly(as, path);    // Warm up the page cache and allocations
+    double plain_time = time_assembly(as, path);
+
+    as->cache.dir = dir;
+    double cold_time = time_assembly(as, path);
+    double warm_time = time_assembly(as, path);
+    unsigned int warm_sum = output_checksum(as);
+
+    if (!edit_line(path, lines / 2, "    mov eax, 7")) {
+        perror("Cannot edit benchmark source");
+        as->cache.dir = NULL;
+        return;
+    }
+    double edit_time = time_assembly(as, path);
+    unsigned int edit_sum = output_checksum(as);
+    BLOCKCACHE stats = as->cache;
+
+    as->cache.dir = NULL;
+    time_assembly(as, path);
+    int identical = output_checksum(as) == edit_sum && edit_sum != warm_sum;
+
+    printf("cache: %d lines, one line edited\n", lines);
+    printf("  no cache:        %8.1f ms\n", plain_time * 1e3);
+    printf("  cold cache:      %8.1f ms\n", cold_time * 1e3);
+    printf("  unchanged:       %8.1f ms  (%.2fx)\n", warm_time * 1e3, plain_time / warm_time);
+    printf("  one line edited: %8.1f ms  (%.2fx, %d of %d blocks reused, output %s)\n",
+           edit_time * 1e3, plain_time / edit_time, stats.hits, stats.blocks,
+           identical ? "identical" : "DIFFERS");
+
+    char *cache = cache_path(dir, path);
+    if (cache) remove(cache);
+    free(cache);
+    rmdir(dir);
+    remove(path);
+}
+
+#define MEMO_BENCH_LINES 1000000
+
+// Stack-frame instructions of the kind generated code repeats
+static const char *repetitive_insns[] = {
+    "    push ebp", "    mov ebp, esp", "    sub esp, 16", "    mov eax, [ebp-8]",
+    "    mov [ebp-4], eax", "    push eax", "    pop ecx", "    mov edx, [ebp+8]",
+    "    add eax, edx", "    mov [ebp-8], eax", "    xor eax, eax", "    mov eax, [ebp-4]",
+    "    cmp eax, ecx", "    mov ecx, [ebp+12]", "    mov [ebp-12], ecx", "    push ecx",
+    "    mov esp, ebp", "    pop ebp", "    lea eax, [ebp-16]", "    mov ebx, [eax+ecx*4+8]",
+};
+#define REPETITIVE_INSN_COUNT (int)(sizeof(repetitive_insns) / sizeof(repetitive_insns[0]))
+
+// Generated-code style source: those instructions over and over, with a
+// label, a call and a ret every 33 lines
+static int write_repetitive_source(const char *path, int lines)
+{
+    FILE *fp = fopen(path, "w");
+    if (!fp) return 0;
+
+    int n = 0;
+    fprintf(fp, "section .text\n    global main\nmain:\n");
+    n += 3;
+    for (int block = 0; n < lines; block++) {
+        fprintf(fp, "f%d:\n", block);
+        n++;
+        for (int i = 0; i < 30; i++, n++)
+            fprintf(fp, "%s\n", repetitive_insns[(block + i) % REPETITIVE_INSN_COUNT]);
+        fprintf(fp, "    call f%d\n    ret\n", block);
+        n += 2;
+    }
+    fclose(fp);
+    return n;
+}
+
+static void bench_memo()
+{
+    ASSEMBLER *as = &bench_as;
+    const char *path = "/tmp/asm_bench_memo.asm";
+    int lines = write_repetitive_source(path, MEMO_BENCH_LINES);
+    if (!lines) {
+        perror("Cannot write benchmark source");
+        return;
+    }
+
+    as->memo_size = 0;
+    time_assembly(as, path);    // Warm up the page cache and allocations
+    double off_time = time_assembly(as, path);
+    unsigned int off_sum = output_checksum(as);
+
+    as->memo_size = MEMO_SLOTS;
+    double on_time = time_assembly(as, path);
+    unsigned int on_sum = output_checksum(as);
+
+    printf("memo: %d lines, %d memo slots\n", lines, MEMO_SLOTS);
+    printf("  assembly, memo off:   %12.0f lines/sec\n", lines / off_time);
+    printf("  assembly, memo on:    %12.0f lines/sec  (%.2fx, %d hits, %d misses, output %s)\n",
+           lines / on_time, off_time / on_time, as->memo_hits, as->memo_misses,
+           on_sum == off_sum ? "identical" : "DIFFERS");
+
+    // The instruction step alone, without the rest of pass 1
+    ENCODEMEMO memo = {0};
+    CHUNK chunk = {0};
+    chunk.as = as;
+    chunk.memo = &memo;
+    IRNODE node;
+    long checksum = 0;
+    int count = REPETITIVE_INSN_COUNT;
+    STRVIEW views[REPETITIVE_INSN_COUNT];
+    for (int i = 0; i < count; i++)
+        views[i] = view_trim(view_of(repetitive_insns[i]));
+
+    double start = now_seconds();
+    for (long i = 0; i < TOKENIZER_BENCH_ITERS; i++) {
+        memset(&node, 0, sizeof(node));
+        checksum += Assembly_line(as, views[i % count], &node) ? node.size : 0;
+    }
+    double line_time = now_seconds() - start;
+
+    start = now_seconds();
+    for (long i = 0; i < TOKENIZER_BENCH_ITERS; i++) {
+        memset(&node, 0, sizeof(node));
+        checksum -= assemble_memoized(&chunk, views[i % count], &node) ? node.size : 0;
+    }
+    double memo_time = now_seconds() - start;
+    printf("  Assembly_line():      %12.0f lines/sec\n", TOKENIZER_BENCH_ITERS / line_time);
+    printf("  through the memo:     %12.0f lines/sec  (%.2fx, sizes %s)\n",
+           TOKENIZER_BENCH_ITERS / memo_time, line_time / memo_time, checksum ? "DIFFER" : "match");
+    free(memo.entries);
+
+    remove(path);
+}
+
+#define DATA_BENCH_BYTES (64 << 20)
+#define DATA_BENCH_VALUES 16
+
+// Lookup-table style .data: rows of dd/dw/dq values in decimal and hex,
+// with a db string every 16 rows. Returns the source size in bytes.
+static long write_data_source(const char *path, long bytes)
+{
+    FILE *fp = fopen(path, "w");
+    if (!fp) return 0;
+
+    unsigned int seed = 12345;
+    long n = fprintf(fp, "section .data\n");
+    for (int row = 0; n < bytes; row++) {
+        if (row % 16 == 15) {
+            n += fprintf(fp, "msg%d db 'Lookup table row %d, checksum follows', 13, 10, 0\n", row, row);
+            continue;
+        }
+        static const char *directives[] = { "dd", "dd", "dw", "dq" };
+        int kind = row % 4;
+        n += fprintf(fp, "t%d %s ", row, directives[kind]);
+        for (int i = 0; i < DATA_BENCH_VALUES; i++) {
+            seed = seed * 1103515245 + 12345;
+            unsigned int v = seed >> 1;
+            if (kind == 2)
+                n += fprintf(fp, i % 2 ? "0x%X, " : "%u, ", v & 0xFFFF);
+            else if (kind == 3)
+                n += fprintf(fp, "%llu, ", (unsigned long long)v * 2654435761u);
+            else
+                n += fprintf(fp, i % 4 == 3 ? "-%u, " : "%u, ", v >> (i % 3) * 8);
+        }
+        n += fprintf(fp, "0\n");
+    }
+    fclose(fp);
+    return n;
+}
+
+static void bench_data()
+{
+    ASSEMBLER *as = &bench_as;
+    const char *path = "/tmp/asm_bench_data.asm";
+    long bytes = write_data_source(path, DATA_BENCH_BYTES);
+    if (!bytes) {
+        perror("Cannot write benchmark source");
+        return;
+    }
+
+    time_assembly(as, path);    // Warm up the page cache and allocations
+    double elapsed = time_assembly(as, path);
+    printf("data: %.1f MB of db/dw/dd/dq lines, %zu bytes of .data\n", bytes / 1e6,
+           as->section_buf[SEC_DATA].size);
+    printf("  assembly:              %8.1f MB/s\n", bytes / elapsed / 1e6);
+
+    // The number parser alone over the same text, against strtoull()
+    if (!read_source(as, path)) {
+        remove(path);
+        return;
+    }
+    const char *begin = as->source, *end = as->source + as->source_size;
+    unsigned long long sum = 0, value;
+    int negative;
+    double start = now_seconds();
+    for (const char *p = begin + 1; p < end; p++) {
+        if (p[-1] != ' ' || !isdigit((unsigned char)*p)) continue;
+        const char *after = parse_data_number(p, end, &value, &negative);
+        if (after) {
+            sum += value;
+            p = after;
+        }
+    }
+    double fast_time = now_seconds() - start;
+
+    start = now_seconds();
+    for (const char *p = begin + 1; p < end; p++) {
+        if (p[-1] != ' ' || !isdigit((unsigned char)*p)) continue;
+        char *after;
+        int base = p[0] == '0' && p[1] == 'x' ? 16 : 10;
+        sum -= strtoull(p, &after, base);
+        p = after;
+    }
+    double strtoull_time = now_seconds() - start;
+    free_source(as);
+
+    printf("  strtoull():            %8.1f MB/s\n", bytes / strtoull_time / 1e6);
+    printf("  parse_data_number():   %8.1f MB/s  (%.2fx, values %s)\n", bytes / fast_time / 1e6,
+           strtoull_time / fast_time, sum ? "DIFFER" : "match");
+
+    remove(path);
+}
+
+#define INCBIN_BENCH_BYTES (512L << 20)
+
+static void bench_incbin()
+{
+    ASSEMBLER *as = &bench_as;
+    const char *blob = "/tmp/asm_bench_blob.bin";
+    const char *path = "/tmp/asm_bench_incbin.asm";
+    const char *output = "/tmp/asm_bench_incbin.o";
+
+    // A 512 MB blob of pseudo-random bytes, written 1 MB at a time
+    size_t chunk = 1 << 20;
+    unsigned int *block = malloc(chunk);
+    FILE *fp = block ? fopen(blob, "wb") : NULL;
+    if (!fp) {
+        perror("Cannot write benchmark blob");
+        free(block);
+        return;
+    }
+    unsigned int seed = 12345;
+    for (long done = 0; done < INCBIN_BENCH_BYTES; done += chunk) {
+        for (size_t i = 0; i < chunk / sizeof(unsigned int); i++)
+            block[i] = seed = seed * 1103515245 + 12345;
+        fwrite(block, 1, chunk, fp);
+    }
+    fclose(fp);
+    free(block);
+
+    fp = fopen(path, "w");
+    if (!fp) {
+        perror("Cannot write benchmark source");
+        remove(blob);
+        return;
+    }
+    fprintf(fp, "section .data\nheader dd 0x46574D31, %ld\nfirmware: incbin \"%s\"\n"
+                "section .text\n    global main\nmain:\n    ret\n", INCBIN_BENCH_BYTES, blob);
+    fclose(fp);
+
+    // Assemble and write the object, then the same bytes copied through a
+    // buffer as an assembler that reads the blob would
+    double start = now_seconds();
+    assembly_file(as, path);
+    int ok = as->error_count == 0 && write_output(as, path, output);
+    double incbin_time = now_seconds() - start;
+
+    struct stat st;
+    ok = ok && stat(output, &st) == 0 && st.st_size > INCBIN_BENCH_BYTES;
+
+    start = now_seconds();
+    int in = open(blob, O_RDONLY), out = open(output, O_WRONLY | O_TRUNC);
+    unsigned char *copy = malloc(INCBIN_BENCH_BYTES);
+    if (in >= 0 && out >= 0 && copy) {
+        ssize_t n = 0;
+        for (long done = 0; done < INCBIN_BENCH_BYTES; done += n) {
+            n = read(in, copy + done, INCBIN_BENCH_BYTES - done);
+            if (n <= 0) break;
+        }
+        for (long done = 0; done < INCBIN_BENCH_BYTES; done += n) {
+            n = write(out, copy + done, INCBIN_BENCH_BYTES - done);
+            if (n <= 0) break;
+        }
+    }
+    double copy_time = now_seconds() - start;
+    free(copy);
+    if (in >= 0) close(in);
+    if (out >= 0) close(out);
+
+    printf("incbin: %ld MB blob\n", INCBIN_BENCH_BYTES >> 20);
+    printf("  read + write through a buffer: %8.1f ms  %8.0f MB/s\n",
+           copy_time * 1e3, INCBIN_BENCH_BYTES / copy_time / 1e6);
+    printf("  assemble + write with incbin:  %8.1f ms  %8.0f MB/s  (%.2fx, output %s)\n",
+           incbin_time * 1e3, INCBIN_BENCH_BYTES / incbin_time / 1e6, copy_time / incbin_time,
+           ok ? "ok" : "FAILED");
+
+    remove(output);
+    remove(path);
+    remove(blob);
+}
+
+// Immediate forms that save bytes in the last assembly: 83 /n ib rather
+// than 81 /n id, and (-Os) xor reg, reg rather than mov reg, 0. Each is
+// 3 bytes shorter.
+static void count_short_immediates(ASSEMBLER *as, int *imm8, int *xors)
+{
+    *imm8 = *xors = 0;
+    for (int i = 0; i < as->ir_count; i++) {
+        const IRNODE *node = &as->ir[i];
+        if (node->kind != IR_INSN) continue;
+        if ((node->type == OPT_RI || node->type == OPT_MI) && node->opcode->bytes[0] == 0x83 &&
+            node->op2.imm >= -128 && node->op2.imm <= 127)
+            (*imm8)++;
+        else if (node->type == OPT_RR && node->opcode->bytes[0] == 0x31 &&
+                 view_starts_with(view_trim((STRVIEW){ node->text, node->text_len }), "mov"))
+            (*xors)++;
+    }
+}
+
+#define IMMSIZE_BENCH_LINES 100000
+
+// .text size of the benchmark sources with the short immediate forms,
+// against imm32 everywhere, and with -Os
+static void bench_immsize()
+{
+    ASSEMBLER *as = &bench_as;
+    const char *synthetic = "/tmp/asm_bench_immsize.asm";
+    const char *repetitive = "/tmp/asm_bench_immsize_rep.asm";
+    if (!write_synthetic_source(synthetic, IMMSIZE_BENCH_LINES) ||
+        !write_repetitive_source(repetitive, IMMSIZE_BENCH_LINES)) {
+        perror("Cannot write benchmark source");
+        return;
+    }
+    const char *corpus[] = { "input1.asm", synthetic, repetitive };
+    long total_imm32 = 0, total_default = 0, total_os = 0;
+
+    printf("immsize: .text bytes with imm32 only, imm8 where it fits, and -Os\n");
+    for (int i = 0; i < 3; i++) {
+        int imm8, xors;
+        as->optimize_size = 0;
+        assembly_file(as, corpus[i]);
+        count_short_immediates(as, &imm8, &xors);
+        long plain = as->section_size[SEC_TEXT];
+        long imm32 = plain + 3L * imm8;
+
+        as->optimize_size = 1;
+        assembly_file(as, corpus[i]);
+        count_short_immediates(as, &imm8, &xors);
+        long os = as->section_size[SEC_TEXT];
+        as->optimize_size = 0;
+
+        printf("  %-32s %9ld  %9ld (-%.1f%%)  %9ld (-%.1f%%, %d xor)\n", corpus[i], imm32,
+               plain, 100.0 * (imm32 - plain) / imm32, os, 100.0 * (imm32 - os) / imm32, xors);
+        total_imm32 += imm32;
+        total_default += plain;
+        total_os += os;
+    }
+    printf("  %-32s %9ld  %9ld (-%.1f%%)  %9ld (-%.1f%%)\n", "total", total_imm32, total_default,
+           100.0 * (total_imm32 - total_default) / total_imm32, total_os,
+           100.0 * (total_imm32 - total_os) / total_imm32);
+
+    remove(synthetic);
+    remove(repetitive);
+}
+
+// times counts from a thousand to hundreds of millions: memory should not
+// grow with the count, only the time to write the output
+static void bench_times()
+{
+    ASSEMBLER *as = &bench_as;
+    const char *path = "/tmp/asm_bench_times.asm";
+    const char *output = "/tmp/asm_bench_times.o";
+    static const unsigned int counts[] = { 1000, 1000000, 100000000, 300000000 };
+
+    printf("times: 'times N db 0x5A' in .data and 'times N nop' in .text\n");
+    for (size_t i = 0; i < sizeof(counts) / sizeof(counts[0]); i++) {
+        FILE *fp = fopen(path, "w");
+        if (!fp) {
+            perror("Cannot write benchmark source");
+            return;
+        }
+        fprintf(fp, "section .data\nfill times %u db 0x5A\nsection .text\n    global main\n"
+                    "main:\n    times %u nop\n    ret\n", counts[i], counts[i]);
+        fclose(fp);
+
+        reset_rss_high_water();
+        long before = rss_high_water_kb();
+        double start = now_seconds();
+        assembly_file(as, path);
+        int ok = as->error_count == 0 && write_output(as, path, output);
+        double elapsed = now_seconds() - start;
+
+        struct stat st;
+        ok = ok && stat(output, &st) == 0 && st.st_size > 2 * (off_t)counts[i];
+        printf("  N = %9u: %8.1f ms  %8.0f MB/s  peak RSS +%6ld KB  (output %s)\n",
+               counts[i], elapsed * 1e3, 2.0 * counts[i] / elapsed / 1e6,
+               rss_high_water_kb() - before, ok ? "ok" : "FAILED");
+        remove(output);
+    }
+    remove(path);
+}
+
+#define LIBRARY_BENCH_CALLS 100000
+#define LIBRARY_BENCH_SPAWNS 500
+#define LIBRARY_BENCH_THREADS 4
+
+// A function of the kind a code generator hands over one at a time
+static const char library_snippet[] =
+    "section .data\n"
+    "fmt db \"%d\", 10, 0\n"
+    "section .text\n"
+    "    global square\n"
+    "    extern printf\n"
+    "square:\n"
+    "    push ebp\n"
+    "    mov ebp, esp\n"
+    "    mov eax, [ebp+8]\n"
+    "    add eax, eax\n"
+    "    push eax\n"
+    "    push fmt\n"
+    "    call printf\n"
+    "    add esp, 8\n"
+    "    cmp eax, 0\n"
+    "    jne done\n"
+    "    xor eax, eax\n"
+    "done:\n"
+    "    pop ebp\n"
+    "    ret\n";
+
+typedef struct {
+    int calls;
+    unsigned int checksum;
+    int failed;
+} LIBRARYJOB;
+
+// One context per thread, reused for every call
+static void* library_worker(void *arg)
+{
+    LIBRARYJOB *job = arg;
+    ASSEMBLER as;
+    init_assembler(&as);
+    as.capture_diagnostics = 1;
+    for (int i = 0; i < job->calls; i++) {
+        size_t size;
+        job->failed += !assemble_buffer(&as, library_snippet, sizeof(library_snippet) - 1, NULL);
+        const unsigned char *text = section_contents(&as, SEC_TEXT, &size);
+        job->checksum = 0;
+        for (size_t j = 0; j < size; j++)
+            job->checksum = job->checksum * 31 + text[j];
+    }
+    free_assembler(&as);
+    return NULL;
+}
+
+// Snippets assembled buffer to buffer through the library, on one and on
+// several threads, against writing each to a file for a new process
+static void bench_library()
+{
+    const char *assembler = getenv("ASSEMBLER") ? getenv("ASSEMBLER") : "./assembler";
+    const char *path = "/tmp/asm_bench_snippet.asm";
+    int lines = 0;
+    for (const char *p = library_snippet; *p; p++)
+        lines += *p == '\n';
+
+    printf("library: a %d-line snippet\n", lines);
+    FILE *fp = fopen(path, "w");
+    double spawn_time = -1;
+    if (fp && fputs(library_snippet, fp) >= 0 && fclose(fp) == 0 && access(assembler, X_OK) == 0) {
+        char *paths[LIBRARY_BENCH_SPAWNS];
+        for (int i = 0; i < LIBRARY_BENCH_SPAWNS; i++)
+            paths[i] = (char *)path;
+        spawn_time = spawn_per_file(assembler, paths, LIBRARY_BENCH_SPAWNS) / LIBRARY_BENCH_SPAWNS;
+    }
+    if (spawn_time > 0)
+        printf("  process per snippet: %8.1f us/call\n", spawn_time * 1e6);
+    else
+        printf("  process per snippet: skipped (%s not found)\n", assembler);
+
+    for (int threads = 1; threads <= LIBRARY_BENCH_THREADS; threads *= LIBRARY_BENCH_THREADS) {
+        LIBRARYJOB jobs[LIBRARY_BENCH_THREADS];
+        memset(jobs, 0, sizeof(jobs));
+        for (int i = 0; i < threads; i++)
+            jobs[i].calls = LIBRARY_BENCH_CALLS / threads;
+        double start = now_seconds();
+        run_parallel(library_worker, jobs, sizeof(LIBRARYJOB), threads);
+        double per_call = (now_seconds() - start) / LIBRARY_BENCH_CALLS;
+
+        int same = 1, failed = 0;
+        for (int i = 0; i < threads; i++) {
+            same &= jobs[i].checksum == jobs[0].checksum;
+            failed += jobs[i].failed;
+        }
+        printf("  library, %d thread%s:  %8.2f us/call", threads, threads > 1 ? "s" : " ", per_call * 1e6);
+        if (spawn_time > 0) printf("  (%.0fx)", spawn_time / per_call);
+        printf("%s%s\n", same ? "" : "  OUTPUT DIFFERS", failed ? "  FAILED" : "");
+    }
+
+    char *object = output_name(path, ".o");
+    remove(object);
+    free(object);
+    remove(path);
+}
+
+#define SERVE_BENCH_REQUESTS 20000
+#define SERVE_BENCH_CONNECTS 5000
+#define SERVE_BENCH_SPAWNS 500
+#define SERVE_BENCH_LINES 2000
+
+static int compare_doubles(const void *a, const void *b)
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Sort n latencies and print their median, 99th percentile and maximum
+static void print_latency(const char *label, double *times, int n)
+{
+    qsort(times, n, sizeof(double), compare_doubles);
+    printf("  %-28s p50 %8.1f us  p99 %8.1f us  max %8.1f us  (%d requests)\n", label,
+           times[(n - 1) / 2] * 1e6, times[(int)((n - 1) * 0.99)] * 1e6, times[n - 1] * 1e6, n);
+}
+
+// Latency of one request at a time to a server, over one connection or a
+// new connection per request. Returns 0 if a request failed.
+static int serve_requests(const char *socket_path, const char *source, size_t size, int count, int reconnect,
+                          double *times)
+{
+    SECTIONBUF output = {0}, diagnostics = {0};
+    int fd = -1, ok = 1;
+    for (int i = 0; ok && i < count; i++) {
+        double start = now_seconds();
+        if (fd < 0) fd = connect_server(socket_path);
+        ok = fd >= 0 && remote_assemble(fd, "bench.asm", source, size, 0, &output, &diagnostics) == 0 &&
+             output.size > 0;
+        if (reconnect && fd >= 0) {
+            close(fd);
+            fd = -1;
+        }
+        times[i] = now_seconds() - start;
+    }
+    if (fd >= 0) close(fd);
+    free(output.data);
+    free(diagnostics.data);
+    return ok;
+}
+
+// Request latency against an assembler server (--serve) started in a
+// child process with one worker: the library snippet over a kept
+// connection and with a connect per request, a larger source, and for
+// comparison a new process per snippet
+static void bench_serve()
+{
+    const char *assembler = getenv("ASSEMBLER") ? getenv("ASSEMBLER") : "./assembler";
+    const char *socket_path = "/tmp/asm_bench.sock";
+    const char *path = "/tmp/asm_bench_serve.asm";
+    double *times = malloc(SERVE_BENCH_REQUESTS * sizeof(double));
+    if (!times) return;
+
+    pid_t server = fork();
+    if (server == 0) {
+        freopen("/dev/null", "w", stderr);
+        serve(socket_path, 1);
+        _exit(1);
+    }
+    int fd = -1;
+    for (int tries = 0; server > 0 && fd < 0 && tries < 200; tries++) {
+        fd = connect_server(socket_path);
+        if (fd < 0) usleep(10000);
+    }
+    if (fd < 0) {
+        printf("serve: cannot start a server on %s\n", socket_path);
+        if (server > 0) kill(server, SIGTERM);
+        free(times);
+        return;
+    }
+    close(fd);
+
+    printf("serve: one worker, one request at a time\n");
+    size_t snippet_size = sizeof(library_snippet) - 1;
+    if (serve_requests(socket_path, library_snippet, snippet_size, SERVE_BENCH_REQUESTS, 0, times))
+        print_latency("snippet, kept connection:", times, SERVE_BENCH_REQUESTS);
+    if (serve_requests(socket_path, library_snippet, snippet_size, SERVE_BENCH_CONNECTS, 1, times))
+        print_latency("snippet, connect each:", times, SERVE_BENCH_CONNECTS);
+
+    int lines = write_synthetic_source(path, SERVE_BENCH_LINES);
+    SECTIONBUF source = {0};
+    FILE *fp = lines ? fopen(path, "rb") : NULL;
+    if (fp) {
+        source.size = fread(buffer_reserve(&source, SERVE_BENCH_LINES * 64, "source"), 1,
+                            SERVE_BENCH_LINES * 64, fp);
+        fclose(fp);
+        char label[64];
+        snprintf(label, sizeof(label), "%d lines, kept connection:", lines);
+        if (serve_requests(socket_path, (const char *)source.data, source.size, SERVE_BENCH_CONNECTS, 0, times))
+            print_latency(label, times, SERVE_BENCH_CONNECTS);
+    }
+    free(source.data);
+    kill(server, SIGTERM);
+    waitpid(server, NULL, 0);
+
+    // The same snippet through a new process each time
+    fp = fopen(path, "w");
+    if (fp && fputs(library_snippet, fp) >= 0 && fclose(fp) == 0 && access(assembler, X_OK) == 0) {
+        char *paths[] = {(char *)path};
+        int n = 0;
+        for (; n < SERVE_BENCH_SPAWNS; n++) {
+            double start = now_seconds();
+            if (spawn_per_file(assembler, paths, 1) < 0) break;
+            times[n] = now_seconds() - start;
+        }
+        if (n == SERVE_BENCH_SPAWNS) print_latency("snippet, process each:", times, n);
+    } else {
+        printf("  snippet, process each:       skipped (%s not found)\n", assembler);
+    }
+
+    char *object = output_name(path, ".o");
+    remove(object);
+    free(object);
+    remove(path);
+    free(times);
+}
+
+#define ARENA_BENCH_LINES 1000000
+#define ARENA_BENCH_FILES 5
+#define ARENA_BENCH_NAMES 1000000
+
+// A 1M-line source assembled and written repeatedly, as in batch mode:
+// with a fresh context per file, so the IR, symbols, names, sections and
+// output tables all come from malloc and go back to free, against one
+// context whose pools and arena are reset and refilled. Then symbol names
+// alone: interned in the arena against one malloc each.
+static void bench_arena()
+{
+    const char *path = "/tmp/asm_bench_arena.asm";
+    const char *output = "/tmp/asm_bench_arena.o";
+    int lines = write_synthetic_source(path, ARENA_BENCH_LINES);
+    if (!lines) {
+        perror("Cannot write benchmark source");
+        return;
+    }
+
+    printf("arena: %d lines, %d files each\n", lines, ARENA_BENCH_FILES);
+    double fresh_time = 0, reused_time = 0;
+    size_t fresh_bytes = 0, reused_bytes = 0, high_water = 0;
+    int ok = 1;
+    ASSEMBLER *as = &bench_as;
+    for (int i = 0; i < ARENA_BENCH_FILES; i++) {
+        ASSEMBLER fresh;
+        init_assembler(&fresh);
+        double start = now_seconds();
+        assembly_file(&fresh, path);
+        ok &= fresh.error_count == 0 && write_output(&fresh, path, output);
+        fresh_bytes += assembler_footprint(&fresh) - fresh.footprint_start;
+        free_assembler(&fresh);
+        fresh_time += now_seconds() - start;
+    }
+
+    assembly_file(as, path);    // Grow the pools once
+    write_output(as, path, output);
+    for (int i = 0; i < ARENA_BENCH_FILES; i++) {
+        double start = now_seconds();
+        assembly_file(as, path);
+        ok &= as->error_count == 0 && write_output(as, path, output);
+        reused_time += now_seconds() - start;
+        reused_bytes += assembler_footprint(as) - as->footprint_start;
+        high_water = as->arena.high_water;
+    }
+    printf("  malloc per file:   %8.1f ms/file, %8zu KB allocated per file\n",
+           fresh_time * 1e3 / ARENA_BENCH_FILES, fresh_bytes / ARENA_BENCH_FILES >> 10);
+    printf("  pools and arena:   %8.1f ms/file, %8zu KB allocated per file  (%.2fx, arena high water %zu KB)%s\n",
+           reused_time * 1e3 / ARENA_BENCH_FILES, reused_bytes / ARENA_BENCH_FILES >> 10,
+           fresh_time / reused_time, high_water >> 10, ok ? "" : "  FAILED");
+    remove(output);
+    remove(path);
+
+    char name[32];
+    char **names = malloc(ARENA_BENCH_NAMES * sizeof(char *));
+    if (!names) return;
+    double start = now_seconds();
+    for (int i = 0; i < ARENA_BENCH_NAMES; i++) {
+        int len = snprintf(name, sizeof(name), "Label_%d", i);
+        names[i] = malloc(len + 1);
+        if (names[i]) memcpy(names[i], name, len + 1);
+    }
+    for (int i = 0; i < ARENA_BENCH_NAMES; i++)
+        free(names[i]);
+    double malloc_time = now_seconds() - start;
+
+    reset_assembler(as);
+    start = now_seconds();
+    for (int i = 0; i < ARENA_BENCH_NAMES; i++) {
+        int len = snprintf(name, sizeof(name), "Label_%d", i);
+        names[i] = (char *)intern_string(as, name, len);
+    }
+    reset_assembler(as);
+    double arena_time = now_seconds() - start;
+    free(names);
+    printf("  %d names, malloc+free: %6.1f ms, arena: %6.1f ms  (%.2fx)\n",
+           ARENA_BENCH_NAMES, malloc_time * 1e3, arena_time * 1e3, malloc_time / arena_time);
+}
+
+#define MACRO_BENCH_LINES 750000
+
+// The same program twice: written with %define, %macro and %rep, and
+// expanded by hand. Returns the line count of the expanded one.
+static int write_macro_sources(const char *macro_path, const char *plain_path, int lines)
+{
+    static const char *regs[] = { "ebx", "ecx", "edx", "esi", "edi" };
+    FILE *fm = fopen(macro_path, "w"), *fp = fopen(plain_path, "w");
+    if (!fm || !fp) {
+        if (fm) fclose(fm);
+        if (fp) fclose(fp);
+        return 0;
+    }
+    fprintf(fm, "%%define STEP 4\n%%define LIMIT STEP*16\n"
+                "%%macro op3 3\n    mov eax, %%1\n    add eax, %%2\n    sub eax, %%3\n%%endmacro\n"
+                "%%macro countdown 1\n%%%%again:\n    dec %%1\n    jne %%%%again\n%%endmacro\n"
+                "section .text\nglobal main\nmain:\n");
+    fprintf(fp, "section .text\nglobal main\nmain:\n");
+
+    unsigned int seed = 4242;
+    int n = 3, loops = 0;
+    while (n < lines) {
+        seed = seed * 1103515245 + 12345;
+        unsigned int r = seed >> 16;
+        const char *a = regs[r % 5], *b = regs[(r >> 3) % 5];
+        switch (r % 8) {
+            case 0: case 1: case 2:
+                fprintf(fm, "    op3 %s, %u, %s\n", a, r % 10, b);
+                fprintf(fp, "    mov eax, %s\n    add eax, %u\n    sub eax, %s\n", a, r % 10, b);
+                n += 3;
+                break;
+            case 3:
+                fprintf(fm, "    countdown %s\n", a);
+                fprintf(fp, "loop%d:\n    dec %s\n    jne loop%d\n", loops, a, loops);
+                loops++;
+                n += 3;
+                break;
+            case 4:
+                fprintf(fm, "%%rep 4\n    inc %s\n%%endrep\n", a);
+                for (int i = 0; i < 4; i++)
+                    fprintf(fp, "    inc %s\n", a);
+                n += 4;
+                break;
+            default:
+                fprintf(fm, "    add %s, STEP\n    cmp %s, LIMIT\n", a, b);
+                fprintf(fp, "    add %s, 4\n    cmp %s, 4*16\n", a, b);
+                n += 2;
+                break;
+        }
+    }
+    fprintf(fm, "    ret\n");
+    fprintf(fp, "    ret\n");
+    int ok = fclose(fm) == 0;
+    ok &= fclose(fp) == 0;
+    return ok ? n + 1 : 0;
+}
+
+static void bench_macro()
+{
+    static const int threads[] = {1, 4};
+    ASSEMBLER *as = &bench_as;
+    const char *macro_path = "/tmp/asm_bench_macro.asm";
+    const char *plain_path = "/tmp/asm_bench_macro_plain.asm";
+    int lines = write_macro_sources(macro_path, plain_path, MACRO_BENCH_LINES);
+    if (!lines) {
+        perror("Cannot write benchmark source");
+        return;
+    }
+
+    printf("macro: %d lines after expansion\n", lines);
+    for (int i = 0; i < (int)(sizeof(threads) / sizeof(threads[0])); i++) {
+        as->thread_count = threads[i];
+        time_assembly(as, plain_path);    // Warm up the page cache and allocations
+        double plain_time = time_assembly(as, plain_path);
+        unsigned int plain_sum = output_checksum(as);
+        int plain_errors = as->error_count;
+
+        time_assembly(as, macro_path);
+        double macro_time = time_assembly(as, macro_path);
+        unsigned int macro_sum = output_checksum(as);
+        int macro_errors = as->error_count;
+
+        as->stats = 1;                    // Once more for the counters, untimed
+        time_assembly(as, macro_path);
+        as->stats = 0;
+        const COUNTERS *c = &as->counters;
+        printf("  -j %d, expanded by hand: %10.0f lines/sec\n", threads[i], lines / plain_time);
+        printf("  -j %d, preprocessed:     %10.0f lines/sec  (%.2fx, %ld expansions, %ld reused, "
+               "%.1f ms preprocessing, output %s)\n", threads[i], lines / macro_time, plain_time / macro_time,
+               c->macro_expansions, c->macro_cached, c->preprocess_ns / 1e6,
+               !plain_errors && !macro_errors && macro_sum == plain_sum ? "identical" : "DIFFERS");
+    }
+    as->thread_count = 1;
+
+    remove(macro_path);
+    remove(plain_path);
+}
+
+typedef struct {
+    const char *name;
+    void (*run)();
+} BENCHMARK;
+
+static const BENCHMARK benchmarks[] = {
+    {"opcode", bench_opcode},
+    {"symbol", bench_symbol},
+    {"listing", bench_listing},
+    {"tokenizer", bench_tokenizer},
+    {"parallel", bench_parallel},
+    {"batch", bench_batch},
+    {"cache", bench_cache},
+    {"memo", bench_memo},
+    {"data", bench_data},
+    {"incbin", bench_incbin},
+    {"times", bench_times},
+    {"immsize", bench_immsize},
+    {"library", bench_library},
+    {"arena", bench_arena},
+    {"serve", bench_serve},
+    {"macro", bench_macro},
+};
+#define BENCHMARK_COUNT (int)(sizeof(benchmarks) / sizeof(benchmarks[0]))
+
+int main(int argc, char **argv)
+{
+    init_assembler(&bench_as);
+    for (int b = 0; b < BENCHMARK_COUNT; b++) {
+        int selected = argc < 2;
+        for (int i = 1; i < argc; i++) {
+            if (strcmp(argv[i], benchmarks[b].name) == 0) selected = 1;
+        }
+        if (selected) benchmarks[b].run();
+    }
+    free_assembler(&bench_as);
+    return 0;
+}
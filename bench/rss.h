@@ -0,0 +1,32 @@
+// Peak memory of the benchmark process, for bench/bench.c and
+// bench/suite.c: Linux only, through /proc/self.
+#ifndef BENCH_RSS_H
+#define BENCH_RSS_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Peak resident set in KB since the last reset_rss_high_water() (VmHWM)
+static long rss_high_water_kb()
+{
+    FILE *fp = fopen("/proc/self/status", "r");
+    char row[256];
+    long kb = -1;
+    while (fp && fgets(row, sizeof(row), fp)) {
+        if (strncmp(row, "VmHWM:", 6) == 0) kb = atol(row + 6);
+    }
+    if (fp) fclose(fp);
+    return kb;
+}
+
+static void reset_rss_high_water()
+{
+    FILE *fp = fopen("/proc/self/clear_refs", "w");
+    if (fp) {
+        fputs("5", fp);
+        fclose(fp);
+    }
+}
+
+#endif
@@ -0,0 +1,242 @@
+// End-to-end benchmark suite over generated corpora, with a regression
+// check against a baseline recorded on the same machine.
+//
+// Build and run from the repository root (so opcode.csv is found):
+//     gcc -O2 -pthread -o asm_suite bench/suite.c
+//     ./asm_suite [--full] [--save] [--runs N] [--tolerance PCT] [--rss-tolerance PCT]
+//                 [--baseline file] [name ...]
+// Each corpus is generated by tools/gen_corpus.c from a fixed seed and
+// assembled in process, best of N runs (5 by default, and at least a
+// second's worth). The suite reports lines/sec, MB/s, peak RSS and the
+// time of each phase, then compares throughput and RSS with the baseline
+// (bench/baseline.local, not committed: absolute numbers only mean
+// something on the machine that recorded them). The first run, and any
+// run with --save, records this machine's results instead. A drop in
+// lines/sec beyond --tolerance (30% by default: best-of-N throughput
+// still varies 10-25% between runs) or a growth in RSS beyond
+// --rss-tolerance (10%) is a regression and the exit status is 1. --full
+// adds the 256 MB and 1 GB corpora, which need about 4 and 16 GB of memory.
+
+#define GEN_CORPUS_NO_MAIN
+#include "../tools/gen_corpus.c"
+#include "rss.h"
+
+#include <time.h>
+
+#define SUITE_MAX_RUNS 1000
+#define SUITE_MIN_SECONDS 1.0
+#define SUITE_MAX_BASELINE 64
+
+typedef struct {
+    const char *name;
+    int full_only;                  // Only with --full
+    CORPUSCONFIG cfg;
+} SUITECASE;
+
+static const SUITECASE suite_cases[] = {
+    { "tiny",   0, { 1, 1 << 10,   {30, 20, 40, 10}, 50, 10, 10 } },
+    { "small",  0, { 2, 1 << 20,   {30, 20, 40, 10}, 50, 10, 10 } },
+    { "medium", 0, { 3, 16 << 20,  {30, 20, 40, 10}, 50, 10, 10 } },
+    { "data",   0, { 4, 4 << 20,   {30, 20, 40, 10}, 20, 70, 10 } },
+    { "memory", 0, { 5, 4 << 20,   { 5,  5, 85,  5}, 20, 10, 40 } },
+    { "labels", 0, { 6, 4 << 20,   {20, 10, 30, 40}, 400, 5, 10 } },
+    { "large",  1, { 7, 256 << 20, {30, 20, 40, 10}, 50, 10, 10 } },
+    { "huge",   1, { 8, 1ull << 30, {30, 20, 40, 10}, 50, 10, 10 } },
+};
+#define SUITE_CASE_COUNT (int)(sizeof(suite_cases) / sizeof(suite_cases[0]))
+
+typedef struct {
+    char name[32];
+    double lines_per_sec;
+    double mb_per_sec;
+    long peak_rss_kb;
+} SUITERESULT;
+
+static double now_seconds()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+// Baseline file: "name lines_per_sec mb_per_sec peak_rss_kb" per line
+static int load_baseline(const char *path, SUITERESULT *results)
+{
+    FILE *fp = fopen(path, "r");
+    char row[256];
+    int n = 0;
+    while (fp && n < SUITE_MAX_BASELINE && fgets(row, sizeof(row), fp)) {
+        SUITERESULT *r = &results[n];
+        if (row[0] != '#' &&
+            sscanf(row, "%31s %lf %lf %ld", r->name, &r->lines_per_sec, &r->mb_per_sec, &r->peak_rss_kb) == 4)
+            n++;
+    }
+    if (fp) fclose(fp);
+    return n;
+}
+
+static int save_baseline(const char *path, const SUITERESULT *results, int count)
+{
+    FILE *fp = fopen(path, "w");
+    if (!fp) {
+        perror("Cannot write baseline");
+        return 0;
+    }
+    fprintf(fp, "# name lines_per_sec mb_per_sec peak_rss_kb (written by bench/suite.c --save)\n");
+    for (int i = 0; i < count; i++)
+        fprintf(fp, "%s %.0f %.2f %ld\n", results[i].name, results[i].lines_per_sec,
+                results[i].mb_per_sec, results[i].peak_rss_kb);
+    return fclose(fp) == 0;
+}
+
+static SUITERESULT* find_result(SUITERESULT *results, int count, const char *name)
+{
+    for (int i = 0; i < count; i++) {
+        if (strcmp(results[i].name, name) == 0) return &results[i];
+    }
+    return NULL;
+}
+
+// Generate one corpus and assemble it, filling in result. Returns 0 if
+// the corpus could not be written or did not assemble cleanly.
+static int run_case(const SUITECASE *sc, int min_runs, SUITERESULT *result)
+{
+    const char *path = "/tmp/asm_suite.asm";
+    const char *output = "/tmp/asm_suite.o";
+    FILE *fp = fopen(path, "w");
+    if (!fp) {
+        perror("Cannot write corpus");
+        return 0;
+    }
+    long lines = generate_corpus(&sc->cfg, OPCODE_FILE, fp);
+    if (fclose(fp) != 0 || lines < 0) {
+        fprintf(stderr, "%s: cannot generate corpus\n", sc->name);
+        remove(path);
+        return 0;
+    }
+    struct stat st;
+    double mb = stat(path, &st) == 0 ? st.st_size / 1048576.0 : 0;
+
+    ASSEMBLER as;
+    init_assembler(&as);
+    as.stats = 1;
+    reset_rss_high_water();
+
+    double best = 0, spent = 0;
+    double phase_wall[PHASE_COUNT] = {0};
+    int ok = 1, runs = 0;
+    while (ok && runs < SUITE_MAX_RUNS && (runs < min_runs || spent < SUITE_MIN_SECONDS)) {
+        double start = now_seconds();
+        assembly_file(&as, path);
+        ok = as.error_count == 0 && write_output(&as, path, output);
+        double t = now_seconds() - start;
+        if (runs == 0 || t < best) {
+            best = t;
+            memcpy(phase_wall, as.phase_wall, sizeof(phase_wall));
+        }
+        spent += t;
+        runs++;
+    }
+    long rss = rss_high_water_kb();
+    free_assembler(&as);
+    remove(output);
+    remove(path);
+    if (!ok) {
+        fprintf(stderr, "%s: corpus did not assemble\n", sc->name);
+        return 0;
+    }
+
+    snprintf(result->name, sizeof(result->name), "%s", sc->name);
+    result->lines_per_sec = lines / best;
+    result->mb_per_sec = mb / best;
+    result->peak_rss_kb = rss;
+
+    printf("%-7s %9.1f MB %10ld lines  %11.0f lines/s %8.1f MB/s %9ld KB  best of %d\n",
+           sc->name, mb, lines, result->lines_per_sec, result->mb_per_sec, rss, runs);
+    printf("        ");
+    for (int p = 0; p < PHASE_COUNT; p++)
+        printf(" %s %.2f ms", phase_name[p], phase_wall[p] * 1e3);
+    printf("\n");
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    const char *baseline_path = "bench/baseline.local";
+    double tolerance = 30, rss_tolerance = 10;
+    int full = 0, save = 0, min_runs = 5;
+    int selected[SUITE_CASE_COUNT] = {0};
+    int any_selected = 0;
+
+    for (int i = 1; i < argc; i++) {
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(argv[i], "--full") == 0) {
+            full = 1;
+        } else if (strcmp(argv[i], "--save") == 0) {
+            save = 1;
+        } else if (strcmp(argv[i], "--runs") == 0 && value) {
+            min_runs = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--tolerance") == 0 && value) {
+            tolerance = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--rss-tolerance") == 0 && value) {
+            rss_tolerance = atof(argv[++i]);
+        } else if (strcmp(argv[i], "--baseline") == 0 && value) {
+            baseline_path = argv[++i];
+        } else {
+            int found = 0;
+            for (int c = 0; c < SUITE_CASE_COUNT; c++) {
+                if (strcmp(argv[i], suite_cases[c].name) == 0) selected[c] = found = 1;
+            }
+            if (!found) {
+                fprintf(stderr, "Usage: %s [--full] [--save] [--runs N] [--tolerance PCT] "
+                                "[--rss-tolerance PCT] [--baseline file] [name ...]\n", argv[0]);
+                return 1;
+            }
+            any_selected = 1;
+        }
+    }
+    if (min_runs < 1) min_runs = 1;
+
+    SUITERESULT baseline[SUITE_MAX_BASELINE];
+    int baseline_count = load_baseline(baseline_path, baseline);
+    if (baseline_count == 0 && !save) {
+        printf("no baseline in %s: recording this machine's results\n", baseline_path);
+        save = 1;
+    }
+    int failed = 0, regressions = 0;
+
+    for (int c = 0; c < SUITE_CASE_COUNT; c++) {
+        const SUITECASE *sc = &suite_cases[c];
+        if (any_selected ? !selected[c] : (sc->full_only && !full))
+            continue;
+
+        SUITERESULT result;
+        if (!run_case(sc, min_runs, &result)) {
+            failed++;
+            continue;
+        }
+
+        SUITERESULT *base = find_result(baseline, baseline_count, sc->name);
+        if (save) {
+            if (!base && baseline_count < SUITE_MAX_BASELINE)
+                base = &baseline[baseline_count++];
+            if (base) *base = result;
+        } else if (!base) {
+            printf("        no baseline\n");
+        } else {
+            double speed = 100.0 * (result.lines_per_sec / base->lines_per_sec - 1);
+            double rss = 100.0 * ((double)result.peak_rss_kb / base->peak_rss_kb - 1);
+            int slower = speed < -tolerance, bigger = rss > rss_tolerance;
+            printf("        vs baseline: lines/s %+.1f%%, RSS %+.1f%%%s\n", speed, rss,
+                   slower || bigger ? "  REGRESSION" : "");
+            regressions += slower || bigger;
+        }
+    }
+
+    if (save && !save_baseline(baseline_path, baseline, baseline_count))
+        return 1;
+    if (regressions)
+        printf("%d regression%s beyond %.0f%% lines/s or %.0f%% RSS\n", regressions, regressions == 1 ? "" : "s",
+               tolerance, rss_tolerance);
+    return failed || regressions;
+}
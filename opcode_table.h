@@ -0,0 +1,174 @@
+// Generated by tools/gen_opcode_table.c from opcode.csv - do not edit.
+// 156 opcodes in a perfect hash of 256 slots; see find_builtin_opcode().
+
+#define BUILTIN_OPCODE_COUNT 156
+#define BUILTIN_OPCODE_SLOTS 256
+#define BUILTIN_OPCODE_BUCKETS 64
+
+static const unsigned short builtin_opcode_disp[BUILTIN_OPCODE_BUCKETS] = {
+    1, 4, 0, 0, 0, 2, 0, 1, 4, 0, 0, 0,
+    0, 0, 8, 0, 0, 0, 2, 0, 3, 1, 0, 0,
+    6, 0, 3, 5, 5, 7, 3, 0, 5, 4, 3, 5,
+    2, 1, 5, 2, 0, 2, 0, 2, 0, 4, 1, 0,
+    1, 1, 1, 0, 0, 1, 7, 0, 1, 17, 1, 2,
+    0, 0, 1, 4
+};
+
+static const OPCODE builtin_opcodes[BUILTIN_OPCODE_SLOTS] = {
+    [  1] = {"OR", "RR", {0x09}, 1, -1},
+    [  2] = {"CALL", "I", {0xE8}, 1, -1},
+    [  4] = {"CMPSB", "NOOP", {0xA6}, 1, -1},
+    [  5] = {"OR", "RM", {0x0B}, 1, -1},
+    [  6] = {"BSWAP", "R", {0x0F, 0xC8}, 2, -1},
+    [  7] = {"LGDT", "M", {0x0F, 0x01}, 2, 2},
+    [  8] = {"ADD", "RI", {0x83}, 1, 0},
+    [ 13] = {"ROL", "MR", {0xD3}, 1, -1},
+    [ 14] = {"OUT", "DR", {0xE7}, 1, -1},
+    [ 15] = {"POPA", "NOOP", {0x61}, 1, -1},
+    [ 16] = {"MOVSX", "RM", {0x0F, 0xBE}, 2, -1},
+    [ 17] = {"PUSHA", "NOOP", {0x60}, 1, -1},
+    [ 18] = {"IN", "RI", {0xE4}, 1, -1},
+    [ 20] = {"SUB", "RR", {0x29}, 1, -1},
+    [ 23] = {"ADD", "MI", {0x83}, 1, 0},
+    [ 24] = {"WBINVD", "NOOP", {0x0F, 0x09}, 2, -1},
+    [ 27] = {"XOR", "RM", {0x33}, 1, -1},
+    [ 28] = {"TEST", "RR", {0x85}, 1, -1},
+    [ 29] = {"SHL", "MI", {0xC1}, 1, 4},
+    [ 30] = {"MOV", "MR", {0x89}, 1, -1},
+    [ 31] = {"LOCK", "NOOP", {0xF0}, 1, -1},
+    [ 33] = {"XOR", "MI", {0x83}, 1, 6},
+    [ 36] = {"ENTER", "I", {0xC8}, 1, -1},
+    [ 38] = {"SUB", "MR", {0x29}, 1, -1},
+    [ 39] = {"SCASD", "NOOP", {0xAF}, 1, -1},
+    [ 40] = {"XCHG", "RM", {0x87}, 1, -1},
+    [ 41] = {"ADD", "RR", {0x01}, 1, -1},
+    [ 42] = {"PUSHF", "NOOP", {0x9C}, 1, -1},
+    [ 43] = {"MOVSB", "NOOP", {0xA4}, 1, -1},
+    [ 44] = {"AND", "MI", {0x83}, 1, 4},
+    [ 46] = {"LIDT", "M", {0x0F, 0x01}, 2, 3},
+    [ 50] = {"STOSD", "NOOP", {0xAB}, 1, -1},
+    [ 51] = {"LSL", "RM", {0x0F, 0x03}, 2, -1},
+    [ 52] = {"INSW", "NOOP", {0x6D}, 1, -1},
+    [ 53] = {"SCASB", "NOOP", {0xAE}, 1, -1},
+    [ 54] = {"JMP", "M", {0xFF}, 1, 4},
+    [ 55] = {"LAHF", "NOOP", {0x9F}, 1, -1},
+    [ 56] = {"MOVZX", "RM", {0x0F, 0xB6}, 2, -1},
+    [ 58] = {"OR", "MR", {0x09}, 1, -1},
+    [ 59] = {"POPAD", "NOOP", {0x61}, 1, -1},
+    [ 60] = {"INC", "R", {0x40}, 1, -1},
+    [ 63] = {"JECXZ", "I", {0xE3}, 1, -1},
+    [ 66] = {"OR", "MI", {0x83}, 1, 1},
+    [ 67] = {"POPF", "NOOP", {0x9D}, 1, -1},
+    [ 68] = {"OR", "RI", {0x83}, 1, 1},
+    [ 70] = {"ROL", "MI", {0xC1}, 1, 0},
+    [ 71] = {"XOR", "RR", {0x31}, 1, -1},
+    [ 74] = {"SHR", "RI", {0xC1}, 1, 5},
+    [ 75] = {"HLT", "NOOP", {0xF4}, 1, -1},
+    [ 80] = {"AND", "MR", {0x21}, 1, -1},
+    [ 81] = {"XOR", "RI", {0x83}, 1, 6},
+    [ 82] = {"ADD", "RM", {0x03}, 1, -1},
+    [ 83] = {"SUB", "MI", {0x83}, 1, 5},
+    [ 84] = {"REPNE", "NOOP", {0xF2}, 1, -1},
+    [ 85] = {"REPNZ", "NOOP", {0xF2}, 1, -1},
+    [ 87] = {"PUSH", "I", {0x68}, 1, -1},
+    [ 88] = {"STOSB", "NOOP", {0xAA}, 1, -1},
+    [ 91] = {"TEST", "MI", {0xF7}, 1, 0},
+    [ 92] = {"MOV", "RM", {0x8B}, 1, -1},
+    [ 93] = {"CMPSW", "NOOP", {0xA7}, 1, -1},
+    [ 96] = {"LAR", "RM", {0x0F, 0x02}, 2, -1},
+    [ 97] = {"ADD", "MR", {0x01}, 1, -1},
+    [ 98] = {"CLTS", "NOOP", {0x0F, 0x06}, 2, -1},
+    [ 99] = {"ROL", "RR", {0xD3}, 1, -1},
+    [101] = {"OUTSW", "NOOP", {0x6F}, 1, -1},
+    [102] = {"REPZ", "NOOP", {0xF3}, 1, -1},
+    [103] = {"RET", "I", {0xC2}, 1, -1},
+    [105] = {"INC", "M", {0xFF}, 1, 0},
+    [109] = {"RET", "NOOP", {0xC3}, 1, -1},
+    [110] = {"SUB", "RM", {0x2B}, 1, -1},
+    [111] = {"POP", "R", {0x58}, 1, -1},
+    [112] = {"INSB", "NOOP", {0x6C}, 1, -1},
+    [113] = {"TEST", "RI", {0xF7}, 1, 0},
+    [115] = {"AND", "RI", {0x83}, 1, 4},
+    [116] = {"LTR", "M", {0x0F, 0x00}, 2, 3},
+    [120] = {"SHL", "MR", {0xD3}, 1, -1},
+    [122] = {"LOOPNE", "I", {0xE0}, 1, -1},
+    [124] = {"ENTER", "II", {0xC8}, 1, -1},
+    [126] = {"AND", "RM", {0x23}, 1, -1},
+    [128] = {"STI", "NOOP", {0xFB}, 1, -1},
+    [130] = {"IN", "RD", {0xE5}, 1, -1},
+    [131] = {"SUB", "RI", {0x83}, 1, 5},
+    [132] = {"XCHG", "RR", {0x87}, 1, -1},
+    [135] = {"NEG", "M", {0xF7}, 1, 3},
+    [136] = {"OUTSD", "NOOP", {0x6F}, 1, -1},
+    [137] = {"SHR", "RR", {0xD3}, 1, -1},
+    [139] = {"JMP", "I", {0xEB}, 1, -1},
+    [140] = {"SHR", "MR", {0xD3}, 1, -1},
+    [141] = {"JCXZ", "I", {0xE3}, 1, -1},
+    [142] = {"ROR", "RR", {0xD3}, 1, -1},
+    [143] = {"NEG", "R", {0xF7}, 1, 3},
+    [144] = {"CMP", "MI", {0x83}, 1, 7},
+    [146] = {"SHL", "RR", {0xD3}, 1, -1},
+    [147] = {"OUT", "IR", {0xE6}, 1, -1},
+    [150] = {"DEC", "M", {0xFF}, 1, 1},
+    [152] = {"MOVSX", "MR", {0x0F, 0xBE}, 2, -1},
+    [154] = {"MOVSW", "NOOP", {0xA5}, 1, -1},
+    [155] = {"LODSB", "NOOP", {0xAC}, 1, -1},
+    [157] = {"NOT", "M", {0xF7}, 1, 2},
+    [159] = {"LLDT", "M", {0x0F, 0x00}, 2, 2},
+    [162] = {"ROR", "RI", {0xC1}, 1, 1},
+    [164] = {"SHL", "RM", {0xD3}, 1, -1},
+    [166] = {"NOP", "NOOP", {0x90}, 1, -1},
+    [167] = {"ROL", "RM", {0xD3}, 1, -1},
+    [168] = {"REP", "NOOP", {0xF3}, 1, -1},
+    [170] = {"REPE", "NOOP", {0xF3}, 1, -1},
+    [171] = {"XOR", "MR", {0x31}, 1, -1},
+    [172] = {"JNE", "I", {0x75}, 1, -1},
+    [173] = {"CMP", "RR", {0x39}, 1, -1},
+    [175] = {"CMC", "NOOP", {0xF5}, 1, -1},
+    [177] = {"AND", "RR", {0x21}, 1, -1},
+    [178] = {"INVLPG", "M", {0x0F, 0x01}, 2, 7},
+    [179] = {"CLI", "NOOP", {0xFA}, 1, -1},
+    [180] = {"LODSW", "NOOP", {0xAD}, 1, -1},
+    [181] = {"MOVZX", "MR", {0x0F, 0xB6}, 2, -1},
+    [182] = {"LOOP", "I", {0xE2}, 1, -1},
+    [185] = {"CALL", "M", {0xFF}, 1, 2},
+    [186] = {"TEST", "RM", {0x85}, 1, -1},
+    [193] = {"ARPL", "RM", {0x63}, 1, -1},
+    [195] = {"ROR", "RM", {0xD3}, 1, -1},
+    [196] = {"ROR", "MR", {0xD3}, 1, -1},
+    [198] = {"JE", "I", {0x74}, 1, -1},
+    [200] = {"SHR", "RM", {0xD3}, 1, -1},
+    [202] = {"SCASW", "NOOP", {0xAF}, 1, -1},
+    [208] = {"MOV", "RI", {0xB8}, 1, -1},
+    [209] = {"CMP", "RI", {0x83}, 1, 7},
+    [210] = {"INVD", "NOOP", {0x0F, 0x08}, 2, -1},
+    [211] = {"TEST", "MR", {0x85}, 1, -1},
+    [213] = {"XCHG", "MR", {0x87}, 1, -1},
+    [214] = {"MOV", "RR", {0x89}, 1, -1},
+    [215] = {"JMP", "R", {0xFF}, 1, 4},
+    [216] = {"PUSHAD", "NOOP", {0x60}, 1, -1},
+    [218] = {"ROR", "MI", {0xC1}, 1, 1},
+    [219] = {"SAHF", "NOOP", {0x9E}, 1, -1},
+    [220] = {"MOVSD", "NOOP", {0xA5}, 1, -1},
+    [221] = {"STOSW", "NOOP", {0xAB}, 1, -1},
+    [222] = {"CLC", "NOOP", {0xF8}, 1, -1},
+    [223] = {"CMP", "MR", {0x39}, 1, -1},
+    [224] = {"INSD", "NOOP", {0x6D}, 1, -1},
+    [225] = {"PUSH", "R", {0x50}, 1, -1},
+    [228] = {"MOV", "MI", {0xC7}, 1, 0},
+    [230] = {"NOT", "R", {0xF7}, 1, 2},
+    [231] = {"LEAVE", "NOOP", {0xC9}, 1, -1},
+    [232] = {"BOUND", "RM", {0x62}, 1, -1},
+    [234] = {"LEA", "RM", {0x8D}, 1, -1},
+    [236] = {"OUTSB", "NOOP", {0x6E}, 1, -1},
+    [237] = {"SHR", "MI", {0xC1}, 1, 5},
+    [238] = {"LOOPE", "I", {0xE1}, 1, -1},
+    [240] = {"STC", "NOOP", {0xF9}, 1, -1},
+    [242] = {"DEC", "R", {0x48}, 1, -1},
+    [246] = {"LMSW", "M", {0x0F, 0x01}, 2, 6},
+    [247] = {"LODSD", "NOOP", {0xAD}, 1, -1},
+    [248] = {"ROL", "RI", {0xC1}, 1, 0},
+    [249] = {"CMP", "RM", {0x3B}, 1, -1},
+    [252] = {"SHL", "RI", {0xC1}, 1, 4},
+    [254] = {"CMPSD", "NOOP", {0xA7}, 1, -1},
+};
@@ -0,0 +1,31 @@
+; Branches are short (rel8) when the target is within -128..127 bytes of
+; the next instruction and near (rel32) otherwise, in both directions,
+; with the limits exactly on the boundary
+section .text
+start:
+    jmp fits_forward        ; 2 + 127 bytes of padding: short
+    times 127 nop
+fits_forward:
+    jmp too_far_forward     ; 128 bytes: near
+    times 128 nop
+too_far_forward:
+    jne start               ; backward, far: near 0F 85
+back_short:
+    times 126 nop
+    je back_short           ; -128 from its end: short
+back_near:
+    times 127 nop
+    je back_near            ; -129: near
+    jne done                ; forward, short
+    je done
+    jmp done
+    call helper             ; call is always rel32
+    loop back_loop          ; loop/jecxz have only rel8
+back_loop:
+    loope back_loop
+    loopne done
+    jecxz done
+done:
+    ret
+helper:
+    jmp start               ; far backward: near E9
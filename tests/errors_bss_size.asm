@@ -0,0 +1,15 @@
+; Reservations are sized in 64 bits and must fit the 32-bit bss section
+section .bss
+    small: resb 16
+    huge: resd 1073741824
+    repeated: times 65536 resq 65536
+    negative: resb -4
+    fits: times 2 resd 4
+    hex: resb 0x100
+    hexh: resw 10h
+    wraps: resb 4294967297
+    overflows: resb 99999999999999999999999
+    bad: resb 12x
+    most: times 4294967295 resq 4294967295
+section .text
+    ret
@@ -0,0 +1,6 @@
+; enter nesting levels are a byte
+section .text
+    enter 16, 255
+    enter 16, 256
+    enter 16, -1
+    ret
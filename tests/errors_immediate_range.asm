@@ -0,0 +1,11 @@
+; Immediates must fit a signed or an unsigned 32-bit value
+section .text
+    mov eax, 4294967295
+    mov eax, -2147483648
+    mov eax, 0xFFFFFFFF
+    mov eax, 5000000000
+    mov eax, 100000000h
+    push -2147483649
+    mov eax, [ebx+0x123456789]
+    add eax, 99999999999999999999999
+    ret
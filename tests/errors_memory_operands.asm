@@ -0,0 +1,7 @@
+; Addresses the ModR/M and SIB bytes cannot express
+section .text
+    mov eax, [eax+esp*2]
+    mov eax, [ebx*3]
+    mov eax, [eax+ebx+ecx]
+    mov eax, [eax+ebx*4]
+    ret
@@ -0,0 +1,13 @@
+; loop and jcxz only have a rel8 form, so they cannot reach a label in
+; another section or an extern
+section .data
+    table dd 0
+section .text
+extern far_away
+start:
+    loop start
+    loop table
+    jcxz far_away
+    jecxz start
+    jmp far_away
+    ret
@@ -0,0 +1,13 @@
+; Lines that cannot be encoded, and labels defined twice, are errors
+section .data
+    x dd 1
+    x dd 2
+section .text
+foo:
+    nop
+foo:
+    mov eax, x
+    movv eax, ebx
+    jnz foo
+    ; a comment alone is not an error
+    ret
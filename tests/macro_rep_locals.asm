@@ -0,0 +1,14 @@
+; %%labels of a macro invoked inside %rep: each pass makes new labels, so
+; every jne jumps back to the dec just before it (75 FD)
+%macro spin 0
+%%top:
+    dec ecx
+    jne %%top
+%endmacro
+section .text
+main:
+%rep 2
+    spin
+    spin
+%endrep
+    ret
@@ -0,0 +1,45 @@
+; ModR/M and SIB forms of memory operands: every base, disp0/disp8/disp32,
+; scaled indexes, and the no-base SIB and absolute forms
+section .data
+    table dd 1, 2, 3, 4
+section .text
+    ; Base only: disp0, disp8 at both ends, disp32 just past them
+    mov eax, [eax]
+    mov eax, [ecx+1]
+    mov eax, [edx+127]
+    mov eax, [ebx-128]
+    mov eax, [esi+128]
+    mov eax, [edi-129]
+    mov eax, [ebx+0x12345678]
+    ; ESP as a base always needs a SIB byte
+    mov eax, [esp]
+    mov eax, [esp+4]
+    mov eax, [esp+0x200]
+    ; EBP as a base has no disp0 form: [ebp] is [ebp+0]
+    mov eax, [ebp]
+    mov eax, [ebp+8]
+    mov eax, [ebp-0x100]
+    ; Base and scaled index
+    mov eax, [eax+ecx]
+    mov eax, [eax+ecx*2+4]
+    mov eax, [ebx+esi*4-8]
+    mov eax, [edx+edi*8+0x1000]
+    mov eax, [esp+eax*4]
+    mov eax, [ebp+eax*4]
+    mov eax, [ebp+ebx*2+0x7F]
+    ; No base: SIB with a disp32, and a bare disp32
+    mov eax, [ecx*4]
+    mov eax, [esi*8+16]
+    mov eax, [0x1000]
+    ; A symbol as the displacement
+    mov eax, [table]
+    mov eax, [table+ebx*4]
+    mov eax, [esi+table+4]
+    ; Other operand forms through the same encoder
+    mov [esp+8], ebx
+    lea esi, [edi+ecx*4+12]
+    inc dword [ebp-4]
+    mov dword [esp], 5
+    add dword [ebx+eax*2], 1000
+    cmp dword [ecx*2+8], -1
+    ret
@@ -0,0 +1,11 @@
+; ';' and ':' in quotes are neither comments nor labels
+section .data
+    sep db ':;', 0
+    msg: db 'a;b:c', 0 ; a comment with ' and :
+section .text
+start:
+    mov eax, ';'
+    push ':'
+    cmp eax, ':' ; colon
+next: mov ebx, ':;'
+    ret
@@ -0,0 +1,33 @@
+#!/bin/sh
+# Regression sources: each tests/NAME.asm is assembled with -f bin, on one
+# and on four threads, and compared with NAME.bin, or, when NAME.err exists
+# instead, must fail with exactly those messages on stderr. Run it from the
+# repository root, which incbin paths in the sources are relative to:
+#     gcc -O2 -pthread -o assembler Assembler.c && tests/run.sh [./assembler]
+assembler=${1:-./assembler}
+dir=$(dirname "$0")
+tmp=${TMPDIR:-/tmp}/asm_tests.$$
+failed=0
+for source in "$dir"/*.asm; do
+    name=${source%.asm}
+    if [ -f "$name.err" ]; then
+        if "$assembler" -f bin -o "$tmp.bin" "$source" 2> "$tmp.err"; then
+            echo "FAIL $source: assembled without errors"
+            failed=1
+        elif ! cmp -s "$tmp.err" "$name.err"; then
+            echo "FAIL $source: messages differ"
+            diff "$name.err" "$tmp.err"
+            failed=1
+        fi
+    else
+        for threads in 1 4; do
+            if ! "$assembler" -j $threads -f bin -o "$tmp.bin" "$source" || ! cmp -s "$tmp.bin" "$name.bin"; then
+                echo "FAIL $source (-j $threads)"
+                failed=1
+            fi
+        done
+    fi
+done
+rm -f "$tmp.bin" "$tmp.err"
+[ $failed = 0 ] && echo "all passed"
+exit $failed
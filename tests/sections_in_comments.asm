@@ -0,0 +1,6008 @@
+; Section names in comments and strings are not directives: each pass-1
+; chunk must start in the section really in effect, for any -j
+section .bss
+    pad: resb 4
+section .data
+v0 dd 0 ; moved from .bss
+v1 dd 1 ; moved from .bss
+v2 dd 2 ; moved from .bss
+v3 dd 3 ; moved from .bss
+v4 dd 4 ; moved from .bss
+v5 dd 5 ; moved from .bss
+v6 dd 6 ; moved from .bss
+v7 dd 7 ; moved from .bss
+v8 dd 8 ; moved from .bss
+v9 dd 9 ; moved from .bss
+v10 dd 10 ; moved from .bss
+v11 dd 11 ; moved from .bss
+v12 dd 12 ; moved from .bss
+v13 dd 13 ; moved from .bss
+v14 dd 14 ; moved from .bss
+v15 dd 15 ; moved from .bss
+v16 dd 16 ; moved from .bss
+v17 dd 17 ; moved from .bss
+v18 dd 18 ; moved from .bss
+v19 dd 19 ; moved from .bss
+v20 dd 20 ; moved from .bss
+v21 dd 21 ; moved from .bss
+v22 dd 22 ; moved from .bss
+v23 dd 23 ; moved from .bss
+v24 dd 24 ; moved from .bss
+v25 dd 25 ; moved from .bss
+v26 dd 26 ; moved from .bss
+v27 dd 27 ; moved from .bss
+v28 dd 28 ; moved from .bss
+v29 dd 29 ; moved from .bss
+v30 dd 30 ; moved from .bss
+v31 dd 31 ; moved from .bss
+v32 dd 32 ; moved from .bss
+v33 dd 33 ; moved from .bss
+v34 dd 34 ; moved from .bss
+v35 dd 35 ; moved from .bss
+v36 dd 36 ; moved from .bss
+v37 dd 37 ; moved from .bss
+v38 dd 38 ; moved from .bss
+v39 dd 39 ; moved from .bss
+v40 dd 40 ; moved from .bss
+v41 dd 41 ; moved from .bss
+v42 dd 42 ; moved from .bss
+v43 dd 43 ; moved from .bss
+v44 dd 44 ; moved from .bss
+v45 dd 45 ; moved from .bss
+v46 dd 46 ; moved from .bss
+v47 dd 47 ; moved from .bss
+v48 dd 48 ; moved from .bss
+v49 dd 49 ; moved from .bss
+v50 dd 50 ; moved from .bss
+v51 dd 51 ; moved from .bss
+v52 dd 52 ; moved from .bss
+v53 dd 53 ; moved from .bss
+v54 dd 54 ; moved from .bss
+v55 dd 55 ; moved from .bss
+v56 dd 56 ; moved from .bss
+v57 dd 57 ; moved from .bss
+v58 dd 58 ; moved from .bss
+v59 dd 59 ; moved from .bss
+v60 dd 60 ; moved from .bss
+v61 dd 61 ; moved from .bss
+v62 dd 62 ; moved from .bss
+v63 dd 63 ; moved from .bss
+v64 dd 64 ; moved from .bss
+v65 dd 65 ; moved from .bss
+v66 dd 66 ; moved from .bss
+v67 dd 67 ; moved from .bss
+v68 dd 68 ; moved from .bss
+v69 dd 69 ; moved from .bss
+v70 dd 70 ; moved from .bss
+v71 dd 71 ; moved from .bss
+v72 dd 72 ; moved from .bss
+v73 dd 73 ; moved from .bss
+v74 dd 74 ; moved from .bss
+v75 dd 75 ; moved from .bss
+v76 dd 76 ; moved from .bss
+v77 dd 77 ; moved from .bss
+v78 dd 78 ; moved from .bss
+v79 dd 79 ; moved from .bss
+v80 dd 80 ; moved from .bss
+v81 dd 81 ; moved from .bss
+v82 dd 82 ; moved from .bss
+v83 dd 83 ; moved from .bss
+v84 dd 84 ; moved from .bss
+v85 dd 85 ; moved from .bss
+v86 dd 86 ; moved from .bss
+v87 dd 87 ; moved from .bss
+v88 dd 88 ; moved from .bss
+v89 dd 89 ; moved from .bss
+v90 dd 90 ; moved from .bss
+v91 dd 91 ; moved from .bss
+v92 dd 92 ; moved from .bss
+v93 dd 93 ; moved from .bss
+v94 dd 94 ; moved from .bss
+v95 dd 95 ; moved from .bss
+v96 dd 96 ; moved from .bss
+v97 dd 97 ; moved from .bss
+v98 dd 98 ; moved from .bss
+v99 dd 99 ; moved from .bss
+v100 dd 100 ; moved from .bss
+v101 dd 101 ; moved from .bss
+v102 dd 102 ; moved from .bss
+v103 dd 103 ; moved from .bss
+v104 dd 104 ; moved from .bss
+v105 dd 105 ; moved from .bss
+v106 dd 106 ; moved from .bss
+v107 dd 107 ; moved from .bss
+v108 dd 108 ; moved from .bss
+v109 dd 109 ; moved from .bss
+v110 dd 110 ; moved from .bss
+v111 dd 111 ; moved from .bss
+v112 dd 112 ; moved from .bss
+v113 dd 113 ; moved from .bss
+v114 dd 114 ; moved from .bss
+v115 dd 115 ; moved from .bss
+v116 dd 116 ; moved from .bss
+v117 dd 117 ; moved from .bss
+v118 dd 118 ; moved from .bss
+v119 dd 119 ; moved from .bss
+v120 dd 120 ; moved from .bss
+v121 dd 121 ; moved from .bss
+v122 dd 122 ; moved from .bss
+v123 dd 123 ; moved from .bss
+v124 dd 124 ; moved from .bss
+v125 dd 125 ; moved from .bss
+v126 dd 126 ; moved from .bss
+v127 dd 127 ; moved from .bss
+v128 dd 128 ; moved from .bss
+v129 dd 129 ; moved from .bss
+v130 dd 130 ; moved from .bss
+v131 dd 131 ; moved from .bss
+v132 dd 132 ; moved from .bss
+v133 dd 133 ; moved from .bss
+v134 dd 134 ; moved from .bss
+v135 dd 135 ; moved from .bss
+v136 dd 136 ; moved from .bss
+v137 dd 137 ; moved from .bss
+v138 dd 138 ; moved from .bss
+v139 dd 139 ; moved from .bss
+v140 dd 140 ; moved from .bss
+v141 dd 141 ; moved from .bss
+v142 dd 142 ; moved from .bss
+v143 dd 143 ; moved from .bss
+v144 dd 144 ; moved from .bss
+v145 dd 145 ; moved from .bss
+v146 dd 146 ; moved from .bss
+v147 dd 147 ; moved from .bss
+v148 dd 148 ; moved from .bss
+v149 dd 149 ; moved from .bss
+v150 dd 150 ; moved from .bss
+v151 dd 151 ; moved from .bss
+v152 dd 152 ; moved from .bss
+v153 dd 153 ; moved from .bss
+v154 dd 154 ; moved from .bss
+v155 dd 155 ; moved from .bss
+v156 dd 156 ; moved from .bss
+v157 dd 157 ; moved from .bss
+v158 dd 158 ; moved from .bss
+v159 dd 159 ; moved from .bss
+v160 dd 160 ; moved from .bss
+v161 dd 161 ; moved from .bss
+v162 dd 162 ; moved from .bss
+v163 dd 163 ; moved from .bss
+v164 dd 164 ; moved from .bss
+v165 dd 165 ; moved from .bss
+v166 dd 166 ; moved from .bss
+v167 dd 167 ; moved from .bss
+v168 dd 168 ; moved from .bss
+v169 dd 169 ; moved from .bss
+v170 dd 170 ; moved from .bss
+v171 dd 171 ; moved from .bss
+v172 dd 172 ; moved from .bss
+v173 dd 173 ; moved from .bss
+v174 dd 174 ; moved from .bss
+v175 dd 175 ; moved from .bss
+v176 dd 176 ; moved from .bss
+v177 dd 177 ; moved from .bss
+v178 dd 178 ; moved from .bss
+v179 dd 179 ; moved from .bss
+v180 dd 180 ; moved from .bss
+v181 dd 181 ; moved from .bss
+v182 dd 182 ; moved from .bss
+v183 dd 183 ; moved from .bss
+v184 dd 184 ; moved from .bss
+v185 dd 185 ; moved from .bss
+v186 dd 186 ; moved from .bss
+v187 dd 187 ; moved from .bss
+v188 dd 188 ; moved from .bss
+v189 dd 189 ; moved from .bss
+v190 dd 190 ; moved from .bss
+v191 dd 191 ; moved from .bss
+v192 dd 192 ; moved from .bss
+v193 dd 193 ; moved from .bss
+v194 dd 194 ; moved from .bss
+v195 dd 195 ; moved from .bss
+v196 dd 196 ; moved from .bss
+v197 dd 197 ; moved from .bss
+v198 dd 198 ; moved from .bss
+v199 dd 199 ; moved from .bss
+v200 dd 200 ; moved from .bss
+v201 dd 201 ; moved from .bss
+v202 dd 202 ; moved from .bss
+v203 dd 203 ; moved from .bss
+v204 dd 204 ; moved from .bss
+v205 dd 205 ; moved from .bss
+v206 dd 206 ; moved from .bss
+v207 dd 207 ; moved from .bss
+v208 dd 208 ; moved from .bss
+v209 dd 209 ; moved from .bss
+v210 dd 210 ; moved from .bss
+v211 dd 211 ; moved from .bss
+v212 dd 212 ; moved from .bss
+v213 dd 213 ; moved from .bss
+v214 dd 214 ; moved from .bss
+v215 dd 215 ; moved from .bss
+v216 dd 216 ; moved from .bss
+v217 dd 217 ; moved from .bss
+v218 dd 218 ; moved from .bss
+v219 dd 219 ; moved from .bss
+v220 dd 220 ; moved from .bss
+v221 dd 221 ; moved from .bss
+v222 dd 222 ; moved from .bss
+v223 dd 223 ; moved from .bss
+v224 dd 224 ; moved from .bss
+v225 dd 225 ; moved from .bss
+v226 dd 226 ; moved from .bss
+v227 dd 227 ; moved from .bss
+v228 dd 228 ; moved from .bss
+v229 dd 229 ; moved from .bss
+v230 dd 230 ; moved from .bss
+v231 dd 231 ; moved from .bss
+v232 dd 232 ; moved from .bss
+v233 dd 233 ; moved from .bss
+v234 dd 234 ; moved from .bss
+v235 dd 235 ; moved from .bss
+v236 dd 236 ; moved from .bss
+v237 dd 237 ; moved from .bss
+v238 dd 238 ; moved from .bss
+v239 dd 239 ; moved from .bss
+v240 dd 240 ; moved from .bss
+v241 dd 241 ; moved from .bss
+v242 dd 242 ; moved from .bss
+v243 dd 243 ; moved from .bss
+v244 dd 244 ; moved from .bss
+v245 dd 245 ; moved from .bss
+v246 dd 246 ; moved from .bss
+v247 dd 247 ; moved from .bss
+v248 dd 248 ; moved from .bss
+v249 dd 249 ; moved from .bss
+v250 dd 250 ; moved from .bss
+v251 dd 251 ; moved from .bss
+v252 dd 252 ; moved from .bss
+v253 dd 253 ; moved from .bss
+v254 dd 254 ; moved from .bss
+v255 dd 255 ; moved from .bss
+v256 dd 256 ; moved from .bss
+v257 dd 257 ; moved from .bss
+v258 dd 258 ; moved from .bss
+v259 dd 259 ; moved from .bss
+v260 dd 260 ; moved from .bss
+v261 dd 261 ; moved from .bss
+v262 dd 262 ; moved from .bss
+v263 dd 263 ; moved from .bss
+v264 dd 264 ; moved from .bss
+v265 dd 265 ; moved from .bss
+v266 dd 266 ; moved from .bss
+v267 dd 267 ; moved from .bss
+v268 dd 268 ; moved from .bss
+v269 dd 269 ; moved from .bss
+v270 dd 270 ; moved from .bss
+v271 dd 271 ; moved from .bss
+v272 dd 272 ; moved from .bss
+v273 dd 273 ; moved from .bss
+v274 dd 274 ; moved from .bss
+v275 dd 275 ; moved from .bss
+v276 dd 276 ; moved from .bss
+v277 dd 277 ; moved from .bss
+v278 dd 278 ; moved from .bss
+v279 dd 279 ; moved from .bss
+v280 dd 280 ; moved from .bss
+v281 dd 281 ; moved from .bss
+v282 dd 282 ; moved from .bss
+v283 dd 283 ; moved from .bss
+v284 dd 284 ; moved from .bss
+v285 dd 285 ; moved from .bss
+v286 dd 286 ; moved from .bss
+v287 dd 287 ; moved from .bss
+v288 dd 288 ; moved from .bss
+v289 dd 289 ; moved from .bss
+v290 dd 290 ; moved from .bss
+v291 dd 291 ; moved from .bss
+v292 dd 292 ; moved from .bss
+v293 dd 293 ; moved from .bss
+v294 dd 294 ; moved from .bss
+v295 dd 295 ; moved from .bss
+v296 dd 296 ; moved from .bss
+v297 dd 297 ; moved from .bss
+v298 dd 298 ; moved from .bss
+v299 dd 299 ; moved from .bss
+v300 dd 300 ; moved from .bss
+v301 dd 301 ; moved from .bss
+v302 dd 302 ; moved from .bss
+v303 dd 303 ; moved from .bss
+v304 dd 304 ; moved from .bss
+v305 dd 305 ; moved from .bss
+v306 dd 306 ; moved from .bss
+v307 dd 307 ; moved from .bss
+v308 dd 308 ; moved from .bss
+v309 dd 309 ; moved from .bss
+v310 dd 310 ; moved from .bss
+v311 dd 311 ; moved from .bss
+v312 dd 312 ; moved from .bss
+v313 dd 313 ; moved from .bss
+v314 dd 314 ; moved from .bss
+v315 dd 315 ; moved from .bss
+v316 dd 316 ; moved from .bss
+v317 dd 317 ; moved from .bss
+v318 dd 318 ; moved from .bss
+v319 dd 319 ; moved from .bss
+v320 dd 320 ; moved from .bss
+v321 dd 321 ; moved from .bss
+v322 dd 322 ; moved from .bss
+v323 dd 323 ; moved from .bss
+v324 dd 324 ; moved from .bss
+v325 dd 325 ; moved from .bss
+v326 dd 326 ; moved from .bss
+v327 dd 327 ; moved from .bss
+v328 dd 328 ; moved from .bss
+v329 dd 329 ; moved from .bss
+v330 dd 330 ; moved from .bss
+v331 dd 331 ; moved from .bss
+v332 dd 332 ; moved from .bss
+v333 dd 333 ; moved from .bss
+v334 dd 334 ; moved from .bss
+v335 dd 335 ; moved from .bss
+v336 dd 336 ; moved from .bss
+v337 dd 337 ; moved from .bss
+v338 dd 338 ; moved from .bss
+v339 dd 339 ; moved from .bss
+v340 dd 340 ; moved from .bss
+v341 dd 341 ; moved from .bss
+v342 dd 342 ; moved from .bss
+v343 dd 343 ; moved from .bss
+v344 dd 344 ; moved from .bss
+v345 dd 345 ; moved from .bss
+v346 dd 346 ; moved from .bss
+v347 dd 347 ; moved from .bss
+v348 dd 348 ; moved from .bss
+v349 dd 349 ; moved from .bss
+v350 dd 350 ; moved from .bss
+v351 dd 351 ; moved from .bss
+v352 dd 352 ; moved from .bss
+v353 dd 353 ; moved from .bss
+v354 dd 354 ; moved from .bss
+v355 dd 355 ; moved from .bss
+v356 dd 356 ; moved from .bss
+v357 dd 357 ; moved from .bss
+v358 dd 358 ; moved from .bss
+v359 dd 359 ; moved from .bss
+v360 dd 360 ; moved from .bss
+v361 dd 361 ; moved from .bss
+v362 dd 362 ; moved from .bss
+v363 dd 363 ; moved from .bss
+v364 dd 364 ; moved from .bss
+v365 dd 365 ; moved from .bss
+v366 dd 366 ; moved from .bss
+v367 dd 367 ; moved from .bss
+v368 dd 368 ; moved from .bss
+v369 dd 369 ; moved from .bss
+v370 dd 370 ; moved from .bss
+v371 dd 371 ; moved from .bss
+v372 dd 372 ; moved from .bss
+v373 dd 373 ; moved from .bss
+v374 dd 374 ; moved from .bss
+v375 dd 375 ; moved from .bss
+v376 dd 376 ; moved from .bss
+v377 dd 377 ; moved from .bss
+v378 dd 378 ; moved from .bss
+v379 dd 379 ; moved from .bss
+v380 dd 380 ; moved from .bss
+v381 dd 381 ; moved from .bss
+v382 dd 382 ; moved from .bss
+v383 dd 383 ; moved from .bss
+v384 dd 384 ; moved from .bss
+v385 dd 385 ; moved from .bss
+v386 dd 386 ; moved from .bss
+v387 dd 387 ; moved from .bss
+v388 dd 388 ; moved from .bss
+v389 dd 389 ; moved from .bss
+v390 dd 390 ; moved from .bss
+v391 dd 391 ; moved from .bss
+v392 dd 392 ; moved from .bss
+v393 dd 393 ; moved from .bss
+v394 dd 394 ; moved from .bss
+v395 dd 395 ; moved from .bss
+v396 dd 396 ; moved from .bss
+v397 dd 397 ; moved from .bss
+v398 dd 398 ; moved from .bss
+v399 dd 399 ; moved from .bss
+v400 dd 400 ; moved from .bss
+v401 dd 401 ; moved from .bss
+v402 dd 402 ; moved from .bss
+v403 dd 403 ; moved from .bss
+v404 dd 404 ; moved from .bss
+v405 dd 405 ; moved from .bss
+v406 dd 406 ; moved from .bss
+v407 dd 407 ; moved from .bss
+v408 dd 408 ; moved from .bss
+v409 dd 409 ; moved from .bss
+v410 dd 410 ; moved from .bss
+v411 dd 411 ; moved from .bss
+v412 dd 412 ; moved from .bss
+v413 dd 413 ; moved from .bss
+v414 dd 414 ; moved from .bss
+v415 dd 415 ; moved from .bss
+v416 dd 416 ; moved from .bss
+v417 dd 417 ; moved from .bss
+v418 dd 418 ; moved from .bss
+v419 dd 419 ; moved from .bss
+v420 dd 420 ; moved from .bss
+v421 dd 421 ; moved from .bss
+v422 dd 422 ; moved from .bss
+v423 dd 423 ; moved from .bss
+v424 dd 424 ; moved from .bss
+v425 dd 425 ; moved from .bss
+v426 dd 426 ; moved from .bss
+v427 dd 427 ; moved from .bss
+v428 dd 428 ; moved from .bss
+v429 dd 429 ; moved from .bss
+v430 dd 430 ; moved from .bss
+v431 dd 431 ; moved from .bss
+v432 dd 432 ; moved from .bss
+v433 dd 433 ; moved from .bss
+v434 dd 434 ; moved from .bss
+v435 dd 435 ; moved from .bss
+v436 dd 436 ; moved from .bss
+v437 dd 437 ; moved from .bss
+v438 dd 438 ; moved from .bss
+v439 dd 439 ; moved from .bss
+v440 dd 440 ; moved from .bss
+v441 dd 441 ; moved from .bss
+v442 dd 442 ; moved from .bss
+v443 dd 443 ; moved from .bss
+v444 dd 444 ; moved from .bss
+v445 dd 445 ; moved from .bss
+v446 dd 446 ; moved from .bss
+v447 dd 447 ; moved from .bss
+v448 dd 448 ; moved from .bss
+v449 dd 449 ; moved from .bss
+v450 dd 450 ; moved from .bss
+v451 dd 451 ; moved from .bss
+v452 dd 452 ; moved from .bss
+v453 dd 453 ; moved from .bss
+v454 dd 454 ; moved from .bss
+v455 dd 455 ; moved from .bss
+v456 dd 456 ; moved from .bss
+v457 dd 457 ; moved from .bss
+v458 dd 458 ; moved from .bss
+v459 dd 459 ; moved from .bss
+v460 dd 460 ; moved from .bss
+v461 dd 461 ; moved from .bss
+v462 dd 462 ; moved from .bss
+v463 dd 463 ; moved from .bss
+v464 dd 464 ; moved from .bss
+v465 dd 465 ; moved from .bss
+v466 dd 466 ; moved from .bss
+v467 dd 467 ; moved from .bss
+v468 dd 468 ; moved from .bss
+v469 dd 469 ; moved from .bss
+v470 dd 470 ; moved from .bss
+v471 dd 471 ; moved from .bss
+v472 dd 472 ; moved from .bss
+v473 dd 473 ; moved from .bss
+v474 dd 474 ; moved from .bss
+v475 dd 475 ; moved from .bss
+v476 dd 476 ; moved from .bss
+v477 dd 477 ; moved from .bss
+v478 dd 478 ; moved from .bss
+v479 dd 479 ; moved from .bss
+v480 dd 480 ; moved from .bss
+v481 dd 481 ; moved from .bss
+v482 dd 482 ; moved from .bss
+v483 dd 483 ; moved from .bss
+v484 dd 484 ; moved from .bss
+v485 dd 485 ; moved from .bss
+v486 dd 486 ; moved from .bss
+v487 dd 487 ; moved from .bss
+v488 dd 488 ; moved from .bss
+v489 dd 489 ; moved from .bss
+v490 dd 490 ; moved from .bss
+v491 dd 491 ; moved from .bss
+v492 dd 492 ; moved from .bss
+v493 dd 493 ; moved from .bss
+v494 dd 494 ; moved from .bss
+v495 dd 495 ; moved from .bss
+v496 dd 496 ; moved from .bss
+v497 dd 497 ; moved from .bss
+v498 dd 498 ; moved from .bss
+v499 dd 499 ; moved from .bss
+v500 dd 500 ; moved from .bss
+v501 dd 501 ; moved from .bss
+v502 dd 502 ; moved from .bss
+v503 dd 503 ; moved from .bss
+v504 dd 504 ; moved from .bss
+v505 dd 505 ; moved from .bss
+v506 dd 506 ; moved from .bss
+v507 dd 507 ; moved from .bss
+v508 dd 508 ; moved from .bss
+v509 dd 509 ; moved from .bss
+v510 dd 510 ; moved from .bss
+v511 dd 511 ; moved from .bss
+v512 dd 512 ; moved from .bss
+v513 dd 513 ; moved from .bss
+v514 dd 514 ; moved from .bss
+v515 dd 515 ; moved from .bss
+v516 dd 516 ; moved from .bss
+v517 dd 517 ; moved from .bss
+v518 dd 518 ; moved from .bss
+v519 dd 519 ; moved from .bss
+v520 dd 520 ; moved from .bss
+v521 dd 521 ; moved from .bss
+v522 dd 522 ; moved from .bss
+v523 dd 523 ; moved from .bss
+v524 dd 524 ; moved from .bss
+v525 dd 525 ; moved from .bss
+v526 dd 526 ; moved from .bss
+v527 dd 527 ; moved from .bss
+v528 dd 528 ; moved from .bss
+v529 dd 529 ; moved from .bss
+v530 dd 530 ; moved from .bss
+v531 dd 531 ; moved from .bss
+v532 dd 532 ; moved from .bss
+v533 dd 533 ; moved from .bss
+v534 dd 534 ; moved from .bss
+v535 dd 535 ; moved from .bss
+v536 dd 536 ; moved from .bss
+v537 dd 537 ; moved from .bss
+v538 dd 538 ; moved from .bss
+v539 dd 539 ; moved from .bss
+v540 dd 540 ; moved from .bss
+v541 dd 541 ; moved from .bss
+v542 dd 542 ; moved from .bss
+v543 dd 543 ; moved from .bss
+v544 dd 544 ; moved from .bss
+v545 dd 545 ; moved from .bss
+v546 dd 546 ; moved from .bss
+v547 dd 547 ; moved from .bss
+v548 dd 548 ; moved from .bss
+v549 dd 549 ; moved from .bss
+v550 dd 550 ; moved from .bss
+v551 dd 551 ; moved from .bss
+v552 dd 552 ; moved from .bss
+v553 dd 553 ; moved from .bss
+v554 dd 554 ; moved from .bss
+v555 dd 555 ; moved from .bss
+v556 dd 556 ; moved from .bss
+v557 dd 557 ; moved from .bss
+v558 dd 558 ; moved from .bss
+v559 dd 559 ; moved from .bss
+v560 dd 560 ; moved from .bss
+v561 dd 561 ; moved from .bss
+v562 dd 562 ; moved from .bss
+v563 dd 563 ; moved from .bss
+v564 dd 564 ; moved from .bss
+v565 dd 565 ; moved from .bss
+v566 dd 566 ; moved from .bss
+v567 dd 567 ; moved from .bss
+v568 dd 568 ; moved from .bss
+v569 dd 569 ; moved from .bss
+v570 dd 570 ; moved from .bss
+v571 dd 571 ; moved from .bss
+v572 dd 572 ; moved from .bss
+v573 dd 573 ; moved from .bss
+v574 dd 574 ; moved from .bss
+v575 dd 575 ; moved from .bss
+v576 dd 576 ; moved from .bss
+v577 dd 577 ; moved from .bss
+v578 dd 578 ; moved from .bss
+v579 dd 579 ; moved from .bss
+v580 dd 580 ; moved from .bss
+v581 dd 581 ; moved from .bss
+v582 dd 582 ; moved from .bss
+v583 dd 583 ; moved from .bss
+v584 dd 584 ; moved from .bss
+v585 dd 585 ; moved from .bss
+v586 dd 586 ; moved from .bss
+v587 dd 587 ; moved from .bss
+v588 dd 588 ; moved from .bss
+v589 dd 589 ; moved from .bss
+v590 dd 590 ; moved from .bss
+v591 dd 591 ; moved from .bss
+v592 dd 592 ; moved from .bss
+v593 dd 593 ; moved from .bss
+v594 dd 594 ; moved from .bss
+v595 dd 595 ; moved from .bss
+v596 dd 596 ; moved from .bss
+v597 dd 597 ; moved from .bss
+v598 dd 598 ; moved from .bss
+v599 dd 599 ; moved from .bss
+v600 dd 600 ; moved from .bss
+v601 dd 601 ; moved from .bss
+v602 dd 602 ; moved from .bss
+v603 dd 603 ; moved from .bss
+v604 dd 604 ; moved from .bss
+v605 dd 605 ; moved from .bss
+v606 dd 606 ; moved from .bss
+v607 dd 607 ; moved from .bss
+v608 dd 608 ; moved from .bss
+v609 dd 609 ; moved from .bss
+v610 dd 610 ; moved from .bss
+v611 dd 611 ; moved from .bss
+v612 dd 612 ; moved from .bss
+v613 dd 613 ; moved from .bss
+v614 dd 614 ; moved from .bss
+v615 dd 615 ; moved from .bss
+v616 dd 616 ; moved from .bss
+v617 dd 617 ; moved from .bss
+v618 dd 618 ; moved from .bss
+v619 dd 619 ; moved from .bss
+v620 dd 620 ; moved from .bss
+v621 dd 621 ; moved from .bss
+v622 dd 622 ; moved from .bss
+v623 dd 623 ; moved from .bss
+v624 dd 624 ; moved from .bss
+v625 dd 625 ; moved from .bss
+v626 dd 626 ; moved from .bss
+v627 dd 627 ; moved from .bss
+v628 dd 628 ; moved from .bss
+v629 dd 629 ; moved from .bss
+v630 dd 630 ; moved from .bss
+v631 dd 631 ; moved from .bss
+v632 dd 632 ; moved from .bss
+v633 dd 633 ; moved from .bss
+v634 dd 634 ; moved from .bss
+v635 dd 635 ; moved from .bss
+v636 dd 636 ; moved from .bss
+v637 dd 637 ; moved from .bss
+v638 dd 638 ; moved from .bss
+v639 dd 639 ; moved from .bss
+v640 dd 640 ; moved from .bss
+v641 dd 641 ; moved from .bss
+v642 dd 642 ; moved from .bss
+v643 dd 643 ; moved from .bss
+v644 dd 644 ; moved from .bss
+v645 dd 645 ; moved from .bss
+v646 dd 646 ; moved from .bss
+v647 dd 647 ; moved from .bss
+v648 dd 648 ; moved from .bss
+v649 dd 649 ; moved from .bss
+v650 dd 650 ; moved from .bss
+v651 dd 651 ; moved from .bss
+v652 dd 652 ; moved from .bss
+v653 dd 653 ; moved from .bss
+v654 dd 654 ; moved from .bss
+v655 dd 655 ; moved from .bss
+v656 dd 656 ; moved from .bss
+v657 dd 657 ; moved from .bss
+v658 dd 658 ; moved from .bss
+v659 dd 659 ; moved from .bss
+v660 dd 660 ; moved from .bss
+v661 dd 661 ; moved from .bss
+v662 dd 662 ; moved from .bss
+v663 dd 663 ; moved from .bss
+v664 dd 664 ; moved from .bss
+v665 dd 665 ; moved from .bss
+v666 dd 666 ; moved from .bss
+v667 dd 667 ; moved from .bss
+v668 dd 668 ; moved from .bss
+v669 dd 669 ; moved from .bss
+v670 dd 670 ; moved from .bss
+v671 dd 671 ; moved from .bss
+v672 dd 672 ; moved from .bss
+v673 dd 673 ; moved from .bss
+v674 dd 674 ; moved from .bss
+v675 dd 675 ; moved from .bss
+v676 dd 676 ; moved from .bss
+v677 dd 677 ; moved from .bss
+v678 dd 678 ; moved from .bss
+v679 dd 679 ; moved from .bss
+v680 dd 680 ; moved from .bss
+v681 dd 681 ; moved from .bss
+v682 dd 682 ; moved from .bss
+v683 dd 683 ; moved from .bss
+v684 dd 684 ; moved from .bss
+v685 dd 685 ; moved from .bss
+v686 dd 686 ; moved from .bss
+v687 dd 687 ; moved from .bss
+v688 dd 688 ; moved from .bss
+v689 dd 689 ; moved from .bss
+v690 dd 690 ; moved from .bss
+v691 dd 691 ; moved from .bss
+v692 dd 692 ; moved from .bss
+v693 dd 693 ; moved from .bss
+v694 dd 694 ; moved from .bss
+v695 dd 695 ; moved from .bss
+v696 dd 696 ; moved from .bss
+v697 dd 697 ; moved from .bss
+v698 dd 698 ; moved from .bss
+v699 dd 699 ; moved from .bss
+v700 dd 700 ; moved from .bss
+v701 dd 701 ; moved from .bss
+v702 dd 702 ; moved from .bss
+v703 dd 703 ; moved from .bss
+v704 dd 704 ; moved from .bss
+v705 dd 705 ; moved from .bss
+v706 dd 706 ; moved from .bss
+v707 dd 707 ; moved from .bss
+v708 dd 708 ; moved from .bss
+v709 dd 709 ; moved from .bss
+v710 dd 710 ; moved from .bss
+v711 dd 711 ; moved from .bss
+v712 dd 712 ; moved from .bss
+v713 dd 713 ; moved from .bss
+v714 dd 714 ; moved from .bss
+v715 dd 715 ; moved from .bss
+v716 dd 716 ; moved from .bss
+v717 dd 717 ; moved from .bss
+v718 dd 718 ; moved from .bss
+v719 dd 719 ; moved from .bss
+v720 dd 720 ; moved from .bss
+v721 dd 721 ; moved from .bss
+v722 dd 722 ; moved from .bss
+v723 dd 723 ; moved from .bss
+v724 dd 724 ; moved from .bss
+v725 dd 725 ; moved from .bss
+v726 dd 726 ; moved from .bss
+v727 dd 727 ; moved from .bss
+v728 dd 728 ; moved from .bss
+v729 dd 729 ; moved from .bss
+v730 dd 730 ; moved from .bss
+v731 dd 731 ; moved from .bss
+v732 dd 732 ; moved from .bss
+v733 dd 733 ; moved from .bss
+v734 dd 734 ; moved from .bss
+v735 dd 735 ; moved from .bss
+v736 dd 736 ; moved from .bss
+v737 dd 737 ; moved from .bss
+v738 dd 738 ; moved from .bss
+v739 dd 739 ; moved from .bss
+v740 dd 740 ; moved from .bss
+v741 dd 741 ; moved from .bss
+v742 dd 742 ; moved from .bss
+v743 dd 743 ; moved from .bss
+v744 dd 744 ; moved from .bss
+v745 dd 745 ; moved from .bss
+v746 dd 746 ; moved from .bss
+v747 dd 747 ; moved from .bss
+v748 dd 748 ; moved from .bss
+v749 dd 749 ; moved from .bss
+v750 dd 750 ; moved from .bss
+v751 dd 751 ; moved from .bss
+v752 dd 752 ; moved from .bss
+v753 dd 753 ; moved from .bss
+v754 dd 754 ; moved from .bss
+v755 dd 755 ; moved from .bss
+v756 dd 756 ; moved from .bss
+v757 dd 757 ; moved from .bss
+v758 dd 758 ; moved from .bss
+v759 dd 759 ; moved from .bss
+v760 dd 760 ; moved from .bss
+v761 dd 761 ; moved from .bss
+v762 dd 762 ; moved from .bss
+v763 dd 763 ; moved from .bss
+v764 dd 764 ; moved from .bss
+v765 dd 765 ; moved from .bss
+v766 dd 766 ; moved from .bss
+v767 dd 767 ; moved from .bss
+v768 dd 768 ; moved from .bss
+v769 dd 769 ; moved from .bss
+v770 dd 770 ; moved from .bss
+v771 dd 771 ; moved from .bss
+v772 dd 772 ; moved from .bss
+v773 dd 773 ; moved from .bss
+v774 dd 774 ; moved from .bss
+v775 dd 775 ; moved from .bss
+v776 dd 776 ; moved from .bss
+v777 dd 777 ; moved from .bss
+v778 dd 778 ; moved from .bss
+v779 dd 779 ; moved from .bss
+v780 dd 780 ; moved from .bss
+v781 dd 781 ; moved from .bss
+v782 dd 782 ; moved from .bss
+v783 dd 783 ; moved from .bss
+v784 dd 784 ; moved from .bss
+v785 dd 785 ; moved from .bss
+v786 dd 786 ; moved from .bss
+v787 dd 787 ; moved from .bss
+v788 dd 788 ; moved from .bss
+v789 dd 789 ; moved from .bss
+v790 dd 790 ; moved from .bss
+v791 dd 791 ; moved from .bss
+v792 dd 792 ; moved from .bss
+v793 dd 793 ; moved from .bss
+v794 dd 794 ; moved from .bss
+v795 dd 795 ; moved from .bss
+v796 dd 796 ; moved from .bss
+v797 dd 797 ; moved from .bss
+v798 dd 798 ; moved from .bss
+v799 dd 799 ; moved from .bss
+v800 dd 800 ; moved from .bss
+v801 dd 801 ; moved from .bss
+v802 dd 802 ; moved from .bss
+v803 dd 803 ; moved from .bss
+v804 dd 804 ; moved from .bss
+v805 dd 805 ; moved from .bss
+v806 dd 806 ; moved from .bss
+v807 dd 807 ; moved from .bss
+v808 dd 808 ; moved from .bss
+v809 dd 809 ; moved from .bss
+v810 dd 810 ; moved from .bss
+v811 dd 811 ; moved from .bss
+v812 dd 812 ; moved from .bss
+v813 dd 813 ; moved from .bss
+v814 dd 814 ; moved from .bss
+v815 dd 815 ; moved from .bss
+v816 dd 816 ; moved from .bss
+v817 dd 817 ; moved from .bss
+v818 dd 818 ; moved from .bss
+v819 dd 819 ; moved from .bss
+v820 dd 820 ; moved from .bss
+v821 dd 821 ; moved from .bss
+v822 dd 822 ; moved from .bss
+v823 dd 823 ; moved from .bss
+v824 dd 824 ; moved from .bss
+v825 dd 825 ; moved from .bss
+v826 dd 826 ; moved from .bss
+v827 dd 827 ; moved from .bss
+v828 dd 828 ; moved from .bss
+v829 dd 829 ; moved from .bss
+v830 dd 830 ; moved from .bss
+v831 dd 831 ; moved from .bss
+v832 dd 832 ; moved from .bss
+v833 dd 833 ; moved from .bss
+v834 dd 834 ; moved from .bss
+v835 dd 835 ; moved from .bss
+v836 dd 836 ; moved from .bss
+v837 dd 837 ; moved from .bss
+v838 dd 838 ; moved from .bss
+v839 dd 839 ; moved from .bss
+v840 dd 840 ; moved from .bss
+v841 dd 841 ; moved from .bss
+v842 dd 842 ; moved from .bss
+v843 dd 843 ; moved from .bss
+v844 dd 844 ; moved from .bss
+v845 dd 845 ; moved from .bss
+v846 dd 846 ; moved from .bss
+v847 dd 847 ; moved from .bss
+v848 dd 848 ; moved from .bss
+v849 dd 849 ; moved from .bss
+v850 dd 850 ; moved from .bss
+v851 dd 851 ; moved from .bss
+v852 dd 852 ; moved from .bss
+v853 dd 853 ; moved from .bss
+v854 dd 854 ; moved from .bss
+v855 dd 855 ; moved from .bss
+v856 dd 856 ; moved from .bss
+v857 dd 857 ; moved from .bss
+v858 dd 858 ; moved from .bss
+v859 dd 859 ; moved from .bss
+v860 dd 860 ; moved from .bss
+v861 dd 861 ; moved from .bss
+v862 dd 862 ; moved from .bss
+v863 dd 863 ; moved from .bss
+v864 dd 864 ; moved from .bss
+v865 dd 865 ; moved from .bss
+v866 dd 866 ; moved from .bss
+v867 dd 867 ; moved from .bss
+v868 dd 868 ; moved from .bss
+v869 dd 869 ; moved from .bss
+v870 dd 870 ; moved from .bss
+v871 dd 871 ; moved from .bss
+v872 dd 872 ; moved from .bss
+v873 dd 873 ; moved from .bss
+v874 dd 874 ; moved from .bss
+v875 dd 875 ; moved from .bss
+v876 dd 876 ; moved from .bss
+v877 dd 877 ; moved from .bss
+v878 dd 878 ; moved from .bss
+v879 dd 879 ; moved from .bss
+v880 dd 880 ; moved from .bss
+v881 dd 881 ; moved from .bss
+v882 dd 882 ; moved from .bss
+v883 dd 883 ; moved from .bss
+v884 dd 884 ; moved from .bss
+v885 dd 885 ; moved from .bss
+v886 dd 886 ; moved from .bss
+v887 dd 887 ; moved from .bss
+v888 dd 888 ; moved from .bss
+v889 dd 889 ; moved from .bss
+v890 dd 890 ; moved from .bss
+v891 dd 891 ; moved from .bss
+v892 dd 892 ; moved from .bss
+v893 dd 893 ; moved from .bss
+v894 dd 894 ; moved from .bss
+v895 dd 895 ; moved from .bss
+v896 dd 896 ; moved from .bss
+v897 dd 897 ; moved from .bss
+v898 dd 898 ; moved from .bss
+v899 dd 899 ; moved from .bss
+v900 dd 900 ; moved from .bss
+v901 dd 901 ; moved from .bss
+v902 dd 902 ; moved from .bss
+v903 dd 903 ; moved from .bss
+v904 dd 904 ; moved from .bss
+v905 dd 905 ; moved from .bss
+v906 dd 906 ; moved from .bss
+v907 dd 907 ; moved from .bss
+v908 dd 908 ; moved from .bss
+v909 dd 909 ; moved from .bss
+v910 dd 910 ; moved from .bss
+v911 dd 911 ; moved from .bss
+v912 dd 912 ; moved from .bss
+v913 dd 913 ; moved from .bss
+v914 dd 914 ; moved from .bss
+v915 dd 915 ; moved from .bss
+v916 dd 916 ; moved from .bss
+v917 dd 917 ; moved from .bss
+v918 dd 918 ; moved from .bss
+v919 dd 919 ; moved from .bss
+v920 dd 920 ; moved from .bss
+v921 dd 921 ; moved from .bss
+v922 dd 922 ; moved from .bss
+v923 dd 923 ; moved from .bss
+v924 dd 924 ; moved from .bss
+v925 dd 925 ; moved from .bss
+v926 dd 926 ; moved from .bss
+v927 dd 927 ; moved from .bss
+v928 dd 928 ; moved from .bss
+v929 dd 929 ; moved from .bss
+v930 dd 930 ; moved from .bss
+v931 dd 931 ; moved from .bss
+v932 dd 932 ; moved from .bss
+v933 dd 933 ; moved from .bss
+v934 dd 934 ; moved from .bss
+v935 dd 935 ; moved from .bss
+v936 dd 936 ; moved from .bss
+v937 dd 937 ; moved from .bss
+v938 dd 938 ; moved from .bss
+v939 dd 939 ; moved from .bss
+v940 dd 940 ; moved from .bss
+v941 dd 941 ; moved from .bss
+v942 dd 942 ; moved from .bss
+v943 dd 943 ; moved from .bss
+v944 dd 944 ; moved from .bss
+v945 dd 945 ; moved from .bss
+v946 dd 946 ; moved from .bss
+v947 dd 947 ; moved from .bss
+v948 dd 948 ; moved from .bss
+v949 dd 949 ; moved from .bss
+v950 dd 950 ; moved from .bss
+v951 dd 951 ; moved from .bss
+v952 dd 952 ; moved from .bss
+v953 dd 953 ; moved from .bss
+v954 dd 954 ; moved from .bss
+v955 dd 955 ; moved from .bss
+v956 dd 956 ; moved from .bss
+v957 dd 957 ; moved from .bss
+v958 dd 958 ; moved from .bss
+v959 dd 959 ; moved from .bss
+v960 dd 960 ; moved from .bss
+v961 dd 961 ; moved from .bss
+v962 dd 962 ; moved from .bss
+v963 dd 963 ; moved from .bss
+v964 dd 964 ; moved from .bss
+v965 dd 965 ; moved from .bss
+v966 dd 966 ; moved from .bss
+v967 dd 967 ; moved from .bss
+v968 dd 968 ; moved from .bss
+v969 dd 969 ; moved from .bss
+v970 dd 970 ; moved from .bss
+v971 dd 971 ; moved from .bss
+v972 dd 972 ; moved from .bss
+v973 dd 973 ; moved from .bss
+v974 dd 974 ; moved from .bss
+v975 dd 975 ; moved from .bss
+v976 dd 976 ; moved from .bss
+v977 dd 977 ; moved from .bss
+v978 dd 978 ; moved from .bss
+v979 dd 979 ; moved from .bss
+v980 dd 980 ; moved from .bss
+v981 dd 981 ; moved from .bss
+v982 dd 982 ; moved from .bss
+v983 dd 983 ; moved from .bss
+v984 dd 984 ; moved from .bss
+v985 dd 985 ; moved from .bss
+v986 dd 986 ; moved from .bss
+v987 dd 987 ; moved from .bss
+v988 dd 988 ; moved from .bss
+v989 dd 989 ; moved from .bss
+v990 dd 990 ; moved from .bss
+v991 dd 991 ; moved from .bss
+v992 dd 992 ; moved from .bss
+v993 dd 993 ; moved from .bss
+v994 dd 994 ; moved from .bss
+v995 dd 995 ; moved from .bss
+v996 dd 996 ; moved from .bss
+v997 dd 997 ; moved from .bss
+v998 dd 998 ; moved from .bss
+s999 db ".text", 0 ; not .text
+v1000 dd 1000 ; moved from .bss
+v1001 dd 1001 ; moved from .bss
+v1002 dd 1002 ; moved from .bss
+v1003 dd 1003 ; moved from .bss
+v1004 dd 1004 ; moved from .bss
+v1005 dd 1005 ; moved from .bss
+v1006 dd 1006 ; moved from .bss
+v1007 dd 1007 ; moved from .bss
+v1008 dd 1008 ; moved from .bss
+v1009 dd 1009 ; moved from .bss
+v1010 dd 1010 ; moved from .bss
+v1011 dd 1011 ; moved from .bss
+v1012 dd 1012 ; moved from .bss
+v1013 dd 1013 ; moved from .bss
+v1014 dd 1014 ; moved from .bss
+v1015 dd 1015 ; moved from .bss
+v1016 dd 1016 ; moved from .bss
+v1017 dd 1017 ; moved from .bss
+v1018 dd 1018 ; moved from .bss
+v1019 dd 1019 ; moved from .bss
+v1020 dd 1020 ; moved from .bss
+v1021 dd 1021 ; moved from .bss
+v1022 dd 1022 ; moved from .bss
+v1023 dd 1023 ; moved from .bss
+v1024 dd 1024 ; moved from .bss
+v1025 dd 1025 ; moved from .bss
+v1026 dd 1026 ; moved from .bss
+v1027 dd 1027 ; moved from .bss
+v1028 dd 1028 ; moved from .bss
+v1029 dd 1029 ; moved from .bss
+v1030 dd 1030 ; moved from .bss
+v1031 dd 1031 ; moved from .bss
+v1032 dd 1032 ; moved from .bss
+v1033 dd 1033 ; moved from .bss
+v1034 dd 1034 ; moved from .bss
+v1035 dd 1035 ; moved from .bss
+v1036 dd 1036 ; moved from .bss
+v1037 dd 1037 ; moved from .bss
+v1038 dd 1038 ; moved from .bss
+v1039 dd 1039 ; moved from .bss
+v1040 dd 1040 ; moved from .bss
+v1041 dd 1041 ; moved from .bss
+v1042 dd 1042 ; moved from .bss
+v1043 dd 1043 ; moved from .bss
+v1044 dd 1044 ; moved from .bss
+v1045 dd 1045 ; moved from .bss
+v1046 dd 1046 ; moved from .bss
+v1047 dd 1047 ; moved from .bss
+v1048 dd 1048 ; moved from .bss
+v1049 dd 1049 ; moved from .bss
+v1050 dd 1050 ; moved from .bss
+v1051 dd 1051 ; moved from .bss
+v1052 dd 1052 ; moved from .bss
+v1053 dd 1053 ; moved from .bss
+v1054 dd 1054 ; moved from .bss
+v1055 dd 1055 ; moved from .bss
+v1056 dd 1056 ; moved from .bss
+v1057 dd 1057 ; moved from .bss
+v1058 dd 1058 ; moved from .bss
+v1059 dd 1059 ; moved from .bss
+v1060 dd 1060 ; moved from .bss
+v1061 dd 1061 ; moved from .bss
+v1062 dd 1062 ; moved from .bss
+v1063 dd 1063 ; moved from .bss
+v1064 dd 1064 ; moved from .bss
+v1065 dd 1065 ; moved from .bss
+v1066 dd 1066 ; moved from .bss
+v1067 dd 1067 ; moved from .bss
+v1068 dd 1068 ; moved from .bss
+v1069 dd 1069 ; moved from .bss
+v1070 dd 1070 ; moved from .bss
+v1071 dd 1071 ; moved from .bss
+v1072 dd 1072 ; moved from .bss
+v1073 dd 1073 ; moved from .bss
+v1074 dd 1074 ; moved from .bss
+v1075 dd 1075 ; moved from .bss
+v1076 dd 1076 ; moved from .bss
+v1077 dd 1077 ; moved from .bss
+v1078 dd 1078 ; moved from .bss
+v1079 dd 1079 ; moved from .bss
+v1080 dd 1080 ; moved from .bss
+v1081 dd 1081 ; moved from .bss
+v1082 dd 1082 ; moved from .bss
+v1083 dd 1083 ; moved from .bss
+v1084 dd 1084 ; moved from .bss
+v1085 dd 1085 ; moved from .bss
+v1086 dd 1086 ; moved from .bss
+v1087 dd 1087 ; moved from .bss
+v1088 dd 1088 ; moved from .bss
+v1089 dd 1089 ; moved from .bss
+v1090 dd 1090 ; moved from .bss
+v1091 dd 1091 ; moved from .bss
+v1092 dd 1092 ; moved from .bss
+v1093 dd 1093 ; moved from .bss
+v1094 dd 1094 ; moved from .bss
+v1095 dd 1095 ; moved from .bss
+v1096 dd 1096 ; moved from .bss
+v1097 dd 1097 ; moved from .bss
+v1098 dd 1098 ; moved from .bss
+v1099 dd 1099 ; moved from .bss
+v1100 dd 1100 ; moved from .bss
+v1101 dd 1101 ; moved from .bss
+v1102 dd 1102 ; moved from .bss
+v1103 dd 1103 ; moved from .bss
+v1104 dd 1104 ; moved from .bss
+v1105 dd 1105 ; moved from .bss
+v1106 dd 1106 ; moved from .bss
+v1107 dd 1107 ; moved from .bss
+v1108 dd 1108 ; moved from .bss
+v1109 dd 1109 ; moved from .bss
+v1110 dd 1110 ; moved from .bss
+v1111 dd 1111 ; moved from .bss
+v1112 dd 1112 ; moved from .bss
+v1113 dd 1113 ; moved from .bss
+v1114 dd 1114 ; moved from .bss
+v1115 dd 1115 ; moved from .bss
+v1116 dd 1116 ; moved from .bss
+v1117 dd 1117 ; moved from .bss
+v1118 dd 1118 ; moved from .bss
+v1119 dd 1119 ; moved from .bss
+v1120 dd 1120 ; moved from .bss
+v1121 dd 1121 ; moved from .bss
+v1122 dd 1122 ; moved from .bss
+v1123 dd 1123 ; moved from .bss
+v1124 dd 1124 ; moved from .bss
+v1125 dd 1125 ; moved from .bss
+v1126 dd 1126 ; moved from .bss
+v1127 dd 1127 ; moved from .bss
+v1128 dd 1128 ; moved from .bss
+v1129 dd 1129 ; moved from .bss
+v1130 dd 1130 ; moved from .bss
+v1131 dd 1131 ; moved from .bss
+v1132 dd 1132 ; moved from .bss
+v1133 dd 1133 ; moved from .bss
+v1134 dd 1134 ; moved from .bss
+v1135 dd 1135 ; moved from .bss
+v1136 dd 1136 ; moved from .bss
+v1137 dd 1137 ; moved from .bss
+v1138 dd 1138 ; moved from .bss
+v1139 dd 1139 ; moved from .bss
+v1140 dd 1140 ; moved from .bss
+v1141 dd 1141 ; moved from .bss
+v1142 dd 1142 ; moved from .bss
+v1143 dd 1143 ; moved from .bss
+v1144 dd 1144 ; moved from .bss
+v1145 dd 1145 ; moved from .bss
+v1146 dd 1146 ; moved from .bss
+v1147 dd 1147 ; moved from .bss
+v1148 dd 1148 ; moved from .bss
+v1149 dd 1149 ; moved from .bss
+v1150 dd 1150 ; moved from .bss
+v1151 dd 1151 ; moved from .bss
+v1152 dd 1152 ; moved from .bss
+v1153 dd 1153 ; moved from .bss
+v1154 dd 1154 ; moved from .bss
+v1155 dd 1155 ; moved from .bss
+v1156 dd 1156 ; moved from .bss
+v1157 dd 1157 ; moved from .bss
+v1158 dd 1158 ; moved from .bss
+v1159 dd 1159 ; moved from .bss
+v1160 dd 1160 ; moved from .bss
+v1161 dd 1161 ; moved from .bss
+v1162 dd 1162 ; moved from .bss
+v1163 dd 1163 ; moved from .bss
+v1164 dd 1164 ; moved from .bss
+v1165 dd 1165 ; moved from .bss
+v1166 dd 1166 ; moved from .bss
+v1167 dd 1167 ; moved from .bss
+v1168 dd 1168 ; moved from .bss
+v1169 dd 1169 ; moved from .bss
+v1170 dd 1170 ; moved from .bss
+v1171 dd 1171 ; moved from .bss
+v1172 dd 1172 ; moved from .bss
+v1173 dd 1173 ; moved from .bss
+v1174 dd 1174 ; moved from .bss
+v1175 dd 1175 ; moved from .bss
+v1176 dd 1176 ; moved from .bss
+v1177 dd 1177 ; moved from .bss
+v1178 dd 1178 ; moved from .bss
+v1179 dd 1179 ; moved from .bss
+v1180 dd 1180 ; moved from .bss
+v1181 dd 1181 ; moved from .bss
+v1182 dd 1182 ; moved from .bss
+v1183 dd 1183 ; moved from .bss
+v1184 dd 1184 ; moved from .bss
+v1185 dd 1185 ; moved from .bss
+v1186 dd 1186 ; moved from .bss
+v1187 dd 1187 ; moved from .bss
+v1188 dd 1188 ; moved from .bss
+v1189 dd 1189 ; moved from .bss
+v1190 dd 1190 ; moved from .bss
+v1191 dd 1191 ; moved from .bss
+v1192 dd 1192 ; moved from .bss
+v1193 dd 1193 ; moved from .bss
+v1194 dd 1194 ; moved from .bss
+v1195 dd 1195 ; moved from .bss
+v1196 dd 1196 ; moved from .bss
+v1197 dd 1197 ; moved from .bss
+v1198 dd 1198 ; moved from .bss
+v1199 dd 1199 ; moved from .bss
+v1200 dd 1200 ; moved from .bss
+v1201 dd 1201 ; moved from .bss
+v1202 dd 1202 ; moved from .bss
+v1203 dd 1203 ; moved from .bss
+v1204 dd 1204 ; moved from .bss
+v1205 dd 1205 ; moved from .bss
+v1206 dd 1206 ; moved from .bss
+v1207 dd 1207 ; moved from .bss
+v1208 dd 1208 ; moved from .bss
+v1209 dd 1209 ; moved from .bss
+v1210 dd 1210 ; moved from .bss
+v1211 dd 1211 ; moved from .bss
+v1212 dd 1212 ; moved from .bss
+v1213 dd 1213 ; moved from .bss
+v1214 dd 1214 ; moved from .bss
+v1215 dd 1215 ; moved from .bss
+v1216 dd 1216 ; moved from .bss
+v1217 dd 1217 ; moved from .bss
+v1218 dd 1218 ; moved from .bss
+v1219 dd 1219 ; moved from .bss
+v1220 dd 1220 ; moved from .bss
+v1221 dd 1221 ; moved from .bss
+v1222 dd 1222 ; moved from .bss
+v1223 dd 1223 ; moved from .bss
+v1224 dd 1224 ; moved from .bss
+v1225 dd 1225 ; moved from .bss
+v1226 dd 1226 ; moved from .bss
+v1227 dd 1227 ; moved from .bss
+v1228 dd 1228 ; moved from .bss
+v1229 dd 1229 ; moved from .bss
+v1230 dd 1230 ; moved from .bss
+v1231 dd 1231 ; moved from .bss
+v1232 dd 1232 ; moved from .bss
+v1233 dd 1233 ; moved from .bss
+v1234 dd 1234 ; moved from .bss
+v1235 dd 1235 ; moved from .bss
+v1236 dd 1236 ; moved from .bss
+v1237 dd 1237 ; moved from .bss
+v1238 dd 1238 ; moved from .bss
+v1239 dd 1239 ; moved from .bss
+v1240 dd 1240 ; moved from .bss
+v1241 dd 1241 ; moved from .bss
+v1242 dd 1242 ; moved from .bss
+v1243 dd 1243 ; moved from .bss
+v1244 dd 1244 ; moved from .bss
+v1245 dd 1245 ; moved from .bss
+v1246 dd 1246 ; moved from .bss
+v1247 dd 1247 ; moved from .bss
+v1248 dd 1248 ; moved from .bss
+v1249 dd 1249 ; moved from .bss
+v1250 dd 1250 ; moved from .bss
+v1251 dd 1251 ; moved from .bss
+v1252 dd 1252 ; moved from .bss
+v1253 dd 1253 ; moved from .bss
+v1254 dd 1254 ; moved from .bss
+v1255 dd 1255 ; moved from .bss
+v1256 dd 1256 ; moved from .bss
+v1257 dd 1257 ; moved from .bss
+v1258 dd 1258 ; moved from .bss
+v1259 dd 1259 ; moved from .bss
+v1260 dd 1260 ; moved from .bss
+v1261 dd 1261 ; moved from .bss
+v1262 dd 1262 ; moved from .bss
+v1263 dd 1263 ; moved from .bss
+v1264 dd 1264 ; moved from .bss
+v1265 dd 1265 ; moved from .bss
+v1266 dd 1266 ; moved from .bss
+v1267 dd 1267 ; moved from .bss
+v1268 dd 1268 ; moved from .bss
+v1269 dd 1269 ; moved from .bss
+v1270 dd 1270 ; moved from .bss
+v1271 dd 1271 ; moved from .bss
+v1272 dd 1272 ; moved from .bss
+v1273 dd 1273 ; moved from .bss
+v1274 dd 1274 ; moved from .bss
+v1275 dd 1275 ; moved from .bss
+v1276 dd 1276 ; moved from .bss
+v1277 dd 1277 ; moved from .bss
+v1278 dd 1278 ; moved from .bss
+v1279 dd 1279 ; moved from .bss
+v1280 dd 1280 ; moved from .bss
+v1281 dd 1281 ; moved from .bss
+v1282 dd 1282 ; moved from .bss
+v1283 dd 1283 ; moved from .bss
+v1284 dd 1284 ; moved from .bss
+v1285 dd 1285 ; moved from .bss
+v1286 dd 1286 ; moved from .bss
+v1287 dd 1287 ; moved from .bss
+v1288 dd 1288 ; moved from .bss
+v1289 dd 1289 ; moved from .bss
+v1290 dd 1290 ; moved from .bss
+v1291 dd 1291 ; moved from .bss
+v1292 dd 1292 ; moved from .bss
+v1293 dd 1293 ; moved from .bss
+v1294 dd 1294 ; moved from .bss
+v1295 dd 1295 ; moved from .bss
+v1296 dd 1296 ; moved from .bss
+v1297 dd 1297 ; moved from .bss
+v1298 dd 1298 ; moved from .bss
+v1299 dd 1299 ; moved from .bss
+v1300 dd 1300 ; moved from .bss
+v1301 dd 1301 ; moved from .bss
+v1302 dd 1302 ; moved from .bss
+v1303 dd 1303 ; moved from .bss
+v1304 dd 1304 ; moved from .bss
+v1305 dd 1305 ; moved from .bss
+v1306 dd 1306 ; moved from .bss
+v1307 dd 1307 ; moved from .bss
+v1308 dd 1308 ; moved from .bss
+v1309 dd 1309 ; moved from .bss
+v1310 dd 1310 ; moved from .bss
+v1311 dd 1311 ; moved from .bss
+v1312 dd 1312 ; moved from .bss
+v1313 dd 1313 ; moved from .bss
+v1314 dd 1314 ; moved from .bss
+v1315 dd 1315 ; moved from .bss
+v1316 dd 1316 ; moved from .bss
+v1317 dd 1317 ; moved from .bss
+v1318 dd 1318 ; moved from .bss
+v1319 dd 1319 ; moved from .bss
+v1320 dd 1320 ; moved from .bss
+v1321 dd 1321 ; moved from .bss
+v1322 dd 1322 ; moved from .bss
+v1323 dd 1323 ; moved from .bss
+v1324 dd 1324 ; moved from .bss
+v1325 dd 1325 ; moved from .bss
+v1326 dd 1326 ; moved from .bss
+v1327 dd 1327 ; moved from .bss
+v1328 dd 1328 ; moved from .bss
+v1329 dd 1329 ; moved from .bss
+v1330 dd 1330 ; moved from .bss
+v1331 dd 1331 ; moved from .bss
+v1332 dd 1332 ; moved from .bss
+v1333 dd 1333 ; moved from .bss
+v1334 dd 1334 ; moved from .bss
+v1335 dd 1335 ; moved from .bss
+v1336 dd 1336 ; moved from .bss
+v1337 dd 1337 ; moved from .bss
+v1338 dd 1338 ; moved from .bss
+v1339 dd 1339 ; moved from .bss
+v1340 dd 1340 ; moved from .bss
+v1341 dd 1341 ; moved from .bss
+v1342 dd 1342 ; moved from .bss
+v1343 dd 1343 ; moved from .bss
+v1344 dd 1344 ; moved from .bss
+v1345 dd 1345 ; moved from .bss
+v1346 dd 1346 ; moved from .bss
+v1347 dd 1347 ; moved from .bss
+v1348 dd 1348 ; moved from .bss
+v1349 dd 1349 ; moved from .bss
+v1350 dd 1350 ; moved from .bss
+v1351 dd 1351 ; moved from .bss
+v1352 dd 1352 ; moved from .bss
+v1353 dd 1353 ; moved from .bss
+v1354 dd 1354 ; moved from .bss
+v1355 dd 1355 ; moved from .bss
+v1356 dd 1356 ; moved from .bss
+v1357 dd 1357 ; moved from .bss
+v1358 dd 1358 ; moved from .bss
+v1359 dd 1359 ; moved from .bss
+v1360 dd 1360 ; moved from .bss
+v1361 dd 1361 ; moved from .bss
+v1362 dd 1362 ; moved from .bss
+v1363 dd 1363 ; moved from .bss
+v1364 dd 1364 ; moved from .bss
+v1365 dd 1365 ; moved from .bss
+v1366 dd 1366 ; moved from .bss
+v1367 dd 1367 ; moved from .bss
+v1368 dd 1368 ; moved from .bss
+v1369 dd 1369 ; moved from .bss
+v1370 dd 1370 ; moved from .bss
+v1371 dd 1371 ; moved from .bss
+v1372 dd 1372 ; moved from .bss
+v1373 dd 1373 ; moved from .bss
+v1374 dd 1374 ; moved from .bss
+v1375 dd 1375 ; moved from .bss
+v1376 dd 1376 ; moved from .bss
+v1377 dd 1377 ; moved from .bss
+v1378 dd 1378 ; moved from .bss
+v1379 dd 1379 ; moved from .bss
+v1380 dd 1380 ; moved from .bss
+v1381 dd 1381 ; moved from .bss
+v1382 dd 1382 ; moved from .bss
+v1383 dd 1383 ; moved from .bss
+v1384 dd 1384 ; moved from .bss
+v1385 dd 1385 ; moved from .bss
+v1386 dd 1386 ; moved from .bss
+v1387 dd 1387 ; moved from .bss
+v1388 dd 1388 ; moved from .bss
+v1389 dd 1389 ; moved from .bss
+v1390 dd 1390 ; moved from .bss
+v1391 dd 1391 ; moved from .bss
+v1392 dd 1392 ; moved from .bss
+v1393 dd 1393 ; moved from .bss
+v1394 dd 1394 ; moved from .bss
+v1395 dd 1395 ; moved from .bss
+v1396 dd 1396 ; moved from .bss
+v1397 dd 1397 ; moved from .bss
+v1398 dd 1398 ; moved from .bss
+v1399 dd 1399 ; moved from .bss
+v1400 dd 1400 ; moved from .bss
+v1401 dd 1401 ; moved from .bss
+v1402 dd 1402 ; moved from .bss
+v1403 dd 1403 ; moved from .bss
+v1404 dd 1404 ; moved from .bss
+v1405 dd 1405 ; moved from .bss
+v1406 dd 1406 ; moved from .bss
+v1407 dd 1407 ; moved from .bss
+v1408 dd 1408 ; moved from .bss
+v1409 dd 1409 ; moved from .bss
+v1410 dd 1410 ; moved from .bss
+v1411 dd 1411 ; moved from .bss
+v1412 dd 1412 ; moved from .bss
+v1413 dd 1413 ; moved from .bss
+v1414 dd 1414 ; moved from .bss
+v1415 dd 1415 ; moved from .bss
+v1416 dd 1416 ; moved from .bss
+v1417 dd 1417 ; moved from .bss
+v1418 dd 1418 ; moved from .bss
+v1419 dd 1419 ; moved from .bss
+v1420 dd 1420 ; moved from .bss
+v1421 dd 1421 ; moved from .bss
+v1422 dd 1422 ; moved from .bss
+v1423 dd 1423 ; moved from .bss
+v1424 dd 1424 ; moved from .bss
+v1425 dd 1425 ; moved from .bss
+v1426 dd 1426 ; moved from .bss
+v1427 dd 1427 ; moved from .bss
+v1428 dd 1428 ; moved from .bss
+v1429 dd 1429 ; moved from .bss
+v1430 dd 1430 ; moved from .bss
+v1431 dd 1431 ; moved from .bss
+v1432 dd 1432 ; moved from .bss
+v1433 dd 1433 ; moved from .bss
+v1434 dd 1434 ; moved from .bss
+v1435 dd 1435 ; moved from .bss
+v1436 dd 1436 ; moved from .bss
+v1437 dd 1437 ; moved from .bss
+v1438 dd 1438 ; moved from .bss
+v1439 dd 1439 ; moved from .bss
+v1440 dd 1440 ; moved from .bss
+v1441 dd 1441 ; moved from .bss
+v1442 dd 1442 ; moved from .bss
+v1443 dd 1443 ; moved from .bss
+v1444 dd 1444 ; moved from .bss
+v1445 dd 1445 ; moved from .bss
+v1446 dd 1446 ; moved from .bss
+v1447 dd 1447 ; moved from .bss
+v1448 dd 1448 ; moved from .bss
+v1449 dd 1449 ; moved from .bss
+v1450 dd 1450 ; moved from .bss
+v1451 dd 1451 ; moved from .bss
+v1452 dd 1452 ; moved from .bss
+v1453 dd 1453 ; moved from .bss
+v1454 dd 1454 ; moved from .bss
+v1455 dd 1455 ; moved from .bss
+v1456 dd 1456 ; moved from .bss
+v1457 dd 1457 ; moved from .bss
+v1458 dd 1458 ; moved from .bss
+v1459 dd 1459 ; moved from .bss
+v1460 dd 1460 ; moved from .bss
+v1461 dd 1461 ; moved from .bss
+v1462 dd 1462 ; moved from .bss
+v1463 dd 1463 ; moved from .bss
+v1464 dd 1464 ; moved from .bss
+v1465 dd 1465 ; moved from .bss
+v1466 dd 1466 ; moved from .bss
+v1467 dd 1467 ; moved from .bss
+v1468 dd 1468 ; moved from .bss
+v1469 dd 1469 ; moved from .bss
+v1470 dd 1470 ; moved from .bss
+v1471 dd 1471 ; moved from .bss
+v1472 dd 1472 ; moved from .bss
+v1473 dd 1473 ; moved from .bss
+v1474 dd 1474 ; moved from .bss
+v1475 dd 1475 ; moved from .bss
+v1476 dd 1476 ; moved from .bss
+v1477 dd 1477 ; moved from .bss
+v1478 dd 1478 ; moved from .bss
+v1479 dd 1479 ; moved from .bss
+v1480 dd 1480 ; moved from .bss
+v1481 dd 1481 ; moved from .bss
+v1482 dd 1482 ; moved from .bss
+v1483 dd 1483 ; moved from .bss
+v1484 dd 1484 ; moved from .bss
+v1485 dd 1485 ; moved from .bss
+v1486 dd 1486 ; moved from .bss
+v1487 dd 1487 ; moved from .bss
+v1488 dd 1488 ; moved from .bss
+v1489 dd 1489 ; moved from .bss
+v1490 dd 1490 ; moved from .bss
+v1491 dd 1491 ; moved from .bss
+v1492 dd 1492 ; moved from .bss
+v1493 dd 1493 ; moved from .bss
+v1494 dd 1494 ; moved from .bss
+v1495 dd 1495 ; moved from .bss
+v1496 dd 1496 ; moved from .bss
+v1497 dd 1497 ; moved from .bss
+v1498 dd 1498 ; moved from .bss
+v1499 dd 1499 ; moved from .bss
+v1500 dd 1500 ; moved from .bss
+v1501 dd 1501 ; moved from .bss
+v1502 dd 1502 ; moved from .bss
+v1503 dd 1503 ; moved from .bss
+v1504 dd 1504 ; moved from .bss
+v1505 dd 1505 ; moved from .bss
+v1506 dd 1506 ; moved from .bss
+v1507 dd 1507 ; moved from .bss
+v1508 dd 1508 ; moved from .bss
+v1509 dd 1509 ; moved from .bss
+v1510 dd 1510 ; moved from .bss
+v1511 dd 1511 ; moved from .bss
+v1512 dd 1512 ; moved from .bss
+v1513 dd 1513 ; moved from .bss
+v1514 dd 1514 ; moved from .bss
+v1515 dd 1515 ; moved from .bss
+v1516 dd 1516 ; moved from .bss
+v1517 dd 1517 ; moved from .bss
+v1518 dd 1518 ; moved from .bss
+v1519 dd 1519 ; moved from .bss
+v1520 dd 1520 ; moved from .bss
+v1521 dd 1521 ; moved from .bss
+v1522 dd 1522 ; moved from .bss
+v1523 dd 1523 ; moved from .bss
+v1524 dd 1524 ; moved from .bss
+v1525 dd 1525 ; moved from .bss
+v1526 dd 1526 ; moved from .bss
+v1527 dd 1527 ; moved from .bss
+v1528 dd 1528 ; moved from .bss
+v1529 dd 1529 ; moved from .bss
+v1530 dd 1530 ; moved from .bss
+v1531 dd 1531 ; moved from .bss
+v1532 dd 1532 ; moved from .bss
+v1533 dd 1533 ; moved from .bss
+v1534 dd 1534 ; moved from .bss
+v1535 dd 1535 ; moved from .bss
+v1536 dd 1536 ; moved from .bss
+v1537 dd 1537 ; moved from .bss
+v1538 dd 1538 ; moved from .bss
+v1539 dd 1539 ; moved from .bss
+v1540 dd 1540 ; moved from .bss
+v1541 dd 1541 ; moved from .bss
+v1542 dd 1542 ; moved from .bss
+v1543 dd 1543 ; moved from .bss
+v1544 dd 1544 ; moved from .bss
+v1545 dd 1545 ; moved from .bss
+v1546 dd 1546 ; moved from .bss
+v1547 dd 1547 ; moved from .bss
+v1548 dd 1548 ; moved from .bss
+v1549 dd 1549 ; moved from .bss
+v1550 dd 1550 ; moved from .bss
+v1551 dd 1551 ; moved from .bss
+v1552 dd 1552 ; moved from .bss
+v1553 dd 1553 ; moved from .bss
+v1554 dd 1554 ; moved from .bss
+v1555 dd 1555 ; moved from .bss
+v1556 dd 1556 ; moved from .bss
+v1557 dd 1557 ; moved from .bss
+v1558 dd 1558 ; moved from .bss
+v1559 dd 1559 ; moved from .bss
+v1560 dd 1560 ; moved from .bss
+v1561 dd 1561 ; moved from .bss
+v1562 dd 1562 ; moved from .bss
+v1563 dd 1563 ; moved from .bss
+v1564 dd 1564 ; moved from .bss
+v1565 dd 1565 ; moved from .bss
+v1566 dd 1566 ; moved from .bss
+v1567 dd 1567 ; moved from .bss
+v1568 dd 1568 ; moved from .bss
+v1569 dd 1569 ; moved from .bss
+v1570 dd 1570 ; moved from .bss
+v1571 dd 1571 ; moved from .bss
+v1572 dd 1572 ; moved from .bss
+v1573 dd 1573 ; moved from .bss
+v1574 dd 1574 ; moved from .bss
+v1575 dd 1575 ; moved from .bss
+v1576 dd 1576 ; moved from .bss
+v1577 dd 1577 ; moved from .bss
+v1578 dd 1578 ; moved from .bss
+v1579 dd 1579 ; moved from .bss
+v1580 dd 1580 ; moved from .bss
+v1581 dd 1581 ; moved from .bss
+v1582 dd 1582 ; moved from .bss
+v1583 dd 1583 ; moved from .bss
+v1584 dd 1584 ; moved from .bss
+v1585 dd 1585 ; moved from .bss
+v1586 dd 1586 ; moved from .bss
+v1587 dd 1587 ; moved from .bss
+v1588 dd 1588 ; moved from .bss
+v1589 dd 1589 ; moved from .bss
+v1590 dd 1590 ; moved from .bss
+v1591 dd 1591 ; moved from .bss
+v1592 dd 1592 ; moved from .bss
+v1593 dd 1593 ; moved from .bss
+v1594 dd 1594 ; moved from .bss
+v1595 dd 1595 ; moved from .bss
+v1596 dd 1596 ; moved from .bss
+v1597 dd 1597 ; moved from .bss
+v1598 dd 1598 ; moved from .bss
+v1599 dd 1599 ; moved from .bss
+v1600 dd 1600 ; moved from .bss
+v1601 dd 1601 ; moved from .bss
+v1602 dd 1602 ; moved from .bss
+v1603 dd 1603 ; moved from .bss
+v1604 dd 1604 ; moved from .bss
+v1605 dd 1605 ; moved from .bss
+v1606 dd 1606 ; moved from .bss
+v1607 dd 1607 ; moved from .bss
+v1608 dd 1608 ; moved from .bss
+v1609 dd 1609 ; moved from .bss
+v1610 dd 1610 ; moved from .bss
+v1611 dd 1611 ; moved from .bss
+v1612 dd 1612 ; moved from .bss
+v1613 dd 1613 ; moved from .bss
+v1614 dd 1614 ; moved from .bss
+v1615 dd 1615 ; moved from .bss
+v1616 dd 1616 ; moved from .bss
+v1617 dd 1617 ; moved from .bss
+v1618 dd 1618 ; moved from .bss
+v1619 dd 1619 ; moved from .bss
+v1620 dd 1620 ; moved from .bss
+v1621 dd 1621 ; moved from .bss
+v1622 dd 1622 ; moved from .bss
+v1623 dd 1623 ; moved from .bss
+v1624 dd 1624 ; moved from .bss
+v1625 dd 1625 ; moved from .bss
+v1626 dd 1626 ; moved from .bss
+v1627 dd 1627 ; moved from .bss
+v1628 dd 1628 ; moved from .bss
+v1629 dd 1629 ; moved from .bss
+v1630 dd 1630 ; moved from .bss
+v1631 dd 1631 ; moved from .bss
+v1632 dd 1632 ; moved from .bss
+v1633 dd 1633 ; moved from .bss
+v1634 dd 1634 ; moved from .bss
+v1635 dd 1635 ; moved from .bss
+v1636 dd 1636 ; moved from .bss
+v1637 dd 1637 ; moved from .bss
+v1638 dd 1638 ; moved from .bss
+v1639 dd 1639 ; moved from .bss
+v1640 dd 1640 ; moved from .bss
+v1641 dd 1641 ; moved from .bss
+v1642 dd 1642 ; moved from .bss
+v1643 dd 1643 ; moved from .bss
+v1644 dd 1644 ; moved from .bss
+v1645 dd 1645 ; moved from .bss
+v1646 dd 1646 ; moved from .bss
+v1647 dd 1647 ; moved from .bss
+v1648 dd 1648 ; moved from .bss
+v1649 dd 1649 ; moved from .bss
+v1650 dd 1650 ; moved from .bss
+v1651 dd 1651 ; moved from .bss
+v1652 dd 1652 ; moved from .bss
+v1653 dd 1653 ; moved from .bss
+v1654 dd 1654 ; moved from .bss
+v1655 dd 1655 ; moved from .bss
+v1656 dd 1656 ; moved from .bss
+v1657 dd 1657 ; moved from .bss
+v1658 dd 1658 ; moved from .bss
+v1659 dd 1659 ; moved from .bss
+v1660 dd 1660 ; moved from .bss
+v1661 dd 1661 ; moved from .bss
+v1662 dd 1662 ; moved from .bss
+v1663 dd 1663 ; moved from .bss
+v1664 dd 1664 ; moved from .bss
+v1665 dd 1665 ; moved from .bss
+v1666 dd 1666 ; moved from .bss
+v1667 dd 1667 ; moved from .bss
+v1668 dd 1668 ; moved from .bss
+v1669 dd 1669 ; moved from .bss
+v1670 dd 1670 ; moved from .bss
+v1671 dd 1671 ; moved from .bss
+v1672 dd 1672 ; moved from .bss
+v1673 dd 1673 ; moved from .bss
+v1674 dd 1674 ; moved from .bss
+v1675 dd 1675 ; moved from .bss
+v1676 dd 1676 ; moved from .bss
+v1677 dd 1677 ; moved from .bss
+v1678 dd 1678 ; moved from .bss
+v1679 dd 1679 ; moved from .bss
+v1680 dd 1680 ; moved from .bss
+v1681 dd 1681 ; moved from .bss
+v1682 dd 1682 ; moved from .bss
+v1683 dd 1683 ; moved from .bss
+v1684 dd 1684 ; moved from .bss
+v1685 dd 1685 ; moved from .bss
+v1686 dd 1686 ; moved from .bss
+v1687 dd 1687 ; moved from .bss
+v1688 dd 1688 ; moved from .bss
+v1689 dd 1689 ; moved from .bss
+v1690 dd 1690 ; moved from .bss
+v1691 dd 1691 ; moved from .bss
+v1692 dd 1692 ; moved from .bss
+v1693 dd 1693 ; moved from .bss
+v1694 dd 1694 ; moved from .bss
+v1695 dd 1695 ; moved from .bss
+v1696 dd 1696 ; moved from .bss
+v1697 dd 1697 ; moved from .bss
+v1698 dd 1698 ; moved from .bss
+v1699 dd 1699 ; moved from .bss
+v1700 dd 1700 ; moved from .bss
+v1701 dd 1701 ; moved from .bss
+v1702 dd 1702 ; moved from .bss
+v1703 dd 1703 ; moved from .bss
+v1704 dd 1704 ; moved from .bss
+v1705 dd 1705 ; moved from .bss
+v1706 dd 1706 ; moved from .bss
+v1707 dd 1707 ; moved from .bss
+v1708 dd 1708 ; moved from .bss
+v1709 dd 1709 ; moved from .bss
+v1710 dd 1710 ; moved from .bss
+v1711 dd 1711 ; moved from .bss
+v1712 dd 1712 ; moved from .bss
+v1713 dd 1713 ; moved from .bss
+v1714 dd 1714 ; moved from .bss
+v1715 dd 1715 ; moved from .bss
+v1716 dd 1716 ; moved from .bss
+v1717 dd 1717 ; moved from .bss
+v1718 dd 1718 ; moved from .bss
+v1719 dd 1719 ; moved from .bss
+v1720 dd 1720 ; moved from .bss
+v1721 dd 1721 ; moved from .bss
+v1722 dd 1722 ; moved from .bss
+v1723 dd 1723 ; moved from .bss
+v1724 dd 1724 ; moved from .bss
+v1725 dd 1725 ; moved from .bss
+v1726 dd 1726 ; moved from .bss
+v1727 dd 1727 ; moved from .bss
+v1728 dd 1728 ; moved from .bss
+v1729 dd 1729 ; moved from .bss
+v1730 dd 1730 ; moved from .bss
+v1731 dd 1731 ; moved from .bss
+v1732 dd 1732 ; moved from .bss
+v1733 dd 1733 ; moved from .bss
+v1734 dd 1734 ; moved from .bss
+v1735 dd 1735 ; moved from .bss
+v1736 dd 1736 ; moved from .bss
+v1737 dd 1737 ; moved from .bss
+v1738 dd 1738 ; moved from .bss
+v1739 dd 1739 ; moved from .bss
+v1740 dd 1740 ; moved from .bss
+v1741 dd 1741 ; moved from .bss
+v1742 dd 1742 ; moved from .bss
+v1743 dd 1743 ; moved from .bss
+v1744 dd 1744 ; moved from .bss
+v1745 dd 1745 ; moved from .bss
+v1746 dd 1746 ; moved from .bss
+v1747 dd 1747 ; moved from .bss
+v1748 dd 1748 ; moved from .bss
+v1749 dd 1749 ; moved from .bss
+v1750 dd 1750 ; moved from .bss
+v1751 dd 1751 ; moved from .bss
+v1752 dd 1752 ; moved from .bss
+v1753 dd 1753 ; moved from .bss
+v1754 dd 1754 ; moved from .bss
+v1755 dd 1755 ; moved from .bss
+v1756 dd 1756 ; moved from .bss
+v1757 dd 1757 ; moved from .bss
+v1758 dd 1758 ; moved from .bss
+v1759 dd 1759 ; moved from .bss
+v1760 dd 1760 ; moved from .bss
+v1761 dd 1761 ; moved from .bss
+v1762 dd 1762 ; moved from .bss
+v1763 dd 1763 ; moved from .bss
+v1764 dd 1764 ; moved from .bss
+v1765 dd 1765 ; moved from .bss
+v1766 dd 1766 ; moved from .bss
+v1767 dd 1767 ; moved from .bss
+v1768 dd 1768 ; moved from .bss
+v1769 dd 1769 ; moved from .bss
+v1770 dd 1770 ; moved from .bss
+v1771 dd 1771 ; moved from .bss
+v1772 dd 1772 ; moved from .bss
+v1773 dd 1773 ; moved from .bss
+v1774 dd 1774 ; moved from .bss
+v1775 dd 1775 ; moved from .bss
+v1776 dd 1776 ; moved from .bss
+v1777 dd 1777 ; moved from .bss
+v1778 dd 1778 ; moved from .bss
+v1779 dd 1779 ; moved from .bss
+v1780 dd 1780 ; moved from .bss
+v1781 dd 1781 ; moved from .bss
+v1782 dd 1782 ; moved from .bss
+v1783 dd 1783 ; moved from .bss
+v1784 dd 1784 ; moved from .bss
+v1785 dd 1785 ; moved from .bss
+v1786 dd 1786 ; moved from .bss
+v1787 dd 1787 ; moved from .bss
+v1788 dd 1788 ; moved from .bss
+v1789 dd 1789 ; moved from .bss
+v1790 dd 1790 ; moved from .bss
+v1791 dd 1791 ; moved from .bss
+v1792 dd 1792 ; moved from .bss
+v1793 dd 1793 ; moved from .bss
+v1794 dd 1794 ; moved from .bss
+v1795 dd 1795 ; moved from .bss
+v1796 dd 1796 ; moved from .bss
+v1797 dd 1797 ; moved from .bss
+v1798 dd 1798 ; moved from .bss
+v1799 dd 1799 ; moved from .bss
+v1800 dd 1800 ; moved from .bss
+v1801 dd 1801 ; moved from .bss
+v1802 dd 1802 ; moved from .bss
+v1803 dd 1803 ; moved from .bss
+v1804 dd 1804 ; moved from .bss
+v1805 dd 1805 ; moved from .bss
+v1806 dd 1806 ; moved from .bss
+v1807 dd 1807 ; moved from .bss
+v1808 dd 1808 ; moved from .bss
+v1809 dd 1809 ; moved from .bss
+v1810 dd 1810 ; moved from .bss
+v1811 dd 1811 ; moved from .bss
+v1812 dd 1812 ; moved from .bss
+v1813 dd 1813 ; moved from .bss
+v1814 dd 1814 ; moved from .bss
+v1815 dd 1815 ; moved from .bss
+v1816 dd 1816 ; moved from .bss
+v1817 dd 1817 ; moved from .bss
+v1818 dd 1818 ; moved from .bss
+v1819 dd 1819 ; moved from .bss
+v1820 dd 1820 ; moved from .bss
+v1821 dd 1821 ; moved from .bss
+v1822 dd 1822 ; moved from .bss
+v1823 dd 1823 ; moved from .bss
+v1824 dd 1824 ; moved from .bss
+v1825 dd 1825 ; moved from .bss
+v1826 dd 1826 ; moved from .bss
+v1827 dd 1827 ; moved from .bss
+v1828 dd 1828 ; moved from .bss
+v1829 dd 1829 ; moved from .bss
+v1830 dd 1830 ; moved from .bss
+v1831 dd 1831 ; moved from .bss
+v1832 dd 1832 ; moved from .bss
+v1833 dd 1833 ; moved from .bss
+v1834 dd 1834 ; moved from .bss
+v1835 dd 1835 ; moved from .bss
+v1836 dd 1836 ; moved from .bss
+v1837 dd 1837 ; moved from .bss
+v1838 dd 1838 ; moved from .bss
+v1839 dd 1839 ; moved from .bss
+v1840 dd 1840 ; moved from .bss
+v1841 dd 1841 ; moved from .bss
+v1842 dd 1842 ; moved from .bss
+v1843 dd 1843 ; moved from .bss
+v1844 dd 1844 ; moved from .bss
+v1845 dd 1845 ; moved from .bss
+v1846 dd 1846 ; moved from .bss
+v1847 dd 1847 ; moved from .bss
+v1848 dd 1848 ; moved from .bss
+v1849 dd 1849 ; moved from .bss
+v1850 dd 1850 ; moved from .bss
+v1851 dd 1851 ; moved from .bss
+v1852 dd 1852 ; moved from .bss
+v1853 dd 1853 ; moved from .bss
+v1854 dd 1854 ; moved from .bss
+v1855 dd 1855 ; moved from .bss
+v1856 dd 1856 ; moved from .bss
+v1857 dd 1857 ; moved from .bss
+v1858 dd 1858 ; moved from .bss
+v1859 dd 1859 ; moved from .bss
+v1860 dd 1860 ; moved from .bss
+v1861 dd 1861 ; moved from .bss
+v1862 dd 1862 ; moved from .bss
+v1863 dd 1863 ; moved from .bss
+v1864 dd 1864 ; moved from .bss
+v1865 dd 1865 ; moved from .bss
+v1866 dd 1866 ; moved from .bss
+v1867 dd 1867 ; moved from .bss
+v1868 dd 1868 ; moved from .bss
+v1869 dd 1869 ; moved from .bss
+v1870 dd 1870 ; moved from .bss
+v1871 dd 1871 ; moved from .bss
+v1872 dd 1872 ; moved from .bss
+v1873 dd 1873 ; moved from .bss
+v1874 dd 1874 ; moved from .bss
+v1875 dd 1875 ; moved from .bss
+v1876 dd 1876 ; moved from .bss
+v1877 dd 1877 ; moved from .bss
+v1878 dd 1878 ; moved from .bss
+v1879 dd 1879 ; moved from .bss
+v1880 dd 1880 ; moved from .bss
+v1881 dd 1881 ; moved from .bss
+v1882 dd 1882 ; moved from .bss
+v1883 dd 1883 ; moved from .bss
+v1884 dd 1884 ; moved from .bss
+v1885 dd 1885 ; moved from .bss
+v1886 dd 1886 ; moved from .bss
+v1887 dd 1887 ; moved from .bss
+v1888 dd 1888 ; moved from .bss
+v1889 dd 1889 ; moved from .bss
+v1890 dd 1890 ; moved from .bss
+v1891 dd 1891 ; moved from .bss
+v1892 dd 1892 ; moved from .bss
+v1893 dd 1893 ; moved from .bss
+v1894 dd 1894 ; moved from .bss
+v1895 dd 1895 ; moved from .bss
+v1896 dd 1896 ; moved from .bss
+v1897 dd 1897 ; moved from .bss
+v1898 dd 1898 ; moved from .bss
+v1899 dd 1899 ; moved from .bss
+v1900 dd 1900 ; moved from .bss
+v1901 dd 1901 ; moved from .bss
+v1902 dd 1902 ; moved from .bss
+v1903 dd 1903 ; moved from .bss
+v1904 dd 1904 ; moved from .bss
+v1905 dd 1905 ; moved from .bss
+v1906 dd 1906 ; moved from .bss
+v1907 dd 1907 ; moved from .bss
+v1908 dd 1908 ; moved from .bss
+v1909 dd 1909 ; moved from .bss
+v1910 dd 1910 ; moved from .bss
+v1911 dd 1911 ; moved from .bss
+v1912 dd 1912 ; moved from .bss
+v1913 dd 1913 ; moved from .bss
+v1914 dd 1914 ; moved from .bss
+v1915 dd 1915 ; moved from .bss
+v1916 dd 1916 ; moved from .bss
+v1917 dd 1917 ; moved from .bss
+v1918 dd 1918 ; moved from .bss
+v1919 dd 1919 ; moved from .bss
+v1920 dd 1920 ; moved from .bss
+v1921 dd 1921 ; moved from .bss
+v1922 dd 1922 ; moved from .bss
+v1923 dd 1923 ; moved from .bss
+v1924 dd 1924 ; moved from .bss
+v1925 dd 1925 ; moved from .bss
+v1926 dd 1926 ; moved from .bss
+v1927 dd 1927 ; moved from .bss
+v1928 dd 1928 ; moved from .bss
+v1929 dd 1929 ; moved from .bss
+v1930 dd 1930 ; moved from .bss
+v1931 dd 1931 ; moved from .bss
+v1932 dd 1932 ; moved from .bss
+v1933 dd 1933 ; moved from .bss
+v1934 dd 1934 ; moved from .bss
+v1935 dd 1935 ; moved from .bss
+v1936 dd 1936 ; moved from .bss
+v1937 dd 1937 ; moved from .bss
+v1938 dd 1938 ; moved from .bss
+v1939 dd 1939 ; moved from .bss
+v1940 dd 1940 ; moved from .bss
+v1941 dd 1941 ; moved from .bss
+v1942 dd 1942 ; moved from .bss
+v1943 dd 1943 ; moved from .bss
+v1944 dd 1944 ; moved from .bss
+v1945 dd 1945 ; moved from .bss
+v1946 dd 1946 ; moved from .bss
+v1947 dd 1947 ; moved from .bss
+v1948 dd 1948 ; moved from .bss
+v1949 dd 1949 ; moved from .bss
+v1950 dd 1950 ; moved from .bss
+v1951 dd 1951 ; moved from .bss
+v1952 dd 1952 ; moved from .bss
+v1953 dd 1953 ; moved from .bss
+v1954 dd 1954 ; moved from .bss
+v1955 dd 1955 ; moved from .bss
+v1956 dd 1956 ; moved from .bss
+v1957 dd 1957 ; moved from .bss
+v1958 dd 1958 ; moved from .bss
+v1959 dd 1959 ; moved from .bss
+v1960 dd 1960 ; moved from .bss
+v1961 dd 1961 ; moved from .bss
+v1962 dd 1962 ; moved from .bss
+v1963 dd 1963 ; moved from .bss
+v1964 dd 1964 ; moved from .bss
+v1965 dd 1965 ; moved from .bss
+v1966 dd 1966 ; moved from .bss
+v1967 dd 1967 ; moved from .bss
+v1968 dd 1968 ; moved from .bss
+v1969 dd 1969 ; moved from .bss
+v1970 dd 1970 ; moved from .bss
+v1971 dd 1971 ; moved from .bss
+v1972 dd 1972 ; moved from .bss
+v1973 dd 1973 ; moved from .bss
+v1974 dd 1974 ; moved from .bss
+v1975 dd 1975 ; moved from .bss
+v1976 dd 1976 ; moved from .bss
+v1977 dd 1977 ; moved from .bss
+v1978 dd 1978 ; moved from .bss
+v1979 dd 1979 ; moved from .bss
+v1980 dd 1980 ; moved from .bss
+v1981 dd 1981 ; moved from .bss
+v1982 dd 1982 ; moved from .bss
+v1983 dd 1983 ; moved from .bss
+v1984 dd 1984 ; moved from .bss
+v1985 dd 1985 ; moved from .bss
+v1986 dd 1986 ; moved from .bss
+v1987 dd 1987 ; moved from .bss
+v1988 dd 1988 ; moved from .bss
+v1989 dd 1989 ; moved from .bss
+v1990 dd 1990 ; moved from .bss
+v1991 dd 1991 ; moved from .bss
+v1992 dd 1992 ; moved from .bss
+v1993 dd 1993 ; moved from .bss
+v1994 dd 1994 ; moved from .bss
+v1995 dd 1995 ; moved from .bss
+v1996 dd 1996 ; moved from .bss
+v1997 dd 1997 ; moved from .bss
+v1998 dd 1998 ; moved from .bss
+s1999 db ".text", 0 ; not .text
+v2000 dd 2000 ; moved from .bss
+v2001 dd 2001 ; moved from .bss
+v2002 dd 2002 ; moved from .bss
+v2003 dd 2003 ; moved from .bss
+v2004 dd 2004 ; moved from .bss
+v2005 dd 2005 ; moved from .bss
+v2006 dd 2006 ; moved from .bss
+v2007 dd 2007 ; moved from .bss
+v2008 dd 2008 ; moved from .bss
+v2009 dd 2009 ; moved from .bss
+v2010 dd 2010 ; moved from .bss
+v2011 dd 2011 ; moved from .bss
+v2012 dd 2012 ; moved from .bss
+v2013 dd 2013 ; moved from .bss
+v2014 dd 2014 ; moved from .bss
+v2015 dd 2015 ; moved from .bss
+v2016 dd 2016 ; moved from .bss
+v2017 dd 2017 ; moved from .bss
+v2018 dd 2018 ; moved from .bss
+v2019 dd 2019 ; moved from .bss
+v2020 dd 2020 ; moved from .bss
+v2021 dd 2021 ; moved from .bss
+v2022 dd 2022 ; moved from .bss
+v2023 dd 2023 ; moved from .bss
+v2024 dd 2024 ; moved from .bss
+v2025 dd 2025 ; moved from .bss
+v2026 dd 2026 ; moved from .bss
+v2027 dd 2027 ; moved from .bss
+v2028 dd 2028 ; moved from .bss
+v2029 dd 2029 ; moved from .bss
+v2030 dd 2030 ; moved from .bss
+v2031 dd 2031 ; moved from .bss
+v2032 dd 2032 ; moved from .bss
+v2033 dd 2033 ; moved from .bss
+v2034 dd 2034 ; moved from .bss
+v2035 dd 2035 ; moved from .bss
+v2036 dd 2036 ; moved from .bss
+v2037 dd 2037 ; moved from .bss
+v2038 dd 2038 ; moved from .bss
+v2039 dd 2039 ; moved from .bss
+v2040 dd 2040 ; moved from .bss
+v2041 dd 2041 ; moved from .bss
+v2042 dd 2042 ; moved from .bss
+v2043 dd 2043 ; moved from .bss
+v2044 dd 2044 ; moved from .bss
+v2045 dd 2045 ; moved from .bss
+v2046 dd 2046 ; moved from .bss
+v2047 dd 2047 ; moved from .bss
+v2048 dd 2048 ; moved from .bss
+v2049 dd 2049 ; moved from .bss
+v2050 dd 2050 ; moved from .bss
+v2051 dd 2051 ; moved from .bss
+v2052 dd 2052 ; moved from .bss
+v2053 dd 2053 ; moved from .bss
+v2054 dd 2054 ; moved from .bss
+v2055 dd 2055 ; moved from .bss
+v2056 dd 2056 ; moved from .bss
+v2057 dd 2057 ; moved from .bss
+v2058 dd 2058 ; moved from .bss
+v2059 dd 2059 ; moved from .bss
+v2060 dd 2060 ; moved from .bss
+v2061 dd 2061 ; moved from .bss
+v2062 dd 2062 ; moved from .bss
+v2063 dd 2063 ; moved from .bss
+v2064 dd 2064 ; moved from .bss
+v2065 dd 2065 ; moved from .bss
+v2066 dd 2066 ; moved from .bss
+v2067 dd 2067 ; moved from .bss
+v2068 dd 2068 ; moved from .bss
+v2069 dd 2069 ; moved from .bss
+v2070 dd 2070 ; moved from .bss
+v2071 dd 2071 ; moved from .bss
+v2072 dd 2072 ; moved from .bss
+v2073 dd 2073 ; moved from .bss
+v2074 dd 2074 ; moved from .bss
+v2075 dd 2075 ; moved from .bss
+v2076 dd 2076 ; moved from .bss
+v2077 dd 2077 ; moved from .bss
+v2078 dd 2078 ; moved from .bss
+v2079 dd 2079 ; moved from .bss
+v2080 dd 2080 ; moved from .bss
+v2081 dd 2081 ; moved from .bss
+v2082 dd 2082 ; moved from .bss
+v2083 dd 2083 ; moved from .bss
+v2084 dd 2084 ; moved from .bss
+v2085 dd 2085 ; moved from .bss
+v2086 dd 2086 ; moved from .bss
+v2087 dd 2087 ; moved from .bss
+v2088 dd 2088 ; moved from .bss
+v2089 dd 2089 ; moved from .bss
+v2090 dd 2090 ; moved from .bss
+v2091 dd 2091 ; moved from .bss
+v2092 dd 2092 ; moved from .bss
+v2093 dd 2093 ; moved from .bss
+v2094 dd 2094 ; moved from .bss
+v2095 dd 2095 ; moved from .bss
+v2096 dd 2096 ; moved from .bss
+v2097 dd 2097 ; moved from .bss
+v2098 dd 2098 ; moved from .bss
+v2099 dd 2099 ; moved from .bss
+v2100 dd 2100 ; moved from .bss
+v2101 dd 2101 ; moved from .bss
+v2102 dd 2102 ; moved from .bss
+v2103 dd 2103 ; moved from .bss
+v2104 dd 2104 ; moved from .bss
+v2105 dd 2105 ; moved from .bss
+v2106 dd 2106 ; moved from .bss
+v2107 dd 2107 ; moved from .bss
+v2108 dd 2108 ; moved from .bss
+v2109 dd 2109 ; moved from .bss
+v2110 dd 2110 ; moved from .bss
+v2111 dd 2111 ; moved from .bss
+v2112 dd 2112 ; moved from .bss
+v2113 dd 2113 ; moved from .bss
+v2114 dd 2114 ; moved from .bss
+v2115 dd 2115 ; moved from .bss
+v2116 dd 2116 ; moved from .bss
+v2117 dd 2117 ; moved from .bss
+v2118 dd 2118 ; moved from .bss
+v2119 dd 2119 ; moved from .bss
+v2120 dd 2120 ; moved from .bss
+v2121 dd 2121 ; moved from .bss
+v2122 dd 2122 ; moved from .bss
+v2123 dd 2123 ; moved from .bss
+v2124 dd 2124 ; moved from .bss
+v2125 dd 2125 ; moved from .bss
+v2126 dd 2126 ; moved from .bss
+v2127 dd 2127 ; moved from .bss
+v2128 dd 2128 ; moved from .bss
+v2129 dd 2129 ; moved from .bss
+v2130 dd 2130 ; moved from .bss
+v2131 dd 2131 ; moved from .bss
+v2132 dd 2132 ; moved from .bss
+v2133 dd 2133 ; moved from .bss
+v2134 dd 2134 ; moved from .bss
+v2135 dd 2135 ; moved from .bss
+v2136 dd 2136 ; moved from .bss
+v2137 dd 2137 ; moved from .bss
+v2138 dd 2138 ; moved from .bss
+v2139 dd 2139 ; moved from .bss
+v2140 dd 2140 ; moved from .bss
+v2141 dd 2141 ; moved from .bss
+v2142 dd 2142 ; moved from .bss
+v2143 dd 2143 ; moved from .bss
+v2144 dd 2144 ; moved from .bss
+v2145 dd 2145 ; moved from .bss
+v2146 dd 2146 ; moved from .bss
+v2147 dd 2147 ; moved from .bss
+v2148 dd 2148 ; moved from .bss
+v2149 dd 2149 ; moved from .bss
+v2150 dd 2150 ; moved from .bss
+v2151 dd 2151 ; moved from .bss
+v2152 dd 2152 ; moved from .bss
+v2153 dd 2153 ; moved from .bss
+v2154 dd 2154 ; moved from .bss
+v2155 dd 2155 ; moved from .bss
+v2156 dd 2156 ; moved from .bss
+v2157 dd 2157 ; moved from .bss
+v2158 dd 2158 ; moved from .bss
+v2159 dd 2159 ; moved from .bss
+v2160 dd 2160 ; moved from .bss
+v2161 dd 2161 ; moved from .bss
+v2162 dd 2162 ; moved from .bss
+v2163 dd 2163 ; moved from .bss
+v2164 dd 2164 ; moved from .bss
+v2165 dd 2165 ; moved from .bss
+v2166 dd 2166 ; moved from .bss
+v2167 dd 2167 ; moved from .bss
+v2168 dd 2168 ; moved from .bss
+v2169 dd 2169 ; moved from .bss
+v2170 dd 2170 ; moved from .bss
+v2171 dd 2171 ; moved from .bss
+v2172 dd 2172 ; moved from .bss
+v2173 dd 2173 ; moved from .bss
+v2174 dd 2174 ; moved from .bss
+v2175 dd 2175 ; moved from .bss
+v2176 dd 2176 ; moved from .bss
+v2177 dd 2177 ; moved from .bss
+v2178 dd 2178 ; moved from .bss
+v2179 dd 2179 ; moved from .bss
+v2180 dd 2180 ; moved from .bss
+v2181 dd 2181 ; moved from .bss
+v2182 dd 2182 ; moved from .bss
+v2183 dd 2183 ; moved from .bss
+v2184 dd 2184 ; moved from .bss
+v2185 dd 2185 ; moved from .bss
+v2186 dd 2186 ; moved from .bss
+v2187 dd 2187 ; moved from .bss
+v2188 dd 2188 ; moved from .bss
+v2189 dd 2189 ; moved from .bss
+v2190 dd 2190 ; moved from .bss
+v2191 dd 2191 ; moved from .bss
+v2192 dd 2192 ; moved from .bss
+v2193 dd 2193 ; moved from .bss
+v2194 dd 2194 ; moved from .bss
+v2195 dd 2195 ; moved from .bss
+v2196 dd 2196 ; moved from .bss
+v2197 dd 2197 ; moved from .bss
+v2198 dd 2198 ; moved from .bss
+v2199 dd 2199 ; moved from .bss
+v2200 dd 2200 ; moved from .bss
+v2201 dd 2201 ; moved from .bss
+v2202 dd 2202 ; moved from .bss
+v2203 dd 2203 ; moved from .bss
+v2204 dd 2204 ; moved from .bss
+v2205 dd 2205 ; moved from .bss
+v2206 dd 2206 ; moved from .bss
+v2207 dd 2207 ; moved from .bss
+v2208 dd 2208 ; moved from .bss
+v2209 dd 2209 ; moved from .bss
+v2210 dd 2210 ; moved from .bss
+v2211 dd 2211 ; moved from .bss
+v2212 dd 2212 ; moved from .bss
+v2213 dd 2213 ; moved from .bss
+v2214 dd 2214 ; moved from .bss
+v2215 dd 2215 ; moved from .bss
+v2216 dd 2216 ; moved from .bss
+v2217 dd 2217 ; moved from .bss
+v2218 dd 2218 ; moved from .bss
+v2219 dd 2219 ; moved from .bss
+v2220 dd 2220 ; moved from .bss
+v2221 dd 2221 ; moved from .bss
+v2222 dd 2222 ; moved from .bss
+v2223 dd 2223 ; moved from .bss
+v2224 dd 2224 ; moved from .bss
+v2225 dd 2225 ; moved from .bss
+v2226 dd 2226 ; moved from .bss
+v2227 dd 2227 ; moved from .bss
+v2228 dd 2228 ; moved from .bss
+v2229 dd 2229 ; moved from .bss
+v2230 dd 2230 ; moved from .bss
+v2231 dd 2231 ; moved from .bss
+v2232 dd 2232 ; moved from .bss
+v2233 dd 2233 ; moved from .bss
+v2234 dd 2234 ; moved from .bss
+v2235 dd 2235 ; moved from .bss
+v2236 dd 2236 ; moved from .bss
+v2237 dd 2237 ; moved from .bss
+v2238 dd 2238 ; moved from .bss
+v2239 dd 2239 ; moved from .bss
+v2240 dd 2240 ; moved from .bss
+v2241 dd 2241 ; moved from .bss
+v2242 dd 2242 ; moved from .bss
+v2243 dd 2243 ; moved from .bss
+v2244 dd 2244 ; moved from .bss
+v2245 dd 2245 ; moved from .bss
+v2246 dd 2246 ; moved from .bss
+v2247 dd 2247 ; moved from .bss
+v2248 dd 2248 ; moved from .bss
+v2249 dd 2249 ; moved from .bss
+v2250 dd 2250 ; moved from .bss
+v2251 dd 2251 ; moved from .bss
+v2252 dd 2252 ; moved from .bss
+v2253 dd 2253 ; moved from .bss
+v2254 dd 2254 ; moved from .bss
+v2255 dd 2255 ; moved from .bss
+v2256 dd 2256 ; moved from .bss
+v2257 dd 2257 ; moved from .bss
+v2258 dd 2258 ; moved from .bss
+v2259 dd 2259 ; moved from .bss
+v2260 dd 2260 ; moved from .bss
+v2261 dd 2261 ; moved from .bss
+v2262 dd 2262 ; moved from .bss
+v2263 dd 2263 ; moved from .bss
+v2264 dd 2264 ; moved from .bss
+v2265 dd 2265 ; moved from .bss
+v2266 dd 2266 ; moved from .bss
+v2267 dd 2267 ; moved from .bss
+v2268 dd 2268 ; moved from .bss
+v2269 dd 2269 ; moved from .bss
+v2270 dd 2270 ; moved from .bss
+v2271 dd 2271 ; moved from .bss
+v2272 dd 2272 ; moved from .bss
+v2273 dd 2273 ; moved from .bss
+v2274 dd 2274 ; moved from .bss
+v2275 dd 2275 ; moved from .bss
+v2276 dd 2276 ; moved from .bss
+v2277 dd 2277 ; moved from .bss
+v2278 dd 2278 ; moved from .bss
+v2279 dd 2279 ; moved from .bss
+v2280 dd 2280 ; moved from .bss
+v2281 dd 2281 ; moved from .bss
+v2282 dd 2282 ; moved from .bss
+v2283 dd 2283 ; moved from .bss
+v2284 dd 2284 ; moved from .bss
+v2285 dd 2285 ; moved from .bss
+v2286 dd 2286 ; moved from .bss
+v2287 dd 2287 ; moved from .bss
+v2288 dd 2288 ; moved from .bss
+v2289 dd 2289 ; moved from .bss
+v2290 dd 2290 ; moved from .bss
+v2291 dd 2291 ; moved from .bss
+v2292 dd 2292 ; moved from .bss
+v2293 dd 2293 ; moved from .bss
+v2294 dd 2294 ; moved from .bss
+v2295 dd 2295 ; moved from .bss
+v2296 dd 2296 ; moved from .bss
+v2297 dd 2297 ; moved from .bss
+v2298 dd 2298 ; moved from .bss
+v2299 dd 2299 ; moved from .bss
+v2300 dd 2300 ; moved from .bss
+v2301 dd 2301 ; moved from .bss
+v2302 dd 2302 ; moved from .bss
+v2303 dd 2303 ; moved from .bss
+v2304 dd 2304 ; moved from .bss
+v2305 dd 2305 ; moved from .bss
+v2306 dd 2306 ; moved from .bss
+v2307 dd 2307 ; moved from .bss
+v2308 dd 2308 ; moved from .bss
+v2309 dd 2309 ; moved from .bss
+v2310 dd 2310 ; moved from .bss
+v2311 dd 2311 ; moved from .bss
+v2312 dd 2312 ; moved from .bss
+v2313 dd 2313 ; moved from .bss
+v2314 dd 2314 ; moved from .bss
+v2315 dd 2315 ; moved from .bss
+v2316 dd 2316 ; moved from .bss
+v2317 dd 2317 ; moved from .bss
+v2318 dd 2318 ; moved from .bss
+v2319 dd 2319 ; moved from .bss
+v2320 dd 2320 ; moved from .bss
+v2321 dd 2321 ; moved from .bss
+v2322 dd 2322 ; moved from .bss
+v2323 dd 2323 ; moved from .bss
+v2324 dd 2324 ; moved from .bss
+v2325 dd 2325 ; moved from .bss
+v2326 dd 2326 ; moved from .bss
+v2327 dd 2327 ; moved from .bss
+v2328 dd 2328 ; moved from .bss
+v2329 dd 2329 ; moved from .bss
+v2330 dd 2330 ; moved from .bss
+v2331 dd 2331 ; moved from .bss
+v2332 dd 2332 ; moved from .bss
+v2333 dd 2333 ; moved from .bss
+v2334 dd 2334 ; moved from .bss
+v2335 dd 2335 ; moved from .bss
+v2336 dd 2336 ; moved from .bss
+v2337 dd 2337 ; moved from .bss
+v2338 dd 2338 ; moved from .bss
+v2339 dd 2339 ; moved from .bss
+v2340 dd 2340 ; moved from .bss
+v2341 dd 2341 ; moved from .bss
+v2342 dd 2342 ; moved from .bss
+v2343 dd 2343 ; moved from .bss
+v2344 dd 2344 ; moved from .bss
+v2345 dd 2345 ; moved from .bss
+v2346 dd 2346 ; moved from .bss
+v2347 dd 2347 ; moved from .bss
+v2348 dd 2348 ; moved from .bss
+v2349 dd 2349 ; moved from .bss
+v2350 dd 2350 ; moved from .bss
+v2351 dd 2351 ; moved from .bss
+v2352 dd 2352 ; moved from .bss
+v2353 dd 2353 ; moved from .bss
+v2354 dd 2354 ; moved from .bss
+v2355 dd 2355 ; moved from .bss
+v2356 dd 2356 ; moved from .bss
+v2357 dd 2357 ; moved from .bss
+v2358 dd 2358 ; moved from .bss
+v2359 dd 2359 ; moved from .bss
+v2360 dd 2360 ; moved from .bss
+v2361 dd 2361 ; moved from .bss
+v2362 dd 2362 ; moved from .bss
+v2363 dd 2363 ; moved from .bss
+v2364 dd 2364 ; moved from .bss
+v2365 dd 2365 ; moved from .bss
+v2366 dd 2366 ; moved from .bss
+v2367 dd 2367 ; moved from .bss
+v2368 dd 2368 ; moved from .bss
+v2369 dd 2369 ; moved from .bss
+v2370 dd 2370 ; moved from .bss
+v2371 dd 2371 ; moved from .bss
+v2372 dd 2372 ; moved from .bss
+v2373 dd 2373 ; moved from .bss
+v2374 dd 2374 ; moved from .bss
+v2375 dd 2375 ; moved from .bss
+v2376 dd 2376 ; moved from .bss
+v2377 dd 2377 ; moved from .bss
+v2378 dd 2378 ; moved from .bss
+v2379 dd 2379 ; moved from .bss
+v2380 dd 2380 ; moved from .bss
+v2381 dd 2381 ; moved from .bss
+v2382 dd 2382 ; moved from .bss
+v2383 dd 2383 ; moved from .bss
+v2384 dd 2384 ; moved from .bss
+v2385 dd 2385 ; moved from .bss
+v2386 dd 2386 ; moved from .bss
+v2387 dd 2387 ; moved from .bss
+v2388 dd 2388 ; moved from .bss
+v2389 dd 2389 ; moved from .bss
+v2390 dd 2390 ; moved from .bss
+v2391 dd 2391 ; moved from .bss
+v2392 dd 2392 ; moved from .bss
+v2393 dd 2393 ; moved from .bss
+v2394 dd 2394 ; moved from .bss
+v2395 dd 2395 ; moved from .bss
+v2396 dd 2396 ; moved from .bss
+v2397 dd 2397 ; moved from .bss
+v2398 dd 2398 ; moved from .bss
+v2399 dd 2399 ; moved from .bss
+v2400 dd 2400 ; moved from .bss
+v2401 dd 2401 ; moved from .bss
+v2402 dd 2402 ; moved from .bss
+v2403 dd 2403 ; moved from .bss
+v2404 dd 2404 ; moved from .bss
+v2405 dd 2405 ; moved from .bss
+v2406 dd 2406 ; moved from .bss
+v2407 dd 2407 ; moved from .bss
+v2408 dd 2408 ; moved from .bss
+v2409 dd 2409 ; moved from .bss
+v2410 dd 2410 ; moved from .bss
+v2411 dd 2411 ; moved from .bss
+v2412 dd 2412 ; moved from .bss
+v2413 dd 2413 ; moved from .bss
+v2414 dd 2414 ; moved from .bss
+v2415 dd 2415 ; moved from .bss
+v2416 dd 2416 ; moved from .bss
+v2417 dd 2417 ; moved from .bss
+v2418 dd 2418 ; moved from .bss
+v2419 dd 2419 ; moved from .bss
+v2420 dd 2420 ; moved from .bss
+v2421 dd 2421 ; moved from .bss
+v2422 dd 2422 ; moved from .bss
+v2423 dd 2423 ; moved from .bss
+v2424 dd 2424 ; moved from .bss
+v2425 dd 2425 ; moved from .bss
+v2426 dd 2426 ; moved from .bss
+v2427 dd 2427 ; moved from .bss
+v2428 dd 2428 ; moved from .bss
+v2429 dd 2429 ; moved from .bss
+v2430 dd 2430 ; moved from .bss
+v2431 dd 2431 ; moved from .bss
+v2432 dd 2432 ; moved from .bss
+v2433 dd 2433 ; moved from .bss
+v2434 dd 2434 ; moved from .bss
+v2435 dd 2435 ; moved from .bss
+v2436 dd 2436 ; moved from .bss
+v2437 dd 2437 ; moved from .bss
+v2438 dd 2438 ; moved from .bss
+v2439 dd 2439 ; moved from .bss
+v2440 dd 2440 ; moved from .bss
+v2441 dd 2441 ; moved from .bss
+v2442 dd 2442 ; moved from .bss
+v2443 dd 2443 ; moved from .bss
+v2444 dd 2444 ; moved from .bss
+v2445 dd 2445 ; moved from .bss
+v2446 dd 2446 ; moved from .bss
+v2447 dd 2447 ; moved from .bss
+v2448 dd 2448 ; moved from .bss
+v2449 dd 2449 ; moved from .bss
+v2450 dd 2450 ; moved from .bss
+v2451 dd 2451 ; moved from .bss
+v2452 dd 2452 ; moved from .bss
+v2453 dd 2453 ; moved from .bss
+v2454 dd 2454 ; moved from .bss
+v2455 dd 2455 ; moved from .bss
+v2456 dd 2456 ; moved from .bss
+v2457 dd 2457 ; moved from .bss
+v2458 dd 2458 ; moved from .bss
+v2459 dd 2459 ; moved from .bss
+v2460 dd 2460 ; moved from .bss
+v2461 dd 2461 ; moved from .bss
+v2462 dd 2462 ; moved from .bss
+v2463 dd 2463 ; moved from .bss
+v2464 dd 2464 ; moved from .bss
+v2465 dd 2465 ; moved from .bss
+v2466 dd 2466 ; moved from .bss
+v2467 dd 2467 ; moved from .bss
+v2468 dd 2468 ; moved from .bss
+v2469 dd 2469 ; moved from .bss
+v2470 dd 2470 ; moved from .bss
+v2471 dd 2471 ; moved from .bss
+v2472 dd 2472 ; moved from .bss
+v2473 dd 2473 ; moved from .bss
+v2474 dd 2474 ; moved from .bss
+v2475 dd 2475 ; moved from .bss
+v2476 dd 2476 ; moved from .bss
+v2477 dd 2477 ; moved from .bss
+v2478 dd 2478 ; moved from .bss
+v2479 dd 2479 ; moved from .bss
+v2480 dd 2480 ; moved from .bss
+v2481 dd 2481 ; moved from .bss
+v2482 dd 2482 ; moved from .bss
+v2483 dd 2483 ; moved from .bss
+v2484 dd 2484 ; moved from .bss
+v2485 dd 2485 ; moved from .bss
+v2486 dd 2486 ; moved from .bss
+v2487 dd 2487 ; moved from .bss
+v2488 dd 2488 ; moved from .bss
+v2489 dd 2489 ; moved from .bss
+v2490 dd 2490 ; moved from .bss
+v2491 dd 2491 ; moved from .bss
+v2492 dd 2492 ; moved from .bss
+v2493 dd 2493 ; moved from .bss
+v2494 dd 2494 ; moved from .bss
+v2495 dd 2495 ; moved from .bss
+v2496 dd 2496 ; moved from .bss
+v2497 dd 2497 ; moved from .bss
+v2498 dd 2498 ; moved from .bss
+v2499 dd 2499 ; moved from .bss
+v2500 dd 2500 ; moved from .bss
+v2501 dd 2501 ; moved from .bss
+v2502 dd 2502 ; moved from .bss
+v2503 dd 2503 ; moved from .bss
+v2504 dd 2504 ; moved from .bss
+v2505 dd 2505 ; moved from .bss
+v2506 dd 2506 ; moved from .bss
+v2507 dd 2507 ; moved from .bss
+v2508 dd 2508 ; moved from .bss
+v2509 dd 2509 ; moved from .bss
+v2510 dd 2510 ; moved from .bss
+v2511 dd 2511 ; moved from .bss
+v2512 dd 2512 ; moved from .bss
+v2513 dd 2513 ; moved from .bss
+v2514 dd 2514 ; moved from .bss
+v2515 dd 2515 ; moved from .bss
+v2516 dd 2516 ; moved from .bss
+v2517 dd 2517 ; moved from .bss
+v2518 dd 2518 ; moved from .bss
+v2519 dd 2519 ; moved from .bss
+v2520 dd 2520 ; moved from .bss
+v2521 dd 2521 ; moved from .bss
+v2522 dd 2522 ; moved from .bss
+v2523 dd 2523 ; moved from .bss
+v2524 dd 2524 ; moved from .bss
+v2525 dd 2525 ; moved from .bss
+v2526 dd 2526 ; moved from .bss
+v2527 dd 2527 ; moved from .bss
+v2528 dd 2528 ; moved from .bss
+v2529 dd 2529 ; moved from .bss
+v2530 dd 2530 ; moved from .bss
+v2531 dd 2531 ; moved from .bss
+v2532 dd 2532 ; moved from .bss
+v2533 dd 2533 ; moved from .bss
+v2534 dd 2534 ; moved from .bss
+v2535 dd 2535 ; moved from .bss
+v2536 dd 2536 ; moved from .bss
+v2537 dd 2537 ; moved from .bss
+v2538 dd 2538 ; moved from .bss
+v2539 dd 2539 ; moved from .bss
+v2540 dd 2540 ; moved from .bss
+v2541 dd 2541 ; moved from .bss
+v2542 dd 2542 ; moved from .bss
+v2543 dd 2543 ; moved from .bss
+v2544 dd 2544 ; moved from .bss
+v2545 dd 2545 ; moved from .bss
+v2546 dd 2546 ; moved from .bss
+v2547 dd 2547 ; moved from .bss
+v2548 dd 2548 ; moved from .bss
+v2549 dd 2549 ; moved from .bss
+v2550 dd 2550 ; moved from .bss
+v2551 dd 2551 ; moved from .bss
+v2552 dd 2552 ; moved from .bss
+v2553 dd 2553 ; moved from .bss
+v2554 dd 2554 ; moved from .bss
+v2555 dd 2555 ; moved from .bss
+v2556 dd 2556 ; moved from .bss
+v2557 dd 2557 ; moved from .bss
+v2558 dd 2558 ; moved from .bss
+v2559 dd 2559 ; moved from .bss
+v2560 dd 2560 ; moved from .bss
+v2561 dd 2561 ; moved from .bss
+v2562 dd 2562 ; moved from .bss
+v2563 dd 2563 ; moved from .bss
+v2564 dd 2564 ; moved from .bss
+v2565 dd 2565 ; moved from .bss
+v2566 dd 2566 ; moved from .bss
+v2567 dd 2567 ; moved from .bss
+v2568 dd 2568 ; moved from .bss
+v2569 dd 2569 ; moved from .bss
+v2570 dd 2570 ; moved from .bss
+v2571 dd 2571 ; moved from .bss
+v2572 dd 2572 ; moved from .bss
+v2573 dd 2573 ; moved from .bss
+v2574 dd 2574 ; moved from .bss
+v2575 dd 2575 ; moved from .bss
+v2576 dd 2576 ; moved from .bss
+v2577 dd 2577 ; moved from .bss
+v2578 dd 2578 ; moved from .bss
+v2579 dd 2579 ; moved from .bss
+v2580 dd 2580 ; moved from .bss
+v2581 dd 2581 ; moved from .bss
+v2582 dd 2582 ; moved from .bss
+v2583 dd 2583 ; moved from .bss
+v2584 dd 2584 ; moved from .bss
+v2585 dd 2585 ; moved from .bss
+v2586 dd 2586 ; moved from .bss
+v2587 dd 2587 ; moved from .bss
+v2588 dd 2588 ; moved from .bss
+v2589 dd 2589 ; moved from .bss
+v2590 dd 2590 ; moved from .bss
+v2591 dd 2591 ; moved from .bss
+v2592 dd 2592 ; moved from .bss
+v2593 dd 2593 ; moved from .bss
+v2594 dd 2594 ; moved from .bss
+v2595 dd 2595 ; moved from .bss
+v2596 dd 2596 ; moved from .bss
+v2597 dd 2597 ; moved from .bss
+v2598 dd 2598 ; moved from .bss
+v2599 dd 2599 ; moved from .bss
+v2600 dd 2600 ; moved from .bss
+v2601 dd 2601 ; moved from .bss
+v2602 dd 2602 ; moved from .bss
+v2603 dd 2603 ; moved from .bss
+v2604 dd 2604 ; moved from .bss
+v2605 dd 2605 ; moved from .bss
+v2606 dd 2606 ; moved from .bss
+v2607 dd 2607 ; moved from .bss
+v2608 dd 2608 ; moved from .bss
+v2609 dd 2609 ; moved from .bss
+v2610 dd 2610 ; moved from .bss
+v2611 dd 2611 ; moved from .bss
+v2612 dd 2612 ; moved from .bss
+v2613 dd 2613 ; moved from .bss
+v2614 dd 2614 ; moved from .bss
+v2615 dd 2615 ; moved from .bss
+v2616 dd 2616 ; moved from .bss
+v2617 dd 2617 ; moved from .bss
+v2618 dd 2618 ; moved from .bss
+v2619 dd 2619 ; moved from .bss
+v2620 dd 2620 ; moved from .bss
+v2621 dd 2621 ; moved from .bss
+v2622 dd 2622 ; moved from .bss
+v2623 dd 2623 ; moved from .bss
+v2624 dd 2624 ; moved from .bss
+v2625 dd 2625 ; moved from .bss
+v2626 dd 2626 ; moved from .bss
+v2627 dd 2627 ; moved from .bss
+v2628 dd 2628 ; moved from .bss
+v2629 dd 2629 ; moved from .bss
+v2630 dd 2630 ; moved from .bss
+v2631 dd 2631 ; moved from .bss
+v2632 dd 2632 ; moved from .bss
+v2633 dd 2633 ; moved from .bss
+v2634 dd 2634 ; moved from .bss
+v2635 dd 2635 ; moved from .bss
+v2636 dd 2636 ; moved from .bss
+v2637 dd 2637 ; moved from .bss
+v2638 dd 2638 ; moved from .bss
+v2639 dd 2639 ; moved from .bss
+v2640 dd 2640 ; moved from .bss
+v2641 dd 2641 ; moved from .bss
+v2642 dd 2642 ; moved from .bss
+v2643 dd 2643 ; moved from .bss
+v2644 dd 2644 ; moved from .bss
+v2645 dd 2645 ; moved from .bss
+v2646 dd 2646 ; moved from .bss
+v2647 dd 2647 ; moved from .bss
+v2648 dd 2648 ; moved from .bss
+v2649 dd 2649 ; moved from .bss
+v2650 dd 2650 ; moved from .bss
+v2651 dd 2651 ; moved from .bss
+v2652 dd 2652 ; moved from .bss
+v2653 dd 2653 ; moved from .bss
+v2654 dd 2654 ; moved from .bss
+v2655 dd 2655 ; moved from .bss
+v2656 dd 2656 ; moved from .bss
+v2657 dd 2657 ; moved from .bss
+v2658 dd 2658 ; moved from .bss
+v2659 dd 2659 ; moved from .bss
+v2660 dd 2660 ; moved from .bss
+v2661 dd 2661 ; moved from .bss
+v2662 dd 2662 ; moved from .bss
+v2663 dd 2663 ; moved from .bss
+v2664 dd 2664 ; moved from .bss
+v2665 dd 2665 ; moved from .bss
+v2666 dd 2666 ; moved from .bss
+v2667 dd 2667 ; moved from .bss
+v2668 dd 2668 ; moved from .bss
+v2669 dd 2669 ; moved from .bss
+v2670 dd 2670 ; moved from .bss
+v2671 dd 2671 ; moved from .bss
+v2672 dd 2672 ; moved from .bss
+v2673 dd 2673 ; moved from .bss
+v2674 dd 2674 ; moved from .bss
+v2675 dd 2675 ; moved from .bss
+v2676 dd 2676 ; moved from .bss
+v2677 dd 2677 ; moved from .bss
+v2678 dd 2678 ; moved from .bss
+v2679 dd 2679 ; moved from .bss
+v2680 dd 2680 ; moved from .bss
+v2681 dd 2681 ; moved from .bss
+v2682 dd 2682 ; moved from .bss
+v2683 dd 2683 ; moved from .bss
+v2684 dd 2684 ; moved from .bss
+v2685 dd 2685 ; moved from .bss
+v2686 dd 2686 ; moved from .bss
+v2687 dd 2687 ; moved from .bss
+v2688 dd 2688 ; moved from .bss
+v2689 dd 2689 ; moved from .bss
+v2690 dd 2690 ; moved from .bss
+v2691 dd 2691 ; moved from .bss
+v2692 dd 2692 ; moved from .bss
+v2693 dd 2693 ; moved from .bss
+v2694 dd 2694 ; moved from .bss
+v2695 dd 2695 ; moved from .bss
+v2696 dd 2696 ; moved from .bss
+v2697 dd 2697 ; moved from .bss
+v2698 dd 2698 ; moved from .bss
+v2699 dd 2699 ; moved from .bss
+v2700 dd 2700 ; moved from .bss
+v2701 dd 2701 ; moved from .bss
+v2702 dd 2702 ; moved from .bss
+v2703 dd 2703 ; moved from .bss
+v2704 dd 2704 ; moved from .bss
+v2705 dd 2705 ; moved from .bss
+v2706 dd 2706 ; moved from .bss
+v2707 dd 2707 ; moved from .bss
+v2708 dd 2708 ; moved from .bss
+v2709 dd 2709 ; moved from .bss
+v2710 dd 2710 ; moved from .bss
+v2711 dd 2711 ; moved from .bss
+v2712 dd 2712 ; moved from .bss
+v2713 dd 2713 ; moved from .bss
+v2714 dd 2714 ; moved from .bss
+v2715 dd 2715 ; moved from .bss
+v2716 dd 2716 ; moved from .bss
+v2717 dd 2717 ; moved from .bss
+v2718 dd 2718 ; moved from .bss
+v2719 dd 2719 ; moved from .bss
+v2720 dd 2720 ; moved from .bss
+v2721 dd 2721 ; moved from .bss
+v2722 dd 2722 ; moved from .bss
+v2723 dd 2723 ; moved from .bss
+v2724 dd 2724 ; moved from .bss
+v2725 dd 2725 ; moved from .bss
+v2726 dd 2726 ; moved from .bss
+v2727 dd 2727 ; moved from .bss
+v2728 dd 2728 ; moved from .bss
+v2729 dd 2729 ; moved from .bss
+v2730 dd 2730 ; moved from .bss
+v2731 dd 2731 ; moved from .bss
+v2732 dd 2732 ; moved from .bss
+v2733 dd 2733 ; moved from .bss
+v2734 dd 2734 ; moved from .bss
+v2735 dd 2735 ; moved from .bss
+v2736 dd 2736 ; moved from .bss
+v2737 dd 2737 ; moved from .bss
+v2738 dd 2738 ; moved from .bss
+v2739 dd 2739 ; moved from .bss
+v2740 dd 2740 ; moved from .bss
+v2741 dd 2741 ; moved from .bss
+v2742 dd 2742 ; moved from .bss
+v2743 dd 2743 ; moved from .bss
+v2744 dd 2744 ; moved from .bss
+v2745 dd 2745 ; moved from .bss
+v2746 dd 2746 ; moved from .bss
+v2747 dd 2747 ; moved from .bss
+v2748 dd 2748 ; moved from .bss
+v2749 dd 2749 ; moved from .bss
+v2750 dd 2750 ; moved from .bss
+v2751 dd 2751 ; moved from .bss
+v2752 dd 2752 ; moved from .bss
+v2753 dd 2753 ; moved from .bss
+v2754 dd 2754 ; moved from .bss
+v2755 dd 2755 ; moved from .bss
+v2756 dd 2756 ; moved from .bss
+v2757 dd 2757 ; moved from .bss
+v2758 dd 2758 ; moved from .bss
+v2759 dd 2759 ; moved from .bss
+v2760 dd 2760 ; moved from .bss
+v2761 dd 2761 ; moved from .bss
+v2762 dd 2762 ; moved from .bss
+v2763 dd 2763 ; moved from .bss
+v2764 dd 2764 ; moved from .bss
+v2765 dd 2765 ; moved from .bss
+v2766 dd 2766 ; moved from .bss
+v2767 dd 2767 ; moved from .bss
+v2768 dd 2768 ; moved from .bss
+v2769 dd 2769 ; moved from .bss
+v2770 dd 2770 ; moved from .bss
+v2771 dd 2771 ; moved from .bss
+v2772 dd 2772 ; moved from .bss
+v2773 dd 2773 ; moved from .bss
+v2774 dd 2774 ; moved from .bss
+v2775 dd 2775 ; moved from .bss
+v2776 dd 2776 ; moved from .bss
+v2777 dd 2777 ; moved from .bss
+v2778 dd 2778 ; moved from .bss
+v2779 dd 2779 ; moved from .bss
+v2780 dd 2780 ; moved from .bss
+v2781 dd 2781 ; moved from .bss
+v2782 dd 2782 ; moved from .bss
+v2783 dd 2783 ; moved from .bss
+v2784 dd 2784 ; moved from .bss
+v2785 dd 2785 ; moved from .bss
+v2786 dd 2786 ; moved from .bss
+v2787 dd 2787 ; moved from .bss
+v2788 dd 2788 ; moved from .bss
+v2789 dd 2789 ; moved from .bss
+v2790 dd 2790 ; moved from .bss
+v2791 dd 2791 ; moved from .bss
+v2792 dd 2792 ; moved from .bss
+v2793 dd 2793 ; moved from .bss
+v2794 dd 2794 ; moved from .bss
+v2795 dd 2795 ; moved from .bss
+v2796 dd 2796 ; moved from .bss
+v2797 dd 2797 ; moved from .bss
+v2798 dd 2798 ; moved from .bss
+v2799 dd 2799 ; moved from .bss
+v2800 dd 2800 ; moved from .bss
+v2801 dd 2801 ; moved from .bss
+v2802 dd 2802 ; moved from .bss
+v2803 dd 2803 ; moved from .bss
+v2804 dd 2804 ; moved from .bss
+v2805 dd 2805 ; moved from .bss
+v2806 dd 2806 ; moved from .bss
+v2807 dd 2807 ; moved from .bss
+v2808 dd 2808 ; moved from .bss
+v2809 dd 2809 ; moved from .bss
+v2810 dd 2810 ; moved from .bss
+v2811 dd 2811 ; moved from .bss
+v2812 dd 2812 ; moved from .bss
+v2813 dd 2813 ; moved from .bss
+v2814 dd 2814 ; moved from .bss
+v2815 dd 2815 ; moved from .bss
+v2816 dd 2816 ; moved from .bss
+v2817 dd 2817 ; moved from .bss
+v2818 dd 2818 ; moved from .bss
+v2819 dd 2819 ; moved from .bss
+v2820 dd 2820 ; moved from .bss
+v2821 dd 2821 ; moved from .bss
+v2822 dd 2822 ; moved from .bss
+v2823 dd 2823 ; moved from .bss
+v2824 dd 2824 ; moved from .bss
+v2825 dd 2825 ; moved from .bss
+v2826 dd 2826 ; moved from .bss
+v2827 dd 2827 ; moved from .bss
+v2828 dd 2828 ; moved from .bss
+v2829 dd 2829 ; moved from .bss
+v2830 dd 2830 ; moved from .bss
+v2831 dd 2831 ; moved from .bss
+v2832 dd 2832 ; moved from .bss
+v2833 dd 2833 ; moved from .bss
+v2834 dd 2834 ; moved from .bss
+v2835 dd 2835 ; moved from .bss
+v2836 dd 2836 ; moved from .bss
+v2837 dd 2837 ; moved from .bss
+v2838 dd 2838 ; moved from .bss
+v2839 dd 2839 ; moved from .bss
+v2840 dd 2840 ; moved from .bss
+v2841 dd 2841 ; moved from .bss
+v2842 dd 2842 ; moved from .bss
+v2843 dd 2843 ; moved from .bss
+v2844 dd 2844 ; moved from .bss
+v2845 dd 2845 ; moved from .bss
+v2846 dd 2846 ; moved from .bss
+v2847 dd 2847 ; moved from .bss
+v2848 dd 2848 ; moved from .bss
+v2849 dd 2849 ; moved from .bss
+v2850 dd 2850 ; moved from .bss
+v2851 dd 2851 ; moved from .bss
+v2852 dd 2852 ; moved from .bss
+v2853 dd 2853 ; moved from .bss
+v2854 dd 2854 ; moved from .bss
+v2855 dd 2855 ; moved from .bss
+v2856 dd 2856 ; moved from .bss
+v2857 dd 2857 ; moved from .bss
+v2858 dd 2858 ; moved from .bss
+v2859 dd 2859 ; moved from .bss
+v2860 dd 2860 ; moved from .bss
+v2861 dd 2861 ; moved from .bss
+v2862 dd 2862 ; moved from .bss
+v2863 dd 2863 ; moved from .bss
+v2864 dd 2864 ; moved from .bss
+v2865 dd 2865 ; moved from .bss
+v2866 dd 2866 ; moved from .bss
+v2867 dd 2867 ; moved from .bss
+v2868 dd 2868 ; moved from .bss
+v2869 dd 2869 ; moved from .bss
+v2870 dd 2870 ; moved from .bss
+v2871 dd 2871 ; moved from .bss
+v2872 dd 2872 ; moved from .bss
+v2873 dd 2873 ; moved from .bss
+v2874 dd 2874 ; moved from .bss
+v2875 dd 2875 ; moved from .bss
+v2876 dd 2876 ; moved from .bss
+v2877 dd 2877 ; moved from .bss
+v2878 dd 2878 ; moved from .bss
+v2879 dd 2879 ; moved from .bss
+v2880 dd 2880 ; moved from .bss
+v2881 dd 2881 ; moved from .bss
+v2882 dd 2882 ; moved from .bss
+v2883 dd 2883 ; moved from .bss
+v2884 dd 2884 ; moved from .bss
+v2885 dd 2885 ; moved from .bss
+v2886 dd 2886 ; moved from .bss
+v2887 dd 2887 ; moved from .bss
+v2888 dd 2888 ; moved from .bss
+v2889 dd 2889 ; moved from .bss
+v2890 dd 2890 ; moved from .bss
+v2891 dd 2891 ; moved from .bss
+v2892 dd 2892 ; moved from .bss
+v2893 dd 2893 ; moved from .bss
+v2894 dd 2894 ; moved from .bss
+v2895 dd 2895 ; moved from .bss
+v2896 dd 2896 ; moved from .bss
+v2897 dd 2897 ; moved from .bss
+v2898 dd 2898 ; moved from .bss
+v2899 dd 2899 ; moved from .bss
+v2900 dd 2900 ; moved from .bss
+v2901 dd 2901 ; moved from .bss
+v2902 dd 2902 ; moved from .bss
+v2903 dd 2903 ; moved from .bss
+v2904 dd 2904 ; moved from .bss
+v2905 dd 2905 ; moved from .bss
+v2906 dd 2906 ; moved from .bss
+v2907 dd 2907 ; moved from .bss
+v2908 dd 2908 ; moved from .bss
+v2909 dd 2909 ; moved from .bss
+v2910 dd 2910 ; moved from .bss
+v2911 dd 2911 ; moved from .bss
+v2912 dd 2912 ; moved from .bss
+v2913 dd 2913 ; moved from .bss
+v2914 dd 2914 ; moved from .bss
+v2915 dd 2915 ; moved from .bss
+v2916 dd 2916 ; moved from .bss
+v2917 dd 2917 ; moved from .bss
+v2918 dd 2918 ; moved from .bss
+v2919 dd 2919 ; moved from .bss
+v2920 dd 2920 ; moved from .bss
+v2921 dd 2921 ; moved from .bss
+v2922 dd 2922 ; moved from .bss
+v2923 dd 2923 ; moved from .bss
+v2924 dd 2924 ; moved from .bss
+v2925 dd 2925 ; moved from .bss
+v2926 dd 2926 ; moved from .bss
+v2927 dd 2927 ; moved from .bss
+v2928 dd 2928 ; moved from .bss
+v2929 dd 2929 ; moved from .bss
+v2930 dd 2930 ; moved from .bss
+v2931 dd 2931 ; moved from .bss
+v2932 dd 2932 ; moved from .bss
+v2933 dd 2933 ; moved from .bss
+v2934 dd 2934 ; moved from .bss
+v2935 dd 2935 ; moved from .bss
+v2936 dd 2936 ; moved from .bss
+v2937 dd 2937 ; moved from .bss
+v2938 dd 2938 ; moved from .bss
+v2939 dd 2939 ; moved from .bss
+v2940 dd 2940 ; moved from .bss
+v2941 dd 2941 ; moved from .bss
+v2942 dd 2942 ; moved from .bss
+v2943 dd 2943 ; moved from .bss
+v2944 dd 2944 ; moved from .bss
+v2945 dd 2945 ; moved from .bss
+v2946 dd 2946 ; moved from .bss
+v2947 dd 2947 ; moved from .bss
+v2948 dd 2948 ; moved from .bss
+v2949 dd 2949 ; moved from .bss
+v2950 dd 2950 ; moved from .bss
+v2951 dd 2951 ; moved from .bss
+v2952 dd 2952 ; moved from .bss
+v2953 dd 2953 ; moved from .bss
+v2954 dd 2954 ; moved from .bss
+v2955 dd 2955 ; moved from .bss
+v2956 dd 2956 ; moved from .bss
+v2957 dd 2957 ; moved from .bss
+v2958 dd 2958 ; moved from .bss
+v2959 dd 2959 ; moved from .bss
+v2960 dd 2960 ; moved from .bss
+v2961 dd 2961 ; moved from .bss
+v2962 dd 2962 ; moved from .bss
+v2963 dd 2963 ; moved from .bss
+v2964 dd 2964 ; moved from .bss
+v2965 dd 2965 ; moved from .bss
+v2966 dd 2966 ; moved from .bss
+v2967 dd 2967 ; moved from .bss
+v2968 dd 2968 ; moved from .bss
+v2969 dd 2969 ; moved from .bss
+v2970 dd 2970 ; moved from .bss
+v2971 dd 2971 ; moved from .bss
+v2972 dd 2972 ; moved from .bss
+v2973 dd 2973 ; moved from .bss
+v2974 dd 2974 ; moved from .bss
+v2975 dd 2975 ; moved from .bss
+v2976 dd 2976 ; moved from .bss
+v2977 dd 2977 ; moved from .bss
+v2978 dd 2978 ; moved from .bss
+v2979 dd 2979 ; moved from .bss
+v2980 dd 2980 ; moved from .bss
+v2981 dd 2981 ; moved from .bss
+v2982 dd 2982 ; moved from .bss
+v2983 dd 2983 ; moved from .bss
+v2984 dd 2984 ; moved from .bss
+v2985 dd 2985 ; moved from .bss
+v2986 dd 2986 ; moved from .bss
+v2987 dd 2987 ; moved from .bss
+v2988 dd 2988 ; moved from .bss
+v2989 dd 2989 ; moved from .bss
+v2990 dd 2990 ; moved from .bss
+v2991 dd 2991 ; moved from .bss
+v2992 dd 2992 ; moved from .bss
+v2993 dd 2993 ; moved from .bss
+v2994 dd 2994 ; moved from .bss
+v2995 dd 2995 ; moved from .bss
+v2996 dd 2996 ; moved from .bss
+v2997 dd 2997 ; moved from .bss
+v2998 dd 2998 ; moved from .bss
+s2999 db ".text", 0 ; not .text
+v3000 dd 3000 ; moved from .bss
+v3001 dd 3001 ; moved from .bss
+v3002 dd 3002 ; moved from .bss
+v3003 dd 3003 ; moved from .bss
+v3004 dd 3004 ; moved from .bss
+v3005 dd 3005 ; moved from .bss
+v3006 dd 3006 ; moved from .bss
+v3007 dd 3007 ; moved from .bss
+v3008 dd 3008 ; moved from .bss
+v3009 dd 3009 ; moved from .bss
+v3010 dd 3010 ; moved from .bss
+v3011 dd 3011 ; moved from .bss
+v3012 dd 3012 ; moved from .bss
+v3013 dd 3013 ; moved from .bss
+v3014 dd 3014 ; moved from .bss
+v3015 dd 3015 ; moved from .bss
+v3016 dd 3016 ; moved from .bss
+v3017 dd 3017 ; moved from .bss
+v3018 dd 3018 ; moved from .bss
+v3019 dd 3019 ; moved from .bss
+v3020 dd 3020 ; moved from .bss
+v3021 dd 3021 ; moved from .bss
+v3022 dd 3022 ; moved from .bss
+v3023 dd 3023 ; moved from .bss
+v3024 dd 3024 ; moved from .bss
+v3025 dd 3025 ; moved from .bss
+v3026 dd 3026 ; moved from .bss
+v3027 dd 3027 ; moved from .bss
+v3028 dd 3028 ; moved from .bss
+v3029 dd 3029 ; moved from .bss
+v3030 dd 3030 ; moved from .bss
+v3031 dd 3031 ; moved from .bss
+v3032 dd 3032 ; moved from .bss
+v3033 dd 3033 ; moved from .bss
+v3034 dd 3034 ; moved from .bss
+v3035 dd 3035 ; moved from .bss
+v3036 dd 3036 ; moved from .bss
+v3037 dd 3037 ; moved from .bss
+v3038 dd 3038 ; moved from .bss
+v3039 dd 3039 ; moved from .bss
+v3040 dd 3040 ; moved from .bss
+v3041 dd 3041 ; moved from .bss
+v3042 dd 3042 ; moved from .bss
+v3043 dd 3043 ; moved from .bss
+v3044 dd 3044 ; moved from .bss
+v3045 dd 3045 ; moved from .bss
+v3046 dd 3046 ; moved from .bss
+v3047 dd 3047 ; moved from .bss
+v3048 dd 3048 ; moved from .bss
+v3049 dd 3049 ; moved from .bss
+v3050 dd 3050 ; moved from .bss
+v3051 dd 3051 ; moved from .bss
+v3052 dd 3052 ; moved from .bss
+v3053 dd 3053 ; moved from .bss
+v3054 dd 3054 ; moved from .bss
+v3055 dd 3055 ; moved from .bss
+v3056 dd 3056 ; moved from .bss
+v3057 dd 3057 ; moved from .bss
+v3058 dd 3058 ; moved from .bss
+v3059 dd 3059 ; moved from .bss
+v3060 dd 3060 ; moved from .bss
+v3061 dd 3061 ; moved from .bss
+v3062 dd 3062 ; moved from .bss
+v3063 dd 3063 ; moved from .bss
+v3064 dd 3064 ; moved from .bss
+v3065 dd 3065 ; moved from .bss
+v3066 dd 3066 ; moved from .bss
+v3067 dd 3067 ; moved from .bss
+v3068 dd 3068 ; moved from .bss
+v3069 dd 3069 ; moved from .bss
+v3070 dd 3070 ; moved from .bss
+v3071 dd 3071 ; moved from .bss
+v3072 dd 3072 ; moved from .bss
+v3073 dd 3073 ; moved from .bss
+v3074 dd 3074 ; moved from .bss
+v3075 dd 3075 ; moved from .bss
+v3076 dd 3076 ; moved from .bss
+v3077 dd 3077 ; moved from .bss
+v3078 dd 3078 ; moved from .bss
+v3079 dd 3079 ; moved from .bss
+v3080 dd 3080 ; moved from .bss
+v3081 dd 3081 ; moved from .bss
+v3082 dd 3082 ; moved from .bss
+v3083 dd 3083 ; moved from .bss
+v3084 dd 3084 ; moved from .bss
+v3085 dd 3085 ; moved from .bss
+v3086 dd 3086 ; moved from .bss
+v3087 dd 3087 ; moved from .bss
+v3088 dd 3088 ; moved from .bss
+v3089 dd 3089 ; moved from .bss
+v3090 dd 3090 ; moved from .bss
+v3091 dd 3091 ; moved from .bss
+v3092 dd 3092 ; moved from .bss
+v3093 dd 3093 ; moved from .bss
+v3094 dd 3094 ; moved from .bss
+v3095 dd 3095 ; moved from .bss
+v3096 dd 3096 ; moved from .bss
+v3097 dd 3097 ; moved from .bss
+v3098 dd 3098 ; moved from .bss
+v3099 dd 3099 ; moved from .bss
+v3100 dd 3100 ; moved from .bss
+v3101 dd 3101 ; moved from .bss
+v3102 dd 3102 ; moved from .bss
+v3103 dd 3103 ; moved from .bss
+v3104 dd 3104 ; moved from .bss
+v3105 dd 3105 ; moved from .bss
+v3106 dd 3106 ; moved from .bss
+v3107 dd 3107 ; moved from .bss
+v3108 dd 3108 ; moved from .bss
+v3109 dd 3109 ; moved from .bss
+v3110 dd 3110 ; moved from .bss
+v3111 dd 3111 ; moved from .bss
+v3112 dd 3112 ; moved from .bss
+v3113 dd 3113 ; moved from .bss
+v3114 dd 3114 ; moved from .bss
+v3115 dd 3115 ; moved from .bss
+v3116 dd 3116 ; moved from .bss
+v3117 dd 3117 ; moved from .bss
+v3118 dd 3118 ; moved from .bss
+v3119 dd 3119 ; moved from .bss
+v3120 dd 3120 ; moved from .bss
+v3121 dd 3121 ; moved from .bss
+v3122 dd 3122 ; moved from .bss
+v3123 dd 3123 ; moved from .bss
+v3124 dd 3124 ; moved from .bss
+v3125 dd 3125 ; moved from .bss
+v3126 dd 3126 ; moved from .bss
+v3127 dd 3127 ; moved from .bss
+v3128 dd 3128 ; moved from .bss
+v3129 dd 3129 ; moved from .bss
+v3130 dd 3130 ; moved from .bss
+v3131 dd 3131 ; moved from .bss
+v3132 dd 3132 ; moved from .bss
+v3133 dd 3133 ; moved from .bss
+v3134 dd 3134 ; moved from .bss
+v3135 dd 3135 ; moved from .bss
+v3136 dd 3136 ; moved from .bss
+v3137 dd 3137 ; moved from .bss
+v3138 dd 3138 ; moved from .bss
+v3139 dd 3139 ; moved from .bss
+v3140 dd 3140 ; moved from .bss
+v3141 dd 3141 ; moved from .bss
+v3142 dd 3142 ; moved from .bss
+v3143 dd 3143 ; moved from .bss
+v3144 dd 3144 ; moved from .bss
+v3145 dd 3145 ; moved from .bss
+v3146 dd 3146 ; moved from .bss
+v3147 dd 3147 ; moved from .bss
+v3148 dd 3148 ; moved from .bss
+v3149 dd 3149 ; moved from .bss
+v3150 dd 3150 ; moved from .bss
+v3151 dd 3151 ; moved from .bss
+v3152 dd 3152 ; moved from .bss
+v3153 dd 3153 ; moved from .bss
+v3154 dd 3154 ; moved from .bss
+v3155 dd 3155 ; moved from .bss
+v3156 dd 3156 ; moved from .bss
+v3157 dd 3157 ; moved from .bss
+v3158 dd 3158 ; moved from .bss
+v3159 dd 3159 ; moved from .bss
+v3160 dd 3160 ; moved from .bss
+v3161 dd 3161 ; moved from .bss
+v3162 dd 3162 ; moved from .bss
+v3163 dd 3163 ; moved from .bss
+v3164 dd 3164 ; moved from .bss
+v3165 dd 3165 ; moved from .bss
+v3166 dd 3166 ; moved from .bss
+v3167 dd 3167 ; moved from .bss
+v3168 dd 3168 ; moved from .bss
+v3169 dd 3169 ; moved from .bss
+v3170 dd 3170 ; moved from .bss
+v3171 dd 3171 ; moved from .bss
+v3172 dd 3172 ; moved from .bss
+v3173 dd 3173 ; moved from .bss
+v3174 dd 3174 ; moved from .bss
+v3175 dd 3175 ; moved from .bss
+v3176 dd 3176 ; moved from .bss
+v3177 dd 3177 ; moved from .bss
+v3178 dd 3178 ; moved from .bss
+v3179 dd 3179 ; moved from .bss
+v3180 dd 3180 ; moved from .bss
+v3181 dd 3181 ; moved from .bss
+v3182 dd 3182 ; moved from .bss
+v3183 dd 3183 ; moved from .bss
+v3184 dd 3184 ; moved from .bss
+v3185 dd 3185 ; moved from .bss
+v3186 dd 3186 ; moved from .bss
+v3187 dd 3187 ; moved from .bss
+v3188 dd 3188 ; moved from .bss
+v3189 dd 3189 ; moved from .bss
+v3190 dd 3190 ; moved from .bss
+v3191 dd 3191 ; moved from .bss
+v3192 dd 3192 ; moved from .bss
+v3193 dd 3193 ; moved from .bss
+v3194 dd 3194 ; moved from .bss
+v3195 dd 3195 ; moved from .bss
+v3196 dd 3196 ; moved from .bss
+v3197 dd 3197 ; moved from .bss
+v3198 dd 3198 ; moved from .bss
+v3199 dd 3199 ; moved from .bss
+v3200 dd 3200 ; moved from .bss
+v3201 dd 3201 ; moved from .bss
+v3202 dd 3202 ; moved from .bss
+v3203 dd 3203 ; moved from .bss
+v3204 dd 3204 ; moved from .bss
+v3205 dd 3205 ; moved from .bss
+v3206 dd 3206 ; moved from .bss
+v3207 dd 3207 ; moved from .bss
+v3208 dd 3208 ; moved from .bss
+v3209 dd 3209 ; moved from .bss
+v3210 dd 3210 ; moved from .bss
+v3211 dd 3211 ; moved from .bss
+v3212 dd 3212 ; moved from .bss
+v3213 dd 3213 ; moved from .bss
+v3214 dd 3214 ; moved from .bss
+v3215 dd 3215 ; moved from .bss
+v3216 dd 3216 ; moved from .bss
+v3217 dd 3217 ; moved from .bss
+v3218 dd 3218 ; moved from .bss
+v3219 dd 3219 ; moved from .bss
+v3220 dd 3220 ; moved from .bss
+v3221 dd 3221 ; moved from .bss
+v3222 dd 3222 ; moved from .bss
+v3223 dd 3223 ; moved from .bss
+v3224 dd 3224 ; moved from .bss
+v3225 dd 3225 ; moved from .bss
+v3226 dd 3226 ; moved from .bss
+v3227 dd 3227 ; moved from .bss
+v3228 dd 3228 ; moved from .bss
+v3229 dd 3229 ; moved from .bss
+v3230 dd 3230 ; moved from .bss
+v3231 dd 3231 ; moved from .bss
+v3232 dd 3232 ; moved from .bss
+v3233 dd 3233 ; moved from .bss
+v3234 dd 3234 ; moved from .bss
+v3235 dd 3235 ; moved from .bss
+v3236 dd 3236 ; moved from .bss
+v3237 dd 3237 ; moved from .bss
+v3238 dd 3238 ; moved from .bss
+v3239 dd 3239 ; moved from .bss
+v3240 dd 3240 ; moved from .bss
+v3241 dd 3241 ; moved from .bss
+v3242 dd 3242 ; moved from .bss
+v3243 dd 3243 ; moved from .bss
+v3244 dd 3244 ; moved from .bss
+v3245 dd 3245 ; moved from .bss
+v3246 dd 3246 ; moved from .bss
+v3247 dd 3247 ; moved from .bss
+v3248 dd 3248 ; moved from .bss
+v3249 dd 3249 ; moved from .bss
+v3250 dd 3250 ; moved from .bss
+v3251 dd 3251 ; moved from .bss
+v3252 dd 3252 ; moved from .bss
+v3253 dd 3253 ; moved from .bss
+v3254 dd 3254 ; moved from .bss
+v3255 dd 3255 ; moved from .bss
+v3256 dd 3256 ; moved from .bss
+v3257 dd 3257 ; moved from .bss
+v3258 dd 3258 ; moved from .bss
+v3259 dd 3259 ; moved from .bss
+v3260 dd 3260 ; moved from .bss
+v3261 dd 3261 ; moved from .bss
+v3262 dd 3262 ; moved from .bss
+v3263 dd 3263 ; moved from .bss
+v3264 dd 3264 ; moved from .bss
+v3265 dd 3265 ; moved from .bss
+v3266 dd 3266 ; moved from .bss
+v3267 dd 3267 ; moved from .bss
+v3268 dd 3268 ; moved from .bss
+v3269 dd 3269 ; moved from .bss
+v3270 dd 3270 ; moved from .bss
+v3271 dd 3271 ; moved from .bss
+v3272 dd 3272 ; moved from .bss
+v3273 dd 3273 ; moved from .bss
+v3274 dd 3274 ; moved from .bss
+v3275 dd 3275 ; moved from .bss
+v3276 dd 3276 ; moved from .bss
+v3277 dd 3277 ; moved from .bss
+v3278 dd 3278 ; moved from .bss
+v3279 dd 3279 ; moved from .bss
+v3280 dd 3280 ; moved from .bss
+v3281 dd 3281 ; moved from .bss
+v3282 dd 3282 ; moved from .bss
+v3283 dd 3283 ; moved from .bss
+v3284 dd 3284 ; moved from .bss
+v3285 dd 3285 ; moved from .bss
+v3286 dd 3286 ; moved from .bss
+v3287 dd 3287 ; moved from .bss
+v3288 dd 3288 ; moved from .bss
+v3289 dd 3289 ; moved from .bss
+v3290 dd 3290 ; moved from .bss
+v3291 dd 3291 ; moved from .bss
+v3292 dd 3292 ; moved from .bss
+v3293 dd 3293 ; moved from .bss
+v3294 dd 3294 ; moved from .bss
+v3295 dd 3295 ; moved from .bss
+v3296 dd 3296 ; moved from .bss
+v3297 dd 3297 ; moved from .bss
+v3298 dd 3298 ; moved from .bss
+v3299 dd 3299 ; moved from .bss
+v3300 dd 3300 ; moved from .bss
+v3301 dd 3301 ; moved from .bss
+v3302 dd 3302 ; moved from .bss
+v3303 dd 3303 ; moved from .bss
+v3304 dd 3304 ; moved from .bss
+v3305 dd 3305 ; moved from .bss
+v3306 dd 3306 ; moved from .bss
+v3307 dd 3307 ; moved from .bss
+v3308 dd 3308 ; moved from .bss
+v3309 dd 3309 ; moved from .bss
+v3310 dd 3310 ; moved from .bss
+v3311 dd 3311 ; moved from .bss
+v3312 dd 3312 ; moved from .bss
+v3313 dd 3313 ; moved from .bss
+v3314 dd 3314 ; moved from .bss
+v3315 dd 3315 ; moved from .bss
+v3316 dd 3316 ; moved from .bss
+v3317 dd 3317 ; moved from .bss
+v3318 dd 3318 ; moved from .bss
+v3319 dd 3319 ; moved from .bss
+v3320 dd 3320 ; moved from .bss
+v3321 dd 3321 ; moved from .bss
+v3322 dd 3322 ; moved from .bss
+v3323 dd 3323 ; moved from .bss
+v3324 dd 3324 ; moved from .bss
+v3325 dd 3325 ; moved from .bss
+v3326 dd 3326 ; moved from .bss
+v3327 dd 3327 ; moved from .bss
+v3328 dd 3328 ; moved from .bss
+v3329 dd 3329 ; moved from .bss
+v3330 dd 3330 ; moved from .bss
+v3331 dd 3331 ; moved from .bss
+v3332 dd 3332 ; moved from .bss
+v3333 dd 3333 ; moved from .bss
+v3334 dd 3334 ; moved from .bss
+v3335 dd 3335 ; moved from .bss
+v3336 dd 3336 ; moved from .bss
+v3337 dd 3337 ; moved from .bss
+v3338 dd 3338 ; moved from .bss
+v3339 dd 3339 ; moved from .bss
+v3340 dd 3340 ; moved from .bss
+v3341 dd 3341 ; moved from .bss
+v3342 dd 3342 ; moved from .bss
+v3343 dd 3343 ; moved from .bss
+v3344 dd 3344 ; moved from .bss
+v3345 dd 3345 ; moved from .bss
+v3346 dd 3346 ; moved from .bss
+v3347 dd 3347 ; moved from .bss
+v3348 dd 3348 ; moved from .bss
+v3349 dd 3349 ; moved from .bss
+v3350 dd 3350 ; moved from .bss
+v3351 dd 3351 ; moved from .bss
+v3352 dd 3352 ; moved from .bss
+v3353 dd 3353 ; moved from .bss
+v3354 dd 3354 ; moved from .bss
+v3355 dd 3355 ; moved from .bss
+v3356 dd 3356 ; moved from .bss
+v3357 dd 3357 ; moved from .bss
+v3358 dd 3358 ; moved from .bss
+v3359 dd 3359 ; moved from .bss
+v3360 dd 3360 ; moved from .bss
+v3361 dd 3361 ; moved from .bss
+v3362 dd 3362 ; moved from .bss
+v3363 dd 3363 ; moved from .bss
+v3364 dd 3364 ; moved from .bss
+v3365 dd 3365 ; moved from .bss
+v3366 dd 3366 ; moved from .bss
+v3367 dd 3367 ; moved from .bss
+v3368 dd 3368 ; moved from .bss
+v3369 dd 3369 ; moved from .bss
+v3370 dd 3370 ; moved from .bss
+v3371 dd 3371 ; moved from .bss
+v3372 dd 3372 ; moved from .bss
+v3373 dd 3373 ; moved from .bss
+v3374 dd 3374 ; moved from .bss
+v3375 dd 3375 ; moved from .bss
+v3376 dd 3376 ; moved from .bss
+v3377 dd 3377 ; moved from .bss
+v3378 dd 3378 ; moved from .bss
+v3379 dd 3379 ; moved from .bss
+v3380 dd 3380 ; moved from .bss
+v3381 dd 3381 ; moved from .bss
+v3382 dd 3382 ; moved from .bss
+v3383 dd 3383 ; moved from .bss
+v3384 dd 3384 ; moved from .bss
+v3385 dd 3385 ; moved from .bss
+v3386 dd 3386 ; moved from .bss
+v3387 dd 3387 ; moved from .bss
+v3388 dd 3388 ; moved from .bss
+v3389 dd 3389 ; moved from .bss
+v3390 dd 3390 ; moved from .bss
+v3391 dd 3391 ; moved from .bss
+v3392 dd 3392 ; moved from .bss
+v3393 dd 3393 ; moved from .bss
+v3394 dd 3394 ; moved from .bss
+v3395 dd 3395 ; moved from .bss
+v3396 dd 3396 ; moved from .bss
+v3397 dd 3397 ; moved from .bss
+v3398 dd 3398 ; moved from .bss
+v3399 dd 3399 ; moved from .bss
+v3400 dd 3400 ; moved from .bss
+v3401 dd 3401 ; moved from .bss
+v3402 dd 3402 ; moved from .bss
+v3403 dd 3403 ; moved from .bss
+v3404 dd 3404 ; moved from .bss
+v3405 dd 3405 ; moved from .bss
+v3406 dd 3406 ; moved from .bss
+v3407 dd 3407 ; moved from .bss
+v3408 dd 3408 ; moved from .bss
+v3409 dd 3409 ; moved from .bss
+v3410 dd 3410 ; moved from .bss
+v3411 dd 3411 ; moved from .bss
+v3412 dd 3412 ; moved from .bss
+v3413 dd 3413 ; moved from .bss
+v3414 dd 3414 ; moved from .bss
+v3415 dd 3415 ; moved from .bss
+v3416 dd 3416 ; moved from .bss
+v3417 dd 3417 ; moved from .bss
+v3418 dd 3418 ; moved from .bss
+v3419 dd 3419 ; moved from .bss
+v3420 dd 3420 ; moved from .bss
+v3421 dd 3421 ; moved from .bss
+v3422 dd 3422 ; moved from .bss
+v3423 dd 3423 ; moved from .bss
+v3424 dd 3424 ; moved from .bss
+v3425 dd 3425 ; moved from .bss
+v3426 dd 3426 ; moved from .bss
+v3427 dd 3427 ; moved from .bss
+v3428 dd 3428 ; moved from .bss
+v3429 dd 3429 ; moved from .bss
+v3430 dd 3430 ; moved from .bss
+v3431 dd 3431 ; moved from .bss
+v3432 dd 3432 ; moved from .bss
+v3433 dd 3433 ; moved from .bss
+v3434 dd 3434 ; moved from .bss
+v3435 dd 3435 ; moved from .bss
+v3436 dd 3436 ; moved from .bss
+v3437 dd 3437 ; moved from .bss
+v3438 dd 3438 ; moved from .bss
+v3439 dd 3439 ; moved from .bss
+v3440 dd 3440 ; moved from .bss
+v3441 dd 3441 ; moved from .bss
+v3442 dd 3442 ; moved from .bss
+v3443 dd 3443 ; moved from .bss
+v3444 dd 3444 ; moved from .bss
+v3445 dd 3445 ; moved from .bss
+v3446 dd 3446 ; moved from .bss
+v3447 dd 3447 ; moved from .bss
+v3448 dd 3448 ; moved from .bss
+v3449 dd 3449 ; moved from .bss
+v3450 dd 3450 ; moved from .bss
+v3451 dd 3451 ; moved from .bss
+v3452 dd 3452 ; moved from .bss
+v3453 dd 3453 ; moved from .bss
+v3454 dd 3454 ; moved from .bss
+v3455 dd 3455 ; moved from .bss
+v3456 dd 3456 ; moved from .bss
+v3457 dd 3457 ; moved from .bss
+v3458 dd 3458 ; moved from .bss
+v3459 dd 3459 ; moved from .bss
+v3460 dd 3460 ; moved from .bss
+v3461 dd 3461 ; moved from .bss
+v3462 dd 3462 ; moved from .bss
+v3463 dd 3463 ; moved from .bss
+v3464 dd 3464 ; moved from .bss
+v3465 dd 3465 ; moved from .bss
+v3466 dd 3466 ; moved from .bss
+v3467 dd 3467 ; moved from .bss
+v3468 dd 3468 ; moved from .bss
+v3469 dd 3469 ; moved from .bss
+v3470 dd 3470 ; moved from .bss
+v3471 dd 3471 ; moved from .bss
+v3472 dd 3472 ; moved from .bss
+v3473 dd 3473 ; moved from .bss
+v3474 dd 3474 ; moved from .bss
+v3475 dd 3475 ; moved from .bss
+v3476 dd 3476 ; moved from .bss
+v3477 dd 3477 ; moved from .bss
+v3478 dd 3478 ; moved from .bss
+v3479 dd 3479 ; moved from .bss
+v3480 dd 3480 ; moved from .bss
+v3481 dd 3481 ; moved from .bss
+v3482 dd 3482 ; moved from .bss
+v3483 dd 3483 ; moved from .bss
+v3484 dd 3484 ; moved from .bss
+v3485 dd 3485 ; moved from .bss
+v3486 dd 3486 ; moved from .bss
+v3487 dd 3487 ; moved from .bss
+v3488 dd 3488 ; moved from .bss
+v3489 dd 3489 ; moved from .bss
+v3490 dd 3490 ; moved from .bss
+v3491 dd 3491 ; moved from .bss
+v3492 dd 3492 ; moved from .bss
+v3493 dd 3493 ; moved from .bss
+v3494 dd 3494 ; moved from .bss
+v3495 dd 3495 ; moved from .bss
+v3496 dd 3496 ; moved from .bss
+v3497 dd 3497 ; moved from .bss
+v3498 dd 3498 ; moved from .bss
+v3499 dd 3499 ; moved from .bss
+v3500 dd 3500 ; moved from .bss
+v3501 dd 3501 ; moved from .bss
+v3502 dd 3502 ; moved from .bss
+v3503 dd 3503 ; moved from .bss
+v3504 dd 3504 ; moved from .bss
+v3505 dd 3505 ; moved from .bss
+v3506 dd 3506 ; moved from .bss
+v3507 dd 3507 ; moved from .bss
+v3508 dd 3508 ; moved from .bss
+v3509 dd 3509 ; moved from .bss
+v3510 dd 3510 ; moved from .bss
+v3511 dd 3511 ; moved from .bss
+v3512 dd 3512 ; moved from .bss
+v3513 dd 3513 ; moved from .bss
+v3514 dd 3514 ; moved from .bss
+v3515 dd 3515 ; moved from .bss
+v3516 dd 3516 ; moved from .bss
+v3517 dd 3517 ; moved from .bss
+v3518 dd 3518 ; moved from .bss
+v3519 dd 3519 ; moved from .bss
+v3520 dd 3520 ; moved from .bss
+v3521 dd 3521 ; moved from .bss
+v3522 dd 3522 ; moved from .bss
+v3523 dd 3523 ; moved from .bss
+v3524 dd 3524 ; moved from .bss
+v3525 dd 3525 ; moved from .bss
+v3526 dd 3526 ; moved from .bss
+v3527 dd 3527 ; moved from .bss
+v3528 dd 3528 ; moved from .bss
+v3529 dd 3529 ; moved from .bss
+v3530 dd 3530 ; moved from .bss
+v3531 dd 3531 ; moved from .bss
+v3532 dd 3532 ; moved from .bss
+v3533 dd 3533 ; moved from .bss
+v3534 dd 3534 ; moved from .bss
+v3535 dd 3535 ; moved from .bss
+v3536 dd 3536 ; moved from .bss
+v3537 dd 3537 ; moved from .bss
+v3538 dd 3538 ; moved from .bss
+v3539 dd 3539 ; moved from .bss
+v3540 dd 3540 ; moved from .bss
+v3541 dd 3541 ; moved from .bss
+v3542 dd 3542 ; moved from .bss
+v3543 dd 3543 ; moved from .bss
+v3544 dd 3544 ; moved from .bss
+v3545 dd 3545 ; moved from .bss
+v3546 dd 3546 ; moved from .bss
+v3547 dd 3547 ; moved from .bss
+v3548 dd 3548 ; moved from .bss
+v3549 dd 3549 ; moved from .bss
+v3550 dd 3550 ; moved from .bss
+v3551 dd 3551 ; moved from .bss
+v3552 dd 3552 ; moved from .bss
+v3553 dd 3553 ; moved from .bss
+v3554 dd 3554 ; moved from .bss
+v3555 dd 3555 ; moved from .bss
+v3556 dd 3556 ; moved from .bss
+v3557 dd 3557 ; moved from .bss
+v3558 dd 3558 ; moved from .bss
+v3559 dd 3559 ; moved from .bss
+v3560 dd 3560 ; moved from .bss
+v3561 dd 3561 ; moved from .bss
+v3562 dd 3562 ; moved from .bss
+v3563 dd 3563 ; moved from .bss
+v3564 dd 3564 ; moved from .bss
+v3565 dd 3565 ; moved from .bss
+v3566 dd 3566 ; moved from .bss
+v3567 dd 3567 ; moved from .bss
+v3568 dd 3568 ; moved from .bss
+v3569 dd 3569 ; moved from .bss
+v3570 dd 3570 ; moved from .bss
+v3571 dd 3571 ; moved from .bss
+v3572 dd 3572 ; moved from .bss
+v3573 dd 3573 ; moved from .bss
+v3574 dd 3574 ; moved from .bss
+v3575 dd 3575 ; moved from .bss
+v3576 dd 3576 ; moved from .bss
+v3577 dd 3577 ; moved from .bss
+v3578 dd 3578 ; moved from .bss
+v3579 dd 3579 ; moved from .bss
+v3580 dd 3580 ; moved from .bss
+v3581 dd 3581 ; moved from .bss
+v3582 dd 3582 ; moved from .bss
+v3583 dd 3583 ; moved from .bss
+v3584 dd 3584 ; moved from .bss
+v3585 dd 3585 ; moved from .bss
+v3586 dd 3586 ; moved from .bss
+v3587 dd 3587 ; moved from .bss
+v3588 dd 3588 ; moved from .bss
+v3589 dd 3589 ; moved from .bss
+v3590 dd 3590 ; moved from .bss
+v3591 dd 3591 ; moved from .bss
+v3592 dd 3592 ; moved from .bss
+v3593 dd 3593 ; moved from .bss
+v3594 dd 3594 ; moved from .bss
+v3595 dd 3595 ; moved from .bss
+v3596 dd 3596 ; moved from .bss
+v3597 dd 3597 ; moved from .bss
+v3598 dd 3598 ; moved from .bss
+v3599 dd 3599 ; moved from .bss
+v3600 dd 3600 ; moved from .bss
+v3601 dd 3601 ; moved from .bss
+v3602 dd 3602 ; moved from .bss
+v3603 dd 3603 ; moved from .bss
+v3604 dd 3604 ; moved from .bss
+v3605 dd 3605 ; moved from .bss
+v3606 dd 3606 ; moved from .bss
+v3607 dd 3607 ; moved from .bss
+v3608 dd 3608 ; moved from .bss
+v3609 dd 3609 ; moved from .bss
+v3610 dd 3610 ; moved from .bss
+v3611 dd 3611 ; moved from .bss
+v3612 dd 3612 ; moved from .bss
+v3613 dd 3613 ; moved from .bss
+v3614 dd 3614 ; moved from .bss
+v3615 dd 3615 ; moved from .bss
+v3616 dd 3616 ; moved from .bss
+v3617 dd 3617 ; moved from .bss
+v3618 dd 3618 ; moved from .bss
+v3619 dd 3619 ; moved from .bss
+v3620 dd 3620 ; moved from .bss
+v3621 dd 3621 ; moved from .bss
+v3622 dd 3622 ; moved from .bss
+v3623 dd 3623 ; moved from .bss
+v3624 dd 3624 ; moved from .bss
+v3625 dd 3625 ; moved from .bss
+v3626 dd 3626 ; moved from .bss
+v3627 dd 3627 ; moved from .bss
+v3628 dd 3628 ; moved from .bss
+v3629 dd 3629 ; moved from .bss
+v3630 dd 3630 ; moved from .bss
+v3631 dd 3631 ; moved from .bss
+v3632 dd 3632 ; moved from .bss
+v3633 dd 3633 ; moved from .bss
+v3634 dd 3634 ; moved from .bss
+v3635 dd 3635 ; moved from .bss
+v3636 dd 3636 ; moved from .bss
+v3637 dd 3637 ; moved from .bss
+v3638 dd 3638 ; moved from .bss
+v3639 dd 3639 ; moved from .bss
+v3640 dd 3640 ; moved from .bss
+v3641 dd 3641 ; moved from .bss
+v3642 dd 3642 ; moved from .bss
+v3643 dd 3643 ; moved from .bss
+v3644 dd 3644 ; moved from .bss
+v3645 dd 3645 ; moved from .bss
+v3646 dd 3646 ; moved from .bss
+v3647 dd 3647 ; moved from .bss
+v3648 dd 3648 ; moved from .bss
+v3649 dd 3649 ; moved from .bss
+v3650 dd 3650 ; moved from .bss
+v3651 dd 3651 ; moved from .bss
+v3652 dd 3652 ; moved from .bss
+v3653 dd 3653 ; moved from .bss
+v3654 dd 3654 ; moved from .bss
+v3655 dd 3655 ; moved from .bss
+v3656 dd 3656 ; moved from .bss
+v3657 dd 3657 ; moved from .bss
+v3658 dd 3658 ; moved from .bss
+v3659 dd 3659 ; moved from .bss
+v3660 dd 3660 ; moved from .bss
+v3661 dd 3661 ; moved from .bss
+v3662 dd 3662 ; moved from .bss
+v3663 dd 3663 ; moved from .bss
+v3664 dd 3664 ; moved from .bss
+v3665 dd 3665 ; moved from .bss
+v3666 dd 3666 ; moved from .bss
+v3667 dd 3667 ; moved from .bss
+v3668 dd 3668 ; moved from .bss
+v3669 dd 3669 ; moved from .bss
+v3670 dd 3670 ; moved from .bss
+v3671 dd 3671 ; moved from .bss
+v3672 dd 3672 ; moved from .bss
+v3673 dd 3673 ; moved from .bss
+v3674 dd 3674 ; moved from .bss
+v3675 dd 3675 ; moved from .bss
+v3676 dd 3676 ; moved from .bss
+v3677 dd 3677 ; moved from .bss
+v3678 dd 3678 ; moved from .bss
+v3679 dd 3679 ; moved from .bss
+v3680 dd 3680 ; moved from .bss
+v3681 dd 3681 ; moved from .bss
+v3682 dd 3682 ; moved from .bss
+v3683 dd 3683 ; moved from .bss
+v3684 dd 3684 ; moved from .bss
+v3685 dd 3685 ; moved from .bss
+v3686 dd 3686 ; moved from .bss
+v3687 dd 3687 ; moved from .bss
+v3688 dd 3688 ; moved from .bss
+v3689 dd 3689 ; moved from .bss
+v3690 dd 3690 ; moved from .bss
+v3691 dd 3691 ; moved from .bss
+v3692 dd 3692 ; moved from .bss
+v3693 dd 3693 ; moved from .bss
+v3694 dd 3694 ; moved from .bss
+v3695 dd 3695 ; moved from .bss
+v3696 dd 3696 ; moved from .bss
+v3697 dd 3697 ; moved from .bss
+v3698 dd 3698 ; moved from .bss
+v3699 dd 3699 ; moved from .bss
+v3700 dd 3700 ; moved from .bss
+v3701 dd 3701 ; moved from .bss
+v3702 dd 3702 ; moved from .bss
+v3703 dd 3703 ; moved from .bss
+v3704 dd 3704 ; moved from .bss
+v3705 dd 3705 ; moved from .bss
+v3706 dd 3706 ; moved from .bss
+v3707 dd 3707 ; moved from .bss
+v3708 dd 3708 ; moved from .bss
+v3709 dd 3709 ; moved from .bss
+v3710 dd 3710 ; moved from .bss
+v3711 dd 3711 ; moved from .bss
+v3712 dd 3712 ; moved from .bss
+v3713 dd 3713 ; moved from .bss
+v3714 dd 3714 ; moved from .bss
+v3715 dd 3715 ; moved from .bss
+v3716 dd 3716 ; moved from .bss
+v3717 dd 3717 ; moved from .bss
+v3718 dd 3718 ; moved from .bss
+v3719 dd 3719 ; moved from .bss
+v3720 dd 3720 ; moved from .bss
+v3721 dd 3721 ; moved from .bss
+v3722 dd 3722 ; moved from .bss
+v3723 dd 3723 ; moved from .bss
+v3724 dd 3724 ; moved from .bss
+v3725 dd 3725 ; moved from .bss
+v3726 dd 3726 ; moved from .bss
+v3727 dd 3727 ; moved from .bss
+v3728 dd 3728 ; moved from .bss
+v3729 dd 3729 ; moved from .bss
+v3730 dd 3730 ; moved from .bss
+v3731 dd 3731 ; moved from .bss
+v3732 dd 3732 ; moved from .bss
+v3733 dd 3733 ; moved from .bss
+v3734 dd 3734 ; moved from .bss
+v3735 dd 3735 ; moved from .bss
+v3736 dd 3736 ; moved from .bss
+v3737 dd 3737 ; moved from .bss
+v3738 dd 3738 ; moved from .bss
+v3739 dd 3739 ; moved from .bss
+v3740 dd 3740 ; moved from .bss
+v3741 dd 3741 ; moved from .bss
+v3742 dd 3742 ; moved from .bss
+v3743 dd 3743 ; moved from .bss
+v3744 dd 3744 ; moved from .bss
+v3745 dd 3745 ; moved from .bss
+v3746 dd 3746 ; moved from .bss
+v3747 dd 3747 ; moved from .bss
+v3748 dd 3748 ; moved from .bss
+v3749 dd 3749 ; moved from .bss
+v3750 dd 3750 ; moved from .bss
+v3751 dd 3751 ; moved from .bss
+v3752 dd 3752 ; moved from .bss
+v3753 dd 3753 ; moved from .bss
+v3754 dd 3754 ; moved from .bss
+v3755 dd 3755 ; moved from .bss
+v3756 dd 3756 ; moved from .bss
+v3757 dd 3757 ; moved from .bss
+v3758 dd 3758 ; moved from .bss
+v3759 dd 3759 ; moved from .bss
+v3760 dd 3760 ; moved from .bss
+v3761 dd 3761 ; moved from .bss
+v3762 dd 3762 ; moved from .bss
+v3763 dd 3763 ; moved from .bss
+v3764 dd 3764 ; moved from .bss
+v3765 dd 3765 ; moved from .bss
+v3766 dd 3766 ; moved from .bss
+v3767 dd 3767 ; moved from .bss
+v3768 dd 3768 ; moved from .bss
+v3769 dd 3769 ; moved from .bss
+v3770 dd 3770 ; moved from .bss
+v3771 dd 3771 ; moved from .bss
+v3772 dd 3772 ; moved from .bss
+v3773 dd 3773 ; moved from .bss
+v3774 dd 3774 ; moved from .bss
+v3775 dd 3775 ; moved from .bss
+v3776 dd 3776 ; moved from .bss
+v3777 dd 3777 ; moved from .bss
+v3778 dd 3778 ; moved from .bss
+v3779 dd 3779 ; moved from .bss
+v3780 dd 3780 ; moved from .bss
+v3781 dd 3781 ; moved from .bss
+v3782 dd 3782 ; moved from .bss
+v3783 dd 3783 ; moved from .bss
+v3784 dd 3784 ; moved from .bss
+v3785 dd 3785 ; moved from .bss
+v3786 dd 3786 ; moved from .bss
+v3787 dd 3787 ; moved from .bss
+v3788 dd 3788 ; moved from .bss
+v3789 dd 3789 ; moved from .bss
+v3790 dd 3790 ; moved from .bss
+v3791 dd 3791 ; moved from .bss
+v3792 dd 3792 ; moved from .bss
+v3793 dd 3793 ; moved from .bss
+v3794 dd 3794 ; moved from .bss
+v3795 dd 3795 ; moved from .bss
+v3796 dd 3796 ; moved from .bss
+v3797 dd 3797 ; moved from .bss
+v3798 dd 3798 ; moved from .bss
+v3799 dd 3799 ; moved from .bss
+v3800 dd 3800 ; moved from .bss
+v3801 dd 3801 ; moved from .bss
+v3802 dd 3802 ; moved from .bss
+v3803 dd 3803 ; moved from .bss
+v3804 dd 3804 ; moved from .bss
+v3805 dd 3805 ; moved from .bss
+v3806 dd 3806 ; moved from .bss
+v3807 dd 3807 ; moved from .bss
+v3808 dd 3808 ; moved from .bss
+v3809 dd 3809 ; moved from .bss
+v3810 dd 3810 ; moved from .bss
+v3811 dd 3811 ; moved from .bss
+v3812 dd 3812 ; moved from .bss
+v3813 dd 3813 ; moved from .bss
+v3814 dd 3814 ; moved from .bss
+v3815 dd 3815 ; moved from .bss
+v3816 dd 3816 ; moved from .bss
+v3817 dd 3817 ; moved from .bss
+v3818 dd 3818 ; moved from .bss
+v3819 dd 3819 ; moved from .bss
+v3820 dd 3820 ; moved from .bss
+v3821 dd 3821 ; moved from .bss
+v3822 dd 3822 ; moved from .bss
+v3823 dd 3823 ; moved from .bss
+v3824 dd 3824 ; moved from .bss
+v3825 dd 3825 ; moved from .bss
+v3826 dd 3826 ; moved from .bss
+v3827 dd 3827 ; moved from .bss
+v3828 dd 3828 ; moved from .bss
+v3829 dd 3829 ; moved from .bss
+v3830 dd 3830 ; moved from .bss
+v3831 dd 3831 ; moved from .bss
+v3832 dd 3832 ; moved from .bss
+v3833 dd 3833 ; moved from .bss
+v3834 dd 3834 ; moved from .bss
+v3835 dd 3835 ; moved from .bss
+v3836 dd 3836 ; moved from .bss
+v3837 dd 3837 ; moved from .bss
+v3838 dd 3838 ; moved from .bss
+v3839 dd 3839 ; moved from .bss
+v3840 dd 3840 ; moved from .bss
+v3841 dd 3841 ; moved from .bss
+v3842 dd 3842 ; moved from .bss
+v3843 dd 3843 ; moved from .bss
+v3844 dd 3844 ; moved from .bss
+v3845 dd 3845 ; moved from .bss
+v3846 dd 3846 ; moved from .bss
+v3847 dd 3847 ; moved from .bss
+v3848 dd 3848 ; moved from .bss
+v3849 dd 3849 ; moved from .bss
+v3850 dd 3850 ; moved from .bss
+v3851 dd 3851 ; moved from .bss
+v3852 dd 3852 ; moved from .bss
+v3853 dd 3853 ; moved from .bss
+v3854 dd 3854 ; moved from .bss
+v3855 dd 3855 ; moved from .bss
+v3856 dd 3856 ; moved from .bss
+v3857 dd 3857 ; moved from .bss
+v3858 dd 3858 ; moved from .bss
+v3859 dd 3859 ; moved from .bss
+v3860 dd 3860 ; moved from .bss
+v3861 dd 3861 ; moved from .bss
+v3862 dd 3862 ; moved from .bss
+v3863 dd 3863 ; moved from .bss
+v3864 dd 3864 ; moved from .bss
+v3865 dd 3865 ; moved from .bss
+v3866 dd 3866 ; moved from .bss
+v3867 dd 3867 ; moved from .bss
+v3868 dd 3868 ; moved from .bss
+v3869 dd 3869 ; moved from .bss
+v3870 dd 3870 ; moved from .bss
+v3871 dd 3871 ; moved from .bss
+v3872 dd 3872 ; moved from .bss
+v3873 dd 3873 ; moved from .bss
+v3874 dd 3874 ; moved from .bss
+v3875 dd 3875 ; moved from .bss
+v3876 dd 3876 ; moved from .bss
+v3877 dd 3877 ; moved from .bss
+v3878 dd 3878 ; moved from .bss
+v3879 dd 3879 ; moved from .bss
+v3880 dd 3880 ; moved from .bss
+v3881 dd 3881 ; moved from .bss
+v3882 dd 3882 ; moved from .bss
+v3883 dd 3883 ; moved from .bss
+v3884 dd 3884 ; moved from .bss
+v3885 dd 3885 ; moved from .bss
+v3886 dd 3886 ; moved from .bss
+v3887 dd 3887 ; moved from .bss
+v3888 dd 3888 ; moved from .bss
+v3889 dd 3889 ; moved from .bss
+v3890 dd 3890 ; moved from .bss
+v3891 dd 3891 ; moved from .bss
+v3892 dd 3892 ; moved from .bss
+v3893 dd 3893 ; moved from .bss
+v3894 dd 3894 ; moved from .bss
+v3895 dd 3895 ; moved from .bss
+v3896 dd 3896 ; moved from .bss
+v3897 dd 3897 ; moved from .bss
+v3898 dd 3898 ; moved from .bss
+v3899 dd 3899 ; moved from .bss
+v3900 dd 3900 ; moved from .bss
+v3901 dd 3901 ; moved from .bss
+v3902 dd 3902 ; moved from .bss
+v3903 dd 3903 ; moved from .bss
+v3904 dd 3904 ; moved from .bss
+v3905 dd 3905 ; moved from .bss
+v3906 dd 3906 ; moved from .bss
+v3907 dd 3907 ; moved from .bss
+v3908 dd 3908 ; moved from .bss
+v3909 dd 3909 ; moved from .bss
+v3910 dd 3910 ; moved from .bss
+v3911 dd 3911 ; moved from .bss
+v3912 dd 3912 ; moved from .bss
+v3913 dd 3913 ; moved from .bss
+v3914 dd 3914 ; moved from .bss
+v3915 dd 3915 ; moved from .bss
+v3916 dd 3916 ; moved from .bss
+v3917 dd 3917 ; moved from .bss
+v3918 dd 3918 ; moved from .bss
+v3919 dd 3919 ; moved from .bss
+v3920 dd 3920 ; moved from .bss
+v3921 dd 3921 ; moved from .bss
+v3922 dd 3922 ; moved from .bss
+v3923 dd 3923 ; moved from .bss
+v3924 dd 3924 ; moved from .bss
+v3925 dd 3925 ; moved from .bss
+v3926 dd 3926 ; moved from .bss
+v3927 dd 3927 ; moved from .bss
+v3928 dd 3928 ; moved from .bss
+v3929 dd 3929 ; moved from .bss
+v3930 dd 3930 ; moved from .bss
+v3931 dd 3931 ; moved from .bss
+v3932 dd 3932 ; moved from .bss
+v3933 dd 3933 ; moved from .bss
+v3934 dd 3934 ; moved from .bss
+v3935 dd 3935 ; moved from .bss
+v3936 dd 3936 ; moved from .bss
+v3937 dd 3937 ; moved from .bss
+v3938 dd 3938 ; moved from .bss
+v3939 dd 3939 ; moved from .bss
+v3940 dd 3940 ; moved from .bss
+v3941 dd 3941 ; moved from .bss
+v3942 dd 3942 ; moved from .bss
+v3943 dd 3943 ; moved from .bss
+v3944 dd 3944 ; moved from .bss
+v3945 dd 3945 ; moved from .bss
+v3946 dd 3946 ; moved from .bss
+v3947 dd 3947 ; moved from .bss
+v3948 dd 3948 ; moved from .bss
+v3949 dd 3949 ; moved from .bss
+v3950 dd 3950 ; moved from .bss
+v3951 dd 3951 ; moved from .bss
+v3952 dd 3952 ; moved from .bss
+v3953 dd 3953 ; moved from .bss
+v3954 dd 3954 ; moved from .bss
+v3955 dd 3955 ; moved from .bss
+v3956 dd 3956 ; moved from .bss
+v3957 dd 3957 ; moved from .bss
+v3958 dd 3958 ; moved from .bss
+v3959 dd 3959 ; moved from .bss
+v3960 dd 3960 ; moved from .bss
+v3961 dd 3961 ; moved from .bss
+v3962 dd 3962 ; moved from .bss
+v3963 dd 3963 ; moved from .bss
+v3964 dd 3964 ; moved from .bss
+v3965 dd 3965 ; moved from .bss
+v3966 dd 3966 ; moved from .bss
+v3967 dd 3967 ; moved from .bss
+v3968 dd 3968 ; moved from .bss
+v3969 dd 3969 ; moved from .bss
+v3970 dd 3970 ; moved from .bss
+v3971 dd 3971 ; moved from .bss
+v3972 dd 3972 ; moved from .bss
+v3973 dd 3973 ; moved from .bss
+v3974 dd 3974 ; moved from .bss
+v3975 dd 3975 ; moved from .bss
+v3976 dd 3976 ; moved from .bss
+v3977 dd 3977 ; moved from .bss
+v3978 dd 3978 ; moved from .bss
+v3979 dd 3979 ; moved from .bss
+v3980 dd 3980 ; moved from .bss
+v3981 dd 3981 ; moved from .bss
+v3982 dd 3982 ; moved from .bss
+v3983 dd 3983 ; moved from .bss
+v3984 dd 3984 ; moved from .bss
+v3985 dd 3985 ; moved from .bss
+v3986 dd 3986 ; moved from .bss
+v3987 dd 3987 ; moved from .bss
+v3988 dd 3988 ; moved from .bss
+v3989 dd 3989 ; moved from .bss
+v3990 dd 3990 ; moved from .bss
+v3991 dd 3991 ; moved from .bss
+v3992 dd 3992 ; moved from .bss
+v3993 dd 3993 ; moved from .bss
+v3994 dd 3994 ; moved from .bss
+v3995 dd 3995 ; moved from .bss
+v3996 dd 3996 ; moved from .bss
+v3997 dd 3997 ; moved from .bss
+v3998 dd 3998 ; moved from .bss
+s3999 db ".text", 0 ; not .text
+v4000 dd 4000 ; moved from .bss
+v4001 dd 4001 ; moved from .bss
+v4002 dd 4002 ; moved from .bss
+v4003 dd 4003 ; moved from .bss
+v4004 dd 4004 ; moved from .bss
+v4005 dd 4005 ; moved from .bss
+v4006 dd 4006 ; moved from .bss
+v4007 dd 4007 ; moved from .bss
+v4008 dd 4008 ; moved from .bss
+v4009 dd 4009 ; moved from .bss
+v4010 dd 4010 ; moved from .bss
+v4011 dd 4011 ; moved from .bss
+v4012 dd 4012 ; moved from .bss
+v4013 dd 4013 ; moved from .bss
+v4014 dd 4014 ; moved from .bss
+v4015 dd 4015 ; moved from .bss
+v4016 dd 4016 ; moved from .bss
+v4017 dd 4017 ; moved from .bss
+v4018 dd 4018 ; moved from .bss
+v4019 dd 4019 ; moved from .bss
+v4020 dd 4020 ; moved from .bss
+v4021 dd 4021 ; moved from .bss
+v4022 dd 4022 ; moved from .bss
+v4023 dd 4023 ; moved from .bss
+v4024 dd 4024 ; moved from .bss
+v4025 dd 4025 ; moved from .bss
+v4026 dd 4026 ; moved from .bss
+v4027 dd 4027 ; moved from .bss
+v4028 dd 4028 ; moved from .bss
+v4029 dd 4029 ; moved from .bss
+v4030 dd 4030 ; moved from .bss
+v4031 dd 4031 ; moved from .bss
+v4032 dd 4032 ; moved from .bss
+v4033 dd 4033 ; moved from .bss
+v4034 dd 4034 ; moved from .bss
+v4035 dd 4035 ; moved from .bss
+v4036 dd 4036 ; moved from .bss
+v4037 dd 4037 ; moved from .bss
+v4038 dd 4038 ; moved from .bss
+v4039 dd 4039 ; moved from .bss
+v4040 dd 4040 ; moved from .bss
+v4041 dd 4041 ; moved from .bss
+v4042 dd 4042 ; moved from .bss
+v4043 dd 4043 ; moved from .bss
+v4044 dd 4044 ; moved from .bss
+v4045 dd 4045 ; moved from .bss
+v4046 dd 4046 ; moved from .bss
+v4047 dd 4047 ; moved from .bss
+v4048 dd 4048 ; moved from .bss
+v4049 dd 4049 ; moved from .bss
+v4050 dd 4050 ; moved from .bss
+v4051 dd 4051 ; moved from .bss
+v4052 dd 4052 ; moved from .bss
+v4053 dd 4053 ; moved from .bss
+v4054 dd 4054 ; moved from .bss
+v4055 dd 4055 ; moved from .bss
+v4056 dd 4056 ; moved from .bss
+v4057 dd 4057 ; moved from .bss
+v4058 dd 4058 ; moved from .bss
+v4059 dd 4059 ; moved from .bss
+v4060 dd 4060 ; moved from .bss
+v4061 dd 4061 ; moved from .bss
+v4062 dd 4062 ; moved from .bss
+v4063 dd 4063 ; moved from .bss
+v4064 dd 4064 ; moved from .bss
+v4065 dd 4065 ; moved from .bss
+v4066 dd 4066 ; moved from .bss
+v4067 dd 4067 ; moved from .bss
+v4068 dd 4068 ; moved from .bss
+v4069 dd 4069 ; moved from .bss
+v4070 dd 4070 ; moved from .bss
+v4071 dd 4071 ; moved from .bss
+v4072 dd 4072 ; moved from .bss
+v4073 dd 4073 ; moved from .bss
+v4074 dd 4074 ; moved from .bss
+v4075 dd 4075 ; moved from .bss
+v4076 dd 4076 ; moved from .bss
+v4077 dd 4077 ; moved from .bss
+v4078 dd 4078 ; moved from .bss
+v4079 dd 4079 ; moved from .bss
+v4080 dd 4080 ; moved from .bss
+v4081 dd 4081 ; moved from .bss
+v4082 dd 4082 ; moved from .bss
+v4083 dd 4083 ; moved from .bss
+v4084 dd 4084 ; moved from .bss
+v4085 dd 4085 ; moved from .bss
+v4086 dd 4086 ; moved from .bss
+v4087 dd 4087 ; moved from .bss
+v4088 dd 4088 ; moved from .bss
+v4089 dd 4089 ; moved from .bss
+v4090 dd 4090 ; moved from .bss
+v4091 dd 4091 ; moved from .bss
+v4092 dd 4092 ; moved from .bss
+v4093 dd 4093 ; moved from .bss
+v4094 dd 4094 ; moved from .bss
+v4095 dd 4095 ; moved from .bss
+v4096 dd 4096 ; moved from .bss
+v4097 dd 4097 ; moved from .bss
+v4098 dd 4098 ; moved from .bss
+v4099 dd 4099 ; moved from .bss
+v4100 dd 4100 ; moved from .bss
+v4101 dd 4101 ; moved from .bss
+v4102 dd 4102 ; moved from .bss
+v4103 dd 4103 ; moved from .bss
+v4104 dd 4104 ; moved from .bss
+v4105 dd 4105 ; moved from .bss
+v4106 dd 4106 ; moved from .bss
+v4107 dd 4107 ; moved from .bss
+v4108 dd 4108 ; moved from .bss
+v4109 dd 4109 ; moved from .bss
+v4110 dd 4110 ; moved from .bss
+v4111 dd 4111 ; moved from .bss
+v4112 dd 4112 ; moved from .bss
+v4113 dd 4113 ; moved from .bss
+v4114 dd 4114 ; moved from .bss
+v4115 dd 4115 ; moved from .bss
+v4116 dd 4116 ; moved from .bss
+v4117 dd 4117 ; moved from .bss
+v4118 dd 4118 ; moved from .bss
+v4119 dd 4119 ; moved from .bss
+v4120 dd 4120 ; moved from .bss
+v4121 dd 4121 ; moved from .bss
+v4122 dd 4122 ; moved from .bss
+v4123 dd 4123 ; moved from .bss
+v4124 dd 4124 ; moved from .bss
+v4125 dd 4125 ; moved from .bss
+v4126 dd 4126 ; moved from .bss
+v4127 dd 4127 ; moved from .bss
+v4128 dd 4128 ; moved from .bss
+v4129 dd 4129 ; moved from .bss
+v4130 dd 4130 ; moved from .bss
+v4131 dd 4131 ; moved from .bss
+v4132 dd 4132 ; moved from .bss
+v4133 dd 4133 ; moved from .bss
+v4134 dd 4134 ; moved from .bss
+v4135 dd 4135 ; moved from .bss
+v4136 dd 4136 ; moved from .bss
+v4137 dd 4137 ; moved from .bss
+v4138 dd 4138 ; moved from .bss
+v4139 dd 4139 ; moved from .bss
+v4140 dd 4140 ; moved from .bss
+v4141 dd 4141 ; moved from .bss
+v4142 dd 4142 ; moved from .bss
+v4143 dd 4143 ; moved from .bss
+v4144 dd 4144 ; moved from .bss
+v4145 dd 4145 ; moved from .bss
+v4146 dd 4146 ; moved from .bss
+v4147 dd 4147 ; moved from .bss
+v4148 dd 4148 ; moved from .bss
+v4149 dd 4149 ; moved from .bss
+v4150 dd 4150 ; moved from .bss
+v4151 dd 4151 ; moved from .bss
+v4152 dd 4152 ; moved from .bss
+v4153 dd 4153 ; moved from .bss
+v4154 dd 4154 ; moved from .bss
+v4155 dd 4155 ; moved from .bss
+v4156 dd 4156 ; moved from .bss
+v4157 dd 4157 ; moved from .bss
+v4158 dd 4158 ; moved from .bss
+v4159 dd 4159 ; moved from .bss
+v4160 dd 4160 ; moved from .bss
+v4161 dd 4161 ; moved from .bss
+v4162 dd 4162 ; moved from .bss
+v4163 dd 4163 ; moved from .bss
+v4164 dd 4164 ; moved from .bss
+v4165 dd 4165 ; moved from .bss
+v4166 dd 4166 ; moved from .bss
+v4167 dd 4167 ; moved from .bss
+v4168 dd 4168 ; moved from .bss
+v4169 dd 4169 ; moved from .bss
+v4170 dd 4170 ; moved from .bss
+v4171 dd 4171 ; moved from .bss
+v4172 dd 4172 ; moved from .bss
+v4173 dd 4173 ; moved from .bss
+v4174 dd 4174 ; moved from .bss
+v4175 dd 4175 ; moved from .bss
+v4176 dd 4176 ; moved from .bss
+v4177 dd 4177 ; moved from .bss
+v4178 dd 4178 ; moved from .bss
+v4179 dd 4179 ; moved from .bss
+v4180 dd 4180 ; moved from .bss
+v4181 dd 4181 ; moved from .bss
+v4182 dd 4182 ; moved from .bss
+v4183 dd 4183 ; moved from .bss
+v4184 dd 4184 ; moved from .bss
+v4185 dd 4185 ; moved from .bss
+v4186 dd 4186 ; moved from .bss
+v4187 dd 4187 ; moved from .bss
+v4188 dd 4188 ; moved from .bss
+v4189 dd 4189 ; moved from .bss
+v4190 dd 4190 ; moved from .bss
+v4191 dd 4191 ; moved from .bss
+v4192 dd 4192 ; moved from .bss
+v4193 dd 4193 ; moved from .bss
+v4194 dd 4194 ; moved from .bss
+v4195 dd 4195 ; moved from .bss
+v4196 dd 4196 ; moved from .bss
+v4197 dd 4197 ; moved from .bss
+v4198 dd 4198 ; moved from .bss
+v4199 dd 4199 ; moved from .bss
+v4200 dd 4200 ; moved from .bss
+v4201 dd 4201 ; moved from .bss
+v4202 dd 4202 ; moved from .bss
+v4203 dd 4203 ; moved from .bss
+v4204 dd 4204 ; moved from .bss
+v4205 dd 4205 ; moved from .bss
+v4206 dd 4206 ; moved from .bss
+v4207 dd 4207 ; moved from .bss
+v4208 dd 4208 ; moved from .bss
+v4209 dd 4209 ; moved from .bss
+v4210 dd 4210 ; moved from .bss
+v4211 dd 4211 ; moved from .bss
+v4212 dd 4212 ; moved from .bss
+v4213 dd 4213 ; moved from .bss
+v4214 dd 4214 ; moved from .bss
+v4215 dd 4215 ; moved from .bss
+v4216 dd 4216 ; moved from .bss
+v4217 dd 4217 ; moved from .bss
+v4218 dd 4218 ; moved from .bss
+v4219 dd 4219 ; moved from .bss
+v4220 dd 4220 ; moved from .bss
+v4221 dd 4221 ; moved from .bss
+v4222 dd 4222 ; moved from .bss
+v4223 dd 4223 ; moved from .bss
+v4224 dd 4224 ; moved from .bss
+v4225 dd 4225 ; moved from .bss
+v4226 dd 4226 ; moved from .bss
+v4227 dd 4227 ; moved from .bss
+v4228 dd 4228 ; moved from .bss
+v4229 dd 4229 ; moved from .bss
+v4230 dd 4230 ; moved from .bss
+v4231 dd 4231 ; moved from .bss
+v4232 dd 4232 ; moved from .bss
+v4233 dd 4233 ; moved from .bss
+v4234 dd 4234 ; moved from .bss
+v4235 dd 4235 ; moved from .bss
+v4236 dd 4236 ; moved from .bss
+v4237 dd 4237 ; moved from .bss
+v4238 dd 4238 ; moved from .bss
+v4239 dd 4239 ; moved from .bss
+v4240 dd 4240 ; moved from .bss
+v4241 dd 4241 ; moved from .bss
+v4242 dd 4242 ; moved from .bss
+v4243 dd 4243 ; moved from .bss
+v4244 dd 4244 ; moved from .bss
+v4245 dd 4245 ; moved from .bss
+v4246 dd 4246 ; moved from .bss
+v4247 dd 4247 ; moved from .bss
+v4248 dd 4248 ; moved from .bss
+v4249 dd 4249 ; moved from .bss
+v4250 dd 4250 ; moved from .bss
+v4251 dd 4251 ; moved from .bss
+v4252 dd 4252 ; moved from .bss
+v4253 dd 4253 ; moved from .bss
+v4254 dd 4254 ; moved from .bss
+v4255 dd 4255 ; moved from .bss
+v4256 dd 4256 ; moved from .bss
+v4257 dd 4257 ; moved from .bss
+v4258 dd 4258 ; moved from .bss
+v4259 dd 4259 ; moved from .bss
+v4260 dd 4260 ; moved from .bss
+v4261 dd 4261 ; moved from .bss
+v4262 dd 4262 ; moved from .bss
+v4263 dd 4263 ; moved from .bss
+v4264 dd 4264 ; moved from .bss
+v4265 dd 4265 ; moved from .bss
+v4266 dd 4266 ; moved from .bss
+v4267 dd 4267 ; moved from .bss
+v4268 dd 4268 ; moved from .bss
+v4269 dd 4269 ; moved from .bss
+v4270 dd 4270 ; moved from .bss
+v4271 dd 4271 ; moved from .bss
+v4272 dd 4272 ; moved from .bss
+v4273 dd 4273 ; moved from .bss
+v4274 dd 4274 ; moved from .bss
+v4275 dd 4275 ; moved from .bss
+v4276 dd 4276 ; moved from .bss
+v4277 dd 4277 ; moved from .bss
+v4278 dd 4278 ; moved from .bss
+v4279 dd 4279 ; moved from .bss
+v4280 dd 4280 ; moved from .bss
+v4281 dd 4281 ; moved from .bss
+v4282 dd 4282 ; moved from .bss
+v4283 dd 4283 ; moved from .bss
+v4284 dd 4284 ; moved from .bss
+v4285 dd 4285 ; moved from .bss
+v4286 dd 4286 ; moved from .bss
+v4287 dd 4287 ; moved from .bss
+v4288 dd 4288 ; moved from .bss
+v4289 dd 4289 ; moved from .bss
+v4290 dd 4290 ; moved from .bss
+v4291 dd 4291 ; moved from .bss
+v4292 dd 4292 ; moved from .bss
+v4293 dd 4293 ; moved from .bss
+v4294 dd 4294 ; moved from .bss
+v4295 dd 4295 ; moved from .bss
+v4296 dd 4296 ; moved from .bss
+v4297 dd 4297 ; moved from .bss
+v4298 dd 4298 ; moved from .bss
+v4299 dd 4299 ; moved from .bss
+v4300 dd 4300 ; moved from .bss
+v4301 dd 4301 ; moved from .bss
+v4302 dd 4302 ; moved from .bss
+v4303 dd 4303 ; moved from .bss
+v4304 dd 4304 ; moved from .bss
+v4305 dd 4305 ; moved from .bss
+v4306 dd 4306 ; moved from .bss
+v4307 dd 4307 ; moved from .bss
+v4308 dd 4308 ; moved from .bss
+v4309 dd 4309 ; moved from .bss
+v4310 dd 4310 ; moved from .bss
+v4311 dd 4311 ; moved from .bss
+v4312 dd 4312 ; moved from .bss
+v4313 dd 4313 ; moved from .bss
+v4314 dd 4314 ; moved from .bss
+v4315 dd 4315 ; moved from .bss
+v4316 dd 4316 ; moved from .bss
+v4317 dd 4317 ; moved from .bss
+v4318 dd 4318 ; moved from .bss
+v4319 dd 4319 ; moved from .bss
+v4320 dd 4320 ; moved from .bss
+v4321 dd 4321 ; moved from .bss
+v4322 dd 4322 ; moved from .bss
+v4323 dd 4323 ; moved from .bss
+v4324 dd 4324 ; moved from .bss
+v4325 dd 4325 ; moved from .bss
+v4326 dd 4326 ; moved from .bss
+v4327 dd 4327 ; moved from .bss
+v4328 dd 4328 ; moved from .bss
+v4329 dd 4329 ; moved from .bss
+v4330 dd 4330 ; moved from .bss
+v4331 dd 4331 ; moved from .bss
+v4332 dd 4332 ; moved from .bss
+v4333 dd 4333 ; moved from .bss
+v4334 dd 4334 ; moved from .bss
+v4335 dd 4335 ; moved from .bss
+v4336 dd 4336 ; moved from .bss
+v4337 dd 4337 ; moved from .bss
+v4338 dd 4338 ; moved from .bss
+v4339 dd 4339 ; moved from .bss
+v4340 dd 4340 ; moved from .bss
+v4341 dd 4341 ; moved from .bss
+v4342 dd 4342 ; moved from .bss
+v4343 dd 4343 ; moved from .bss
+v4344 dd 4344 ; moved from .bss
+v4345 dd 4345 ; moved from .bss
+v4346 dd 4346 ; moved from .bss
+v4347 dd 4347 ; moved from .bss
+v4348 dd 4348 ; moved from .bss
+v4349 dd 4349 ; moved from .bss
+v4350 dd 4350 ; moved from .bss
+v4351 dd 4351 ; moved from .bss
+v4352 dd 4352 ; moved from .bss
+v4353 dd 4353 ; moved from .bss
+v4354 dd 4354 ; moved from .bss
+v4355 dd 4355 ; moved from .bss
+v4356 dd 4356 ; moved from .bss
+v4357 dd 4357 ; moved from .bss
+v4358 dd 4358 ; moved from .bss
+v4359 dd 4359 ; moved from .bss
+v4360 dd 4360 ; moved from .bss
+v4361 dd 4361 ; moved from .bss
+v4362 dd 4362 ; moved from .bss
+v4363 dd 4363 ; moved from .bss
+v4364 dd 4364 ; moved from .bss
+v4365 dd 4365 ; moved from .bss
+v4366 dd 4366 ; moved from .bss
+v4367 dd 4367 ; moved from .bss
+v4368 dd 4368 ; moved from .bss
+v4369 dd 4369 ; moved from .bss
+v4370 dd 4370 ; moved from .bss
+v4371 dd 4371 ; moved from .bss
+v4372 dd 4372 ; moved from .bss
+v4373 dd 4373 ; moved from .bss
+v4374 dd 4374 ; moved from .bss
+v4375 dd 4375 ; moved from .bss
+v4376 dd 4376 ; moved from .bss
+v4377 dd 4377 ; moved from .bss
+v4378 dd 4378 ; moved from .bss
+v4379 dd 4379 ; moved from .bss
+v4380 dd 4380 ; moved from .bss
+v4381 dd 4381 ; moved from .bss
+v4382 dd 4382 ; moved from .bss
+v4383 dd 4383 ; moved from .bss
+v4384 dd 4384 ; moved from .bss
+v4385 dd 4385 ; moved from .bss
+v4386 dd 4386 ; moved from .bss
+v4387 dd 4387 ; moved from .bss
+v4388 dd 4388 ; moved from .bss
+v4389 dd 4389 ; moved from .bss
+v4390 dd 4390 ; moved from .bss
+v4391 dd 4391 ; moved from .bss
+v4392 dd 4392 ; moved from .bss
+v4393 dd 4393 ; moved from .bss
+v4394 dd 4394 ; moved from .bss
+v4395 dd 4395 ; moved from .bss
+v4396 dd 4396 ; moved from .bss
+v4397 dd 4397 ; moved from .bss
+v4398 dd 4398 ; moved from .bss
+v4399 dd 4399 ; moved from .bss
+v4400 dd 4400 ; moved from .bss
+v4401 dd 4401 ; moved from .bss
+v4402 dd 4402 ; moved from .bss
+v4403 dd 4403 ; moved from .bss
+v4404 dd 4404 ; moved from .bss
+v4405 dd 4405 ; moved from .bss
+v4406 dd 4406 ; moved from .bss
+v4407 dd 4407 ; moved from .bss
+v4408 dd 4408 ; moved from .bss
+v4409 dd 4409 ; moved from .bss
+v4410 dd 4410 ; moved from .bss
+v4411 dd 4411 ; moved from .bss
+v4412 dd 4412 ; moved from .bss
+v4413 dd 4413 ; moved from .bss
+v4414 dd 4414 ; moved from .bss
+v4415 dd 4415 ; moved from .bss
+v4416 dd 4416 ; moved from .bss
+v4417 dd 4417 ; moved from .bss
+v4418 dd 4418 ; moved from .bss
+v4419 dd 4419 ; moved from .bss
+v4420 dd 4420 ; moved from .bss
+v4421 dd 4421 ; moved from .bss
+v4422 dd 4422 ; moved from .bss
+v4423 dd 4423 ; moved from .bss
+v4424 dd 4424 ; moved from .bss
+v4425 dd 4425 ; moved from .bss
+v4426 dd 4426 ; moved from .bss
+v4427 dd 4427 ; moved from .bss
+v4428 dd 4428 ; moved from .bss
+v4429 dd 4429 ; moved from .bss
+v4430 dd 4430 ; moved from .bss
+v4431 dd 4431 ; moved from .bss
+v4432 dd 4432 ; moved from .bss
+v4433 dd 4433 ; moved from .bss
+v4434 dd 4434 ; moved from .bss
+v4435 dd 4435 ; moved from .bss
+v4436 dd 4436 ; moved from .bss
+v4437 dd 4437 ; moved from .bss
+v4438 dd 4438 ; moved from .bss
+v4439 dd 4439 ; moved from .bss
+v4440 dd 4440 ; moved from .bss
+v4441 dd 4441 ; moved from .bss
+v4442 dd 4442 ; moved from .bss
+v4443 dd 4443 ; moved from .bss
+v4444 dd 4444 ; moved from .bss
+v4445 dd 4445 ; moved from .bss
+v4446 dd 4446 ; moved from .bss
+v4447 dd 4447 ; moved from .bss
+v4448 dd 4448 ; moved from .bss
+v4449 dd 4449 ; moved from .bss
+v4450 dd 4450 ; moved from .bss
+v4451 dd 4451 ; moved from .bss
+v4452 dd 4452 ; moved from .bss
+v4453 dd 4453 ; moved from .bss
+v4454 dd 4454 ; moved from .bss
+v4455 dd 4455 ; moved from .bss
+v4456 dd 4456 ; moved from .bss
+v4457 dd 4457 ; moved from .bss
+v4458 dd 4458 ; moved from .bss
+v4459 dd 4459 ; moved from .bss
+v4460 dd 4460 ; moved from .bss
+v4461 dd 4461 ; moved from .bss
+v4462 dd 4462 ; moved from .bss
+v4463 dd 4463 ; moved from .bss
+v4464 dd 4464 ; moved from .bss
+v4465 dd 4465 ; moved from .bss
+v4466 dd 4466 ; moved from .bss
+v4467 dd 4467 ; moved from .bss
+v4468 dd 4468 ; moved from .bss
+v4469 dd 4469 ; moved from .bss
+v4470 dd 4470 ; moved from .bss
+v4471 dd 4471 ; moved from .bss
+v4472 dd 4472 ; moved from .bss
+v4473 dd 4473 ; moved from .bss
+v4474 dd 4474 ; moved from .bss
+v4475 dd 4475 ; moved from .bss
+v4476 dd 4476 ; moved from .bss
+v4477 dd 4477 ; moved from .bss
+v4478 dd 4478 ; moved from .bss
+v4479 dd 4479 ; moved from .bss
+v4480 dd 4480 ; moved from .bss
+v4481 dd 4481 ; moved from .bss
+v4482 dd 4482 ; moved from .bss
+v4483 dd 4483 ; moved from .bss
+v4484 dd 4484 ; moved from .bss
+v4485 dd 4485 ; moved from .bss
+v4486 dd 4486 ; moved from .bss
+v4487 dd 4487 ; moved from .bss
+v4488 dd 4488 ; moved from .bss
+v4489 dd 4489 ; moved from .bss
+v4490 dd 4490 ; moved from .bss
+v4491 dd 4491 ; moved from .bss
+v4492 dd 4492 ; moved from .bss
+v4493 dd 4493 ; moved from .bss
+v4494 dd 4494 ; moved from .bss
+v4495 dd 4495 ; moved from .bss
+v4496 dd 4496 ; moved from .bss
+v4497 dd 4497 ; moved from .bss
+v4498 dd 4498 ; moved from .bss
+v4499 dd 4499 ; moved from .bss
+v4500 dd 4500 ; moved from .bss
+v4501 dd 4501 ; moved from .bss
+v4502 dd 4502 ; moved from .bss
+v4503 dd 4503 ; moved from .bss
+v4504 dd 4504 ; moved from .bss
+v4505 dd 4505 ; moved from .bss
+v4506 dd 4506 ; moved from .bss
+v4507 dd 4507 ; moved from .bss
+v4508 dd 4508 ; moved from .bss
+v4509 dd 4509 ; moved from .bss
+v4510 dd 4510 ; moved from .bss
+v4511 dd 4511 ; moved from .bss
+v4512 dd 4512 ; moved from .bss
+v4513 dd 4513 ; moved from .bss
+v4514 dd 4514 ; moved from .bss
+v4515 dd 4515 ; moved from .bss
+v4516 dd 4516 ; moved from .bss
+v4517 dd 4517 ; moved from .bss
+v4518 dd 4518 ; moved from .bss
+v4519 dd 4519 ; moved from .bss
+v4520 dd 4520 ; moved from .bss
+v4521 dd 4521 ; moved from .bss
+v4522 dd 4522 ; moved from .bss
+v4523 dd 4523 ; moved from .bss
+v4524 dd 4524 ; moved from .bss
+v4525 dd 4525 ; moved from .bss
+v4526 dd 4526 ; moved from .bss
+v4527 dd 4527 ; moved from .bss
+v4528 dd 4528 ; moved from .bss
+v4529 dd 4529 ; moved from .bss
+v4530 dd 4530 ; moved from .bss
+v4531 dd 4531 ; moved from .bss
+v4532 dd 4532 ; moved from .bss
+v4533 dd 4533 ; moved from .bss
+v4534 dd 4534 ; moved from .bss
+v4535 dd 4535 ; moved from .bss
+v4536 dd 4536 ; moved from .bss
+v4537 dd 4537 ; moved from .bss
+v4538 dd 4538 ; moved from .bss
+v4539 dd 4539 ; moved from .bss
+v4540 dd 4540 ; moved from .bss
+v4541 dd 4541 ; moved from .bss
+v4542 dd 4542 ; moved from .bss
+v4543 dd 4543 ; moved from .bss
+v4544 dd 4544 ; moved from .bss
+v4545 dd 4545 ; moved from .bss
+v4546 dd 4546 ; moved from .bss
+v4547 dd 4547 ; moved from .bss
+v4548 dd 4548 ; moved from .bss
+v4549 dd 4549 ; moved from .bss
+v4550 dd 4550 ; moved from .bss
+v4551 dd 4551 ; moved from .bss
+v4552 dd 4552 ; moved from .bss
+v4553 dd 4553 ; moved from .bss
+v4554 dd 4554 ; moved from .bss
+v4555 dd 4555 ; moved from .bss
+v4556 dd 4556 ; moved from .bss
+v4557 dd 4557 ; moved from .bss
+v4558 dd 4558 ; moved from .bss
+v4559 dd 4559 ; moved from .bss
+v4560 dd 4560 ; moved from .bss
+v4561 dd 4561 ; moved from .bss
+v4562 dd 4562 ; moved from .bss
+v4563 dd 4563 ; moved from .bss
+v4564 dd 4564 ; moved from .bss
+v4565 dd 4565 ; moved from .bss
+v4566 dd 4566 ; moved from .bss
+v4567 dd 4567 ; moved from .bss
+v4568 dd 4568 ; moved from .bss
+v4569 dd 4569 ; moved from .bss
+v4570 dd 4570 ; moved from .bss
+v4571 dd 4571 ; moved from .bss
+v4572 dd 4572 ; moved from .bss
+v4573 dd 4573 ; moved from .bss
+v4574 dd 4574 ; moved from .bss
+v4575 dd 4575 ; moved from .bss
+v4576 dd 4576 ; moved from .bss
+v4577 dd 4577 ; moved from .bss
+v4578 dd 4578 ; moved from .bss
+v4579 dd 4579 ; moved from .bss
+v4580 dd 4580 ; moved from .bss
+v4581 dd 4581 ; moved from .bss
+v4582 dd 4582 ; moved from .bss
+v4583 dd 4583 ; moved from .bss
+v4584 dd 4584 ; moved from .bss
+v4585 dd 4585 ; moved from .bss
+v4586 dd 4586 ; moved from .bss
+v4587 dd 4587 ; moved from .bss
+v4588 dd 4588 ; moved from .bss
+v4589 dd 4589 ; moved from .bss
+v4590 dd 4590 ; moved from .bss
+v4591 dd 4591 ; moved from .bss
+v4592 dd 4592 ; moved from .bss
+v4593 dd 4593 ; moved from .bss
+v4594 dd 4594 ; moved from .bss
+v4595 dd 4595 ; moved from .bss
+v4596 dd 4596 ; moved from .bss
+v4597 dd 4597 ; moved from .bss
+v4598 dd 4598 ; moved from .bss
+v4599 dd 4599 ; moved from .bss
+v4600 dd 4600 ; moved from .bss
+v4601 dd 4601 ; moved from .bss
+v4602 dd 4602 ; moved from .bss
+v4603 dd 4603 ; moved from .bss
+v4604 dd 4604 ; moved from .bss
+v4605 dd 4605 ; moved from .bss
+v4606 dd 4606 ; moved from .bss
+v4607 dd 4607 ; moved from .bss
+v4608 dd 4608 ; moved from .bss
+v4609 dd 4609 ; moved from .bss
+v4610 dd 4610 ; moved from .bss
+v4611 dd 4611 ; moved from .bss
+v4612 dd 4612 ; moved from .bss
+v4613 dd 4613 ; moved from .bss
+v4614 dd 4614 ; moved from .bss
+v4615 dd 4615 ; moved from .bss
+v4616 dd 4616 ; moved from .bss
+v4617 dd 4617 ; moved from .bss
+v4618 dd 4618 ; moved from .bss
+v4619 dd 4619 ; moved from .bss
+v4620 dd 4620 ; moved from .bss
+v4621 dd 4621 ; moved from .bss
+v4622 dd 4622 ; moved from .bss
+v4623 dd 4623 ; moved from .bss
+v4624 dd 4624 ; moved from .bss
+v4625 dd 4625 ; moved from .bss
+v4626 dd 4626 ; moved from .bss
+v4627 dd 4627 ; moved from .bss
+v4628 dd 4628 ; moved from .bss
+v4629 dd 4629 ; moved from .bss
+v4630 dd 4630 ; moved from .bss
+v4631 dd 4631 ; moved from .bss
+v4632 dd 4632 ; moved from .bss
+v4633 dd 4633 ; moved from .bss
+v4634 dd 4634 ; moved from .bss
+v4635 dd 4635 ; moved from .bss
+v4636 dd 4636 ; moved from .bss
+v4637 dd 4637 ; moved from .bss
+v4638 dd 4638 ; moved from .bss
+v4639 dd 4639 ; moved from .bss
+v4640 dd 4640 ; moved from .bss
+v4641 dd 4641 ; moved from .bss
+v4642 dd 4642 ; moved from .bss
+v4643 dd 4643 ; moved from .bss
+v4644 dd 4644 ; moved from .bss
+v4645 dd 4645 ; moved from .bss
+v4646 dd 4646 ; moved from .bss
+v4647 dd 4647 ; moved from .bss
+v4648 dd 4648 ; moved from .bss
+v4649 dd 4649 ; moved from .bss
+v4650 dd 4650 ; moved from .bss
+v4651 dd 4651 ; moved from .bss
+v4652 dd 4652 ; moved from .bss
+v4653 dd 4653 ; moved from .bss
+v4654 dd 4654 ; moved from .bss
+v4655 dd 4655 ; moved from .bss
+v4656 dd 4656 ; moved from .bss
+v4657 dd 4657 ; moved from .bss
+v4658 dd 4658 ; moved from .bss
+v4659 dd 4659 ; moved from .bss
+v4660 dd 4660 ; moved from .bss
+v4661 dd 4661 ; moved from .bss
+v4662 dd 4662 ; moved from .bss
+v4663 dd 4663 ; moved from .bss
+v4664 dd 4664 ; moved from .bss
+v4665 dd 4665 ; moved from .bss
+v4666 dd 4666 ; moved from .bss
+v4667 dd 4667 ; moved from .bss
+v4668 dd 4668 ; moved from .bss
+v4669 dd 4669 ; moved from .bss
+v4670 dd 4670 ; moved from .bss
+v4671 dd 4671 ; moved from .bss
+v4672 dd 4672 ; moved from .bss
+v4673 dd 4673 ; moved from .bss
+v4674 dd 4674 ; moved from .bss
+v4675 dd 4675 ; moved from .bss
+v4676 dd 4676 ; moved from .bss
+v4677 dd 4677 ; moved from .bss
+v4678 dd 4678 ; moved from .bss
+v4679 dd 4679 ; moved from .bss
+v4680 dd 4680 ; moved from .bss
+v4681 dd 4681 ; moved from .bss
+v4682 dd 4682 ; moved from .bss
+v4683 dd 4683 ; moved from .bss
+v4684 dd 4684 ; moved from .bss
+v4685 dd 4685 ; moved from .bss
+v4686 dd 4686 ; moved from .bss
+v4687 dd 4687 ; moved from .bss
+v4688 dd 4688 ; moved from .bss
+v4689 dd 4689 ; moved from .bss
+v4690 dd 4690 ; moved from .bss
+v4691 dd 4691 ; moved from .bss
+v4692 dd 4692 ; moved from .bss
+v4693 dd 4693 ; moved from .bss
+v4694 dd 4694 ; moved from .bss
+v4695 dd 4695 ; moved from .bss
+v4696 dd 4696 ; moved from .bss
+v4697 dd 4697 ; moved from .bss
+v4698 dd 4698 ; moved from .bss
+v4699 dd 4699 ; moved from .bss
+v4700 dd 4700 ; moved from .bss
+v4701 dd 4701 ; moved from .bss
+v4702 dd 4702 ; moved from .bss
+v4703 dd 4703 ; moved from .bss
+v4704 dd 4704 ; moved from .bss
+v4705 dd 4705 ; moved from .bss
+v4706 dd 4706 ; moved from .bss
+v4707 dd 4707 ; moved from .bss
+v4708 dd 4708 ; moved from .bss
+v4709 dd 4709 ; moved from .bss
+v4710 dd 4710 ; moved from .bss
+v4711 dd 4711 ; moved from .bss
+v4712 dd 4712 ; moved from .bss
+v4713 dd 4713 ; moved from .bss
+v4714 dd 4714 ; moved from .bss
+v4715 dd 4715 ; moved from .bss
+v4716 dd 4716 ; moved from .bss
+v4717 dd 4717 ; moved from .bss
+v4718 dd 4718 ; moved from .bss
+v4719 dd 4719 ; moved from .bss
+v4720 dd 4720 ; moved from .bss
+v4721 dd 4721 ; moved from .bss
+v4722 dd 4722 ; moved from .bss
+v4723 dd 4723 ; moved from .bss
+v4724 dd 4724 ; moved from .bss
+v4725 dd 4725 ; moved from .bss
+v4726 dd 4726 ; moved from .bss
+v4727 dd 4727 ; moved from .bss
+v4728 dd 4728 ; moved from .bss
+v4729 dd 4729 ; moved from .bss
+v4730 dd 4730 ; moved from .bss
+v4731 dd 4731 ; moved from .bss
+v4732 dd 4732 ; moved from .bss
+v4733 dd 4733 ; moved from .bss
+v4734 dd 4734 ; moved from .bss
+v4735 dd 4735 ; moved from .bss
+v4736 dd 4736 ; moved from .bss
+v4737 dd 4737 ; moved from .bss
+v4738 dd 4738 ; moved from .bss
+v4739 dd 4739 ; moved from .bss
+v4740 dd 4740 ; moved from .bss
+v4741 dd 4741 ; moved from .bss
+v4742 dd 4742 ; moved from .bss
+v4743 dd 4743 ; moved from .bss
+v4744 dd 4744 ; moved from .bss
+v4745 dd 4745 ; moved from .bss
+v4746 dd 4746 ; moved from .bss
+v4747 dd 4747 ; moved from .bss
+v4748 dd 4748 ; moved from .bss
+v4749 dd 4749 ; moved from .bss
+v4750 dd 4750 ; moved from .bss
+v4751 dd 4751 ; moved from .bss
+v4752 dd 4752 ; moved from .bss
+v4753 dd 4753 ; moved from .bss
+v4754 dd 4754 ; moved from .bss
+v4755 dd 4755 ; moved from .bss
+v4756 dd 4756 ; moved from .bss
+v4757 dd 4757 ; moved from .bss
+v4758 dd 4758 ; moved from .bss
+v4759 dd 4759 ; moved from .bss
+v4760 dd 4760 ; moved from .bss
+v4761 dd 4761 ; moved from .bss
+v4762 dd 4762 ; moved from .bss
+v4763 dd 4763 ; moved from .bss
+v4764 dd 4764 ; moved from .bss
+v4765 dd 4765 ; moved from .bss
+v4766 dd 4766 ; moved from .bss
+v4767 dd 4767 ; moved from .bss
+v4768 dd 4768 ; moved from .bss
+v4769 dd 4769 ; moved from .bss
+v4770 dd 4770 ; moved from .bss
+v4771 dd 4771 ; moved from .bss
+v4772 dd 4772 ; moved from .bss
+v4773 dd 4773 ; moved from .bss
+v4774 dd 4774 ; moved from .bss
+v4775 dd 4775 ; moved from .bss
+v4776 dd 4776 ; moved from .bss
+v4777 dd 4777 ; moved from .bss
+v4778 dd 4778 ; moved from .bss
+v4779 dd 4779 ; moved from .bss
+v4780 dd 4780 ; moved from .bss
+v4781 dd 4781 ; moved from .bss
+v4782 dd 4782 ; moved from .bss
+v4783 dd 4783 ; moved from .bss
+v4784 dd 4784 ; moved from .bss
+v4785 dd 4785 ; moved from .bss
+v4786 dd 4786 ; moved from .bss
+v4787 dd 4787 ; moved from .bss
+v4788 dd 4788 ; moved from .bss
+v4789 dd 4789 ; moved from .bss
+v4790 dd 4790 ; moved from .bss
+v4791 dd 4791 ; moved from .bss
+v4792 dd 4792 ; moved from .bss
+v4793 dd 4793 ; moved from .bss
+v4794 dd 4794 ; moved from .bss
+v4795 dd 4795 ; moved from .bss
+v4796 dd 4796 ; moved from .bss
+v4797 dd 4797 ; moved from .bss
+v4798 dd 4798 ; moved from .bss
+v4799 dd 4799 ; moved from .bss
+v4800 dd 4800 ; moved from .bss
+v4801 dd 4801 ; moved from .bss
+v4802 dd 4802 ; moved from .bss
+v4803 dd 4803 ; moved from .bss
+v4804 dd 4804 ; moved from .bss
+v4805 dd 4805 ; moved from .bss
+v4806 dd 4806 ; moved from .bss
+v4807 dd 4807 ; moved from .bss
+v4808 dd 4808 ; moved from .bss
+v4809 dd 4809 ; moved from .bss
+v4810 dd 4810 ; moved from .bss
+v4811 dd 4811 ; moved from .bss
+v4812 dd 4812 ; moved from .bss
+v4813 dd 4813 ; moved from .bss
+v4814 dd 4814 ; moved from .bss
+v4815 dd 4815 ; moved from .bss
+v4816 dd 4816 ; moved from .bss
+v4817 dd 4817 ; moved from .bss
+v4818 dd 4818 ; moved from .bss
+v4819 dd 4819 ; moved from .bss
+v4820 dd 4820 ; moved from .bss
+v4821 dd 4821 ; moved from .bss
+v4822 dd 4822 ; moved from .bss
+v4823 dd 4823 ; moved from .bss
+v4824 dd 4824 ; moved from .bss
+v4825 dd 4825 ; moved from .bss
+v4826 dd 4826 ; moved from .bss
+v4827 dd 4827 ; moved from .bss
+v4828 dd 4828 ; moved from .bss
+v4829 dd 4829 ; moved from .bss
+v4830 dd 4830 ; moved from .bss
+v4831 dd 4831 ; moved from .bss
+v4832 dd 4832 ; moved from .bss
+v4833 dd 4833 ; moved from .bss
+v4834 dd 4834 ; moved from .bss
+v4835 dd 4835 ; moved from .bss
+v4836 dd 4836 ; moved from .bss
+v4837 dd 4837 ; moved from .bss
+v4838 dd 4838 ; moved from .bss
+v4839 dd 4839 ; moved from .bss
+v4840 dd 4840 ; moved from .bss
+v4841 dd 4841 ; moved from .bss
+v4842 dd 4842 ; moved from .bss
+v4843 dd 4843 ; moved from .bss
+v4844 dd 4844 ; moved from .bss
+v4845 dd 4845 ; moved from .bss
+v4846 dd 4846 ; moved from .bss
+v4847 dd 4847 ; moved from .bss
+v4848 dd 4848 ; moved from .bss
+v4849 dd 4849 ; moved from .bss
+v4850 dd 4850 ; moved from .bss
+v4851 dd 4851 ; moved from .bss
+v4852 dd 4852 ; moved from .bss
+v4853 dd 4853 ; moved from .bss
+v4854 dd 4854 ; moved from .bss
+v4855 dd 4855 ; moved from .bss
+v4856 dd 4856 ; moved from .bss
+v4857 dd 4857 ; moved from .bss
+v4858 dd 4858 ; moved from .bss
+v4859 dd 4859 ; moved from .bss
+v4860 dd 4860 ; moved from .bss
+v4861 dd 4861 ; moved from .bss
+v4862 dd 4862 ; moved from .bss
+v4863 dd 4863 ; moved from .bss
+v4864 dd 4864 ; moved from .bss
+v4865 dd 4865 ; moved from .bss
+v4866 dd 4866 ; moved from .bss
+v4867 dd 4867 ; moved from .bss
+v4868 dd 4868 ; moved from .bss
+v4869 dd 4869 ; moved from .bss
+v4870 dd 4870 ; moved from .bss
+v4871 dd 4871 ; moved from .bss
+v4872 dd 4872 ; moved from .bss
+v4873 dd 4873 ; moved from .bss
+v4874 dd 4874 ; moved from .bss
+v4875 dd 4875 ; moved from .bss
+v4876 dd 4876 ; moved from .bss
+v4877 dd 4877 ; moved from .bss
+v4878 dd 4878 ; moved from .bss
+v4879 dd 4879 ; moved from .bss
+v4880 dd 4880 ; moved from .bss
+v4881 dd 4881 ; moved from .bss
+v4882 dd 4882 ; moved from .bss
+v4883 dd 4883 ; moved from .bss
+v4884 dd 4884 ; moved from .bss
+v4885 dd 4885 ; moved from .bss
+v4886 dd 4886 ; moved from .bss
+v4887 dd 4887 ; moved from .bss
+v4888 dd 4888 ; moved from .bss
+v4889 dd 4889 ; moved from .bss
+v4890 dd 4890 ; moved from .bss
+v4891 dd 4891 ; moved from .bss
+v4892 dd 4892 ; moved from .bss
+v4893 dd 4893 ; moved from .bss
+v4894 dd 4894 ; moved from .bss
+v4895 dd 4895 ; moved from .bss
+v4896 dd 4896 ; moved from .bss
+v4897 dd 4897 ; moved from .bss
+v4898 dd 4898 ; moved from .bss
+v4899 dd 4899 ; moved from .bss
+v4900 dd 4900 ; moved from .bss
+v4901 dd 4901 ; moved from .bss
+v4902 dd 4902 ; moved from .bss
+v4903 dd 4903 ; moved from .bss
+v4904 dd 4904 ; moved from .bss
+v4905 dd 4905 ; moved from .bss
+v4906 dd 4906 ; moved from .bss
+v4907 dd 4907 ; moved from .bss
+v4908 dd 4908 ; moved from .bss
+v4909 dd 4909 ; moved from .bss
+v4910 dd 4910 ; moved from .bss
+v4911 dd 4911 ; moved from .bss
+v4912 dd 4912 ; moved from .bss
+v4913 dd 4913 ; moved from .bss
+v4914 dd 4914 ; moved from .bss
+v4915 dd 4915 ; moved from .bss
+v4916 dd 4916 ; moved from .bss
+v4917 dd 4917 ; moved from .bss
+v4918 dd 4918 ; moved from .bss
+v4919 dd 4919 ; moved from .bss
+v4920 dd 4920 ; moved from .bss
+v4921 dd 4921 ; moved from .bss
+v4922 dd 4922 ; moved from .bss
+v4923 dd 4923 ; moved from .bss
+v4924 dd 4924 ; moved from .bss
+v4925 dd 4925 ; moved from .bss
+v4926 dd 4926 ; moved from .bss
+v4927 dd 4927 ; moved from .bss
+v4928 dd 4928 ; moved from .bss
+v4929 dd 4929 ; moved from .bss
+v4930 dd 4930 ; moved from .bss
+v4931 dd 4931 ; moved from .bss
+v4932 dd 4932 ; moved from .bss
+v4933 dd 4933 ; moved from .bss
+v4934 dd 4934 ; moved from .bss
+v4935 dd 4935 ; moved from .bss
+v4936 dd 4936 ; moved from .bss
+v4937 dd 4937 ; moved from .bss
+v4938 dd 4938 ; moved from .bss
+v4939 dd 4939 ; moved from .bss
+v4940 dd 4940 ; moved from .bss
+v4941 dd 4941 ; moved from .bss
+v4942 dd 4942 ; moved from .bss
+v4943 dd 4943 ; moved from .bss
+v4944 dd 4944 ; moved from .bss
+v4945 dd 4945 ; moved from .bss
+v4946 dd 4946 ; moved from .bss
+v4947 dd 4947 ; moved from .bss
+v4948 dd 4948 ; moved from .bss
+v4949 dd 4949 ; moved from .bss
+v4950 dd 4950 ; moved from .bss
+v4951 dd 4951 ; moved from .bss
+v4952 dd 4952 ; moved from .bss
+v4953 dd 4953 ; moved from .bss
+v4954 dd 4954 ; moved from .bss
+v4955 dd 4955 ; moved from .bss
+v4956 dd 4956 ; moved from .bss
+v4957 dd 4957 ; moved from .bss
+v4958 dd 4958 ; moved from .bss
+v4959 dd 4959 ; moved from .bss
+v4960 dd 4960 ; moved from .bss
+v4961 dd 4961 ; moved from .bss
+v4962 dd 4962 ; moved from .bss
+v4963 dd 4963 ; moved from .bss
+v4964 dd 4964 ; moved from .bss
+v4965 dd 4965 ; moved from .bss
+v4966 dd 4966 ; moved from .bss
+v4967 dd 4967 ; moved from .bss
+v4968 dd 4968 ; moved from .bss
+v4969 dd 4969 ; moved from .bss
+v4970 dd 4970 ; moved from .bss
+v4971 dd 4971 ; moved from .bss
+v4972 dd 4972 ; moved from .bss
+v4973 dd 4973 ; moved from .bss
+v4974 dd 4974 ; moved from .bss
+v4975 dd 4975 ; moved from .bss
+v4976 dd 4976 ; moved from .bss
+v4977 dd 4977 ; moved from .bss
+v4978 dd 4978 ; moved from .bss
+v4979 dd 4979 ; moved from .bss
+v4980 dd 4980 ; moved from .bss
+v4981 dd 4981 ; moved from .bss
+v4982 dd 4982 ; moved from .bss
+v4983 dd 4983 ; moved from .bss
+v4984 dd 4984 ; moved from .bss
+v4985 dd 4985 ; moved from .bss
+v4986 dd 4986 ; moved from .bss
+v4987 dd 4987 ; moved from .bss
+v4988 dd 4988 ; moved from .bss
+v4989 dd 4989 ; moved from .bss
+v4990 dd 4990 ; moved from .bss
+v4991 dd 4991 ; moved from .bss
+v4992 dd 4992 ; moved from .bss
+v4993 dd 4993 ; moved from .bss
+v4994 dd 4994 ; moved from .bss
+v4995 dd 4995 ; moved from .bss
+v4996 dd 4996 ; moved from .bss
+v4997 dd 4997 ; moved from .bss
+v4998 dd 4998 ; moved from .bss
+s4999 db ".text", 0 ; not .text
+v5000 dd 5000 ; moved from .bss
+v5001 dd 5001 ; moved from .bss
+v5002 dd 5002 ; moved from .bss
+v5003 dd 5003 ; moved from .bss
+v5004 dd 5004 ; moved from .bss
+v5005 dd 5005 ; moved from .bss
+v5006 dd 5006 ; moved from .bss
+v5007 dd 5007 ; moved from .bss
+v5008 dd 5008 ; moved from .bss
+v5009 dd 5009 ; moved from .bss
+v5010 dd 5010 ; moved from .bss
+v5011 dd 5011 ; moved from .bss
+v5012 dd 5012 ; moved from .bss
+v5013 dd 5013 ; moved from .bss
+v5014 dd 5014 ; moved from .bss
+v5015 dd 5015 ; moved from .bss
+v5016 dd 5016 ; moved from .bss
+v5017 dd 5017 ; moved from .bss
+v5018 dd 5018 ; moved from .bss
+v5019 dd 5019 ; moved from .bss
+v5020 dd 5020 ; moved from .bss
+v5021 dd 5021 ; moved from .bss
+v5022 dd 5022 ; moved from .bss
+v5023 dd 5023 ; moved from .bss
+v5024 dd 5024 ; moved from .bss
+v5025 dd 5025 ; moved from .bss
+v5026 dd 5026 ; moved from .bss
+v5027 dd 5027 ; moved from .bss
+v5028 dd 5028 ; moved from .bss
+v5029 dd 5029 ; moved from .bss
+v5030 dd 5030 ; moved from .bss
+v5031 dd 5031 ; moved from .bss
+v5032 dd 5032 ; moved from .bss
+v5033 dd 5033 ; moved from .bss
+v5034 dd 5034 ; moved from .bss
+v5035 dd 5035 ; moved from .bss
+v5036 dd 5036 ; moved from .bss
+v5037 dd 5037 ; moved from .bss
+v5038 dd 5038 ; moved from .bss
+v5039 dd 5039 ; moved from .bss
+v5040 dd 5040 ; moved from .bss
+v5041 dd 5041 ; moved from .bss
+v5042 dd 5042 ; moved from .bss
+v5043 dd 5043 ; moved from .bss
+v5044 dd 5044 ; moved from .bss
+v5045 dd 5045 ; moved from .bss
+v5046 dd 5046 ; moved from .bss
+v5047 dd 5047 ; moved from .bss
+v5048 dd 5048 ; moved from .bss
+v5049 dd 5049 ; moved from .bss
+v5050 dd 5050 ; moved from .bss
+v5051 dd 5051 ; moved from .bss
+v5052 dd 5052 ; moved from .bss
+v5053 dd 5053 ; moved from .bss
+v5054 dd 5054 ; moved from .bss
+v5055 dd 5055 ; moved from .bss
+v5056 dd 5056 ; moved from .bss
+v5057 dd 5057 ; moved from .bss
+v5058 dd 5058 ; moved from .bss
+v5059 dd 5059 ; moved from .bss
+v5060 dd 5060 ; moved from .bss
+v5061 dd 5061 ; moved from .bss
+v5062 dd 5062 ; moved from .bss
+v5063 dd 5063 ; moved from .bss
+v5064 dd 5064 ; moved from .bss
+v5065 dd 5065 ; moved from .bss
+v5066 dd 5066 ; moved from .bss
+v5067 dd 5067 ; moved from .bss
+v5068 dd 5068 ; moved from .bss
+v5069 dd 5069 ; moved from .bss
+v5070 dd 5070 ; moved from .bss
+v5071 dd 5071 ; moved from .bss
+v5072 dd 5072 ; moved from .bss
+v5073 dd 5073 ; moved from .bss
+v5074 dd 5074 ; moved from .bss
+v5075 dd 5075 ; moved from .bss
+v5076 dd 5076 ; moved from .bss
+v5077 dd 5077 ; moved from .bss
+v5078 dd 5078 ; moved from .bss
+v5079 dd 5079 ; moved from .bss
+v5080 dd 5080 ; moved from .bss
+v5081 dd 5081 ; moved from .bss
+v5082 dd 5082 ; moved from .bss
+v5083 dd 5083 ; moved from .bss
+v5084 dd 5084 ; moved from .bss
+v5085 dd 5085 ; moved from .bss
+v5086 dd 5086 ; moved from .bss
+v5087 dd 5087 ; moved from .bss
+v5088 dd 5088 ; moved from .bss
+v5089 dd 5089 ; moved from .bss
+v5090 dd 5090 ; moved from .bss
+v5091 dd 5091 ; moved from .bss
+v5092 dd 5092 ; moved from .bss
+v5093 dd 5093 ; moved from .bss
+v5094 dd 5094 ; moved from .bss
+v5095 dd 5095 ; moved from .bss
+v5096 dd 5096 ; moved from .bss
+v5097 dd 5097 ; moved from .bss
+v5098 dd 5098 ; moved from .bss
+v5099 dd 5099 ; moved from .bss
+v5100 dd 5100 ; moved from .bss
+v5101 dd 5101 ; moved from .bss
+v5102 dd 5102 ; moved from .bss
+v5103 dd 5103 ; moved from .bss
+v5104 dd 5104 ; moved from .bss
+v5105 dd 5105 ; moved from .bss
+v5106 dd 5106 ; moved from .bss
+v5107 dd 5107 ; moved from .bss
+v5108 dd 5108 ; moved from .bss
+v5109 dd 5109 ; moved from .bss
+v5110 dd 5110 ; moved from .bss
+v5111 dd 5111 ; moved from .bss
+v5112 dd 5112 ; moved from .bss
+v5113 dd 5113 ; moved from .bss
+v5114 dd 5114 ; moved from .bss
+v5115 dd 5115 ; moved from .bss
+v5116 dd 5116 ; moved from .bss
+v5117 dd 5117 ; moved from .bss
+v5118 dd 5118 ; moved from .bss
+v5119 dd 5119 ; moved from .bss
+v5120 dd 5120 ; moved from .bss
+v5121 dd 5121 ; moved from .bss
+v5122 dd 5122 ; moved from .bss
+v5123 dd 5123 ; moved from .bss
+v5124 dd 5124 ; moved from .bss
+v5125 dd 5125 ; moved from .bss
+v5126 dd 5126 ; moved from .bss
+v5127 dd 5127 ; moved from .bss
+v5128 dd 5128 ; moved from .bss
+v5129 dd 5129 ; moved from .bss
+v5130 dd 5130 ; moved from .bss
+v5131 dd 5131 ; moved from .bss
+v5132 dd 5132 ; moved from .bss
+v5133 dd 5133 ; moved from .bss
+v5134 dd 5134 ; moved from .bss
+v5135 dd 5135 ; moved from .bss
+v5136 dd 5136 ; moved from .bss
+v5137 dd 5137 ; moved from .bss
+v5138 dd 5138 ; moved from .bss
+v5139 dd 5139 ; moved from .bss
+v5140 dd 5140 ; moved from .bss
+v5141 dd 5141 ; moved from .bss
+v5142 dd 5142 ; moved from .bss
+v5143 dd 5143 ; moved from .bss
+v5144 dd 5144 ; moved from .bss
+v5145 dd 5145 ; moved from .bss
+v5146 dd 5146 ; moved from .bss
+v5147 dd 5147 ; moved from .bss
+v5148 dd 5148 ; moved from .bss
+v5149 dd 5149 ; moved from .bss
+v5150 dd 5150 ; moved from .bss
+v5151 dd 5151 ; moved from .bss
+v5152 dd 5152 ; moved from .bss
+v5153 dd 5153 ; moved from .bss
+v5154 dd 5154 ; moved from .bss
+v5155 dd 5155 ; moved from .bss
+v5156 dd 5156 ; moved from .bss
+v5157 dd 5157 ; moved from .bss
+v5158 dd 5158 ; moved from .bss
+v5159 dd 5159 ; moved from .bss
+v5160 dd 5160 ; moved from .bss
+v5161 dd 5161 ; moved from .bss
+v5162 dd 5162 ; moved from .bss
+v5163 dd 5163 ; moved from .bss
+v5164 dd 5164 ; moved from .bss
+v5165 dd 5165 ; moved from .bss
+v5166 dd 5166 ; moved from .bss
+v5167 dd 5167 ; moved from .bss
+v5168 dd 5168 ; moved from .bss
+v5169 dd 5169 ; moved from .bss
+v5170 dd 5170 ; moved from .bss
+v5171 dd 5171 ; moved from .bss
+v5172 dd 5172 ; moved from .bss
+v5173 dd 5173 ; moved from .bss
+v5174 dd 5174 ; moved from .bss
+v5175 dd 5175 ; moved from .bss
+v5176 dd 5176 ; moved from .bss
+v5177 dd 5177 ; moved from .bss
+v5178 dd 5178 ; moved from .bss
+v5179 dd 5179 ; moved from .bss
+v5180 dd 5180 ; moved from .bss
+v5181 dd 5181 ; moved from .bss
+v5182 dd 5182 ; moved from .bss
+v5183 dd 5183 ; moved from .bss
+v5184 dd 5184 ; moved from .bss
+v5185 dd 5185 ; moved from .bss
+v5186 dd 5186 ; moved from .bss
+v5187 dd 5187 ; moved from .bss
+v5188 dd 5188 ; moved from .bss
+v5189 dd 5189 ; moved from .bss
+v5190 dd 5190 ; moved from .bss
+v5191 dd 5191 ; moved from .bss
+v5192 dd 5192 ; moved from .bss
+v5193 dd 5193 ; moved from .bss
+v5194 dd 5194 ; moved from .bss
+v5195 dd 5195 ; moved from .bss
+v5196 dd 5196 ; moved from .bss
+v5197 dd 5197 ; moved from .bss
+v5198 dd 5198 ; moved from .bss
+v5199 dd 5199 ; moved from .bss
+v5200 dd 5200 ; moved from .bss
+v5201 dd 5201 ; moved from .bss
+v5202 dd 5202 ; moved from .bss
+v5203 dd 5203 ; moved from .bss
+v5204 dd 5204 ; moved from .bss
+v5205 dd 5205 ; moved from .bss
+v5206 dd 5206 ; moved from .bss
+v5207 dd 5207 ; moved from .bss
+v5208 dd 5208 ; moved from .bss
+v5209 dd 5209 ; moved from .bss
+v5210 dd 5210 ; moved from .bss
+v5211 dd 5211 ; moved from .bss
+v5212 dd 5212 ; moved from .bss
+v5213 dd 5213 ; moved from .bss
+v5214 dd 5214 ; moved from .bss
+v5215 dd 5215 ; moved from .bss
+v5216 dd 5216 ; moved from .bss
+v5217 dd 5217 ; moved from .bss
+v5218 dd 5218 ; moved from .bss
+v5219 dd 5219 ; moved from .bss
+v5220 dd 5220 ; moved from .bss
+v5221 dd 5221 ; moved from .bss
+v5222 dd 5222 ; moved from .bss
+v5223 dd 5223 ; moved from .bss
+v5224 dd 5224 ; moved from .bss
+v5225 dd 5225 ; moved from .bss
+v5226 dd 5226 ; moved from .bss
+v5227 dd 5227 ; moved from .bss
+v5228 dd 5228 ; moved from .bss
+v5229 dd 5229 ; moved from .bss
+v5230 dd 5230 ; moved from .bss
+v5231 dd 5231 ; moved from .bss
+v5232 dd 5232 ; moved from .bss
+v5233 dd 5233 ; moved from .bss
+v5234 dd 5234 ; moved from .bss
+v5235 dd 5235 ; moved from .bss
+v5236 dd 5236 ; moved from .bss
+v5237 dd 5237 ; moved from .bss
+v5238 dd 5238 ; moved from .bss
+v5239 dd 5239 ; moved from .bss
+v5240 dd 5240 ; moved from .bss
+v5241 dd 5241 ; moved from .bss
+v5242 dd 5242 ; moved from .bss
+v5243 dd 5243 ; moved from .bss
+v5244 dd 5244 ; moved from .bss
+v5245 dd 5245 ; moved from .bss
+v5246 dd 5246 ; moved from .bss
+v5247 dd 5247 ; moved from .bss
+v5248 dd 5248 ; moved from .bss
+v5249 dd 5249 ; moved from .bss
+v5250 dd 5250 ; moved from .bss
+v5251 dd 5251 ; moved from .bss
+v5252 dd 5252 ; moved from .bss
+v5253 dd 5253 ; moved from .bss
+v5254 dd 5254 ; moved from .bss
+v5255 dd 5255 ; moved from .bss
+v5256 dd 5256 ; moved from .bss
+v5257 dd 5257 ; moved from .bss
+v5258 dd 5258 ; moved from .bss
+v5259 dd 5259 ; moved from .bss
+v5260 dd 5260 ; moved from .bss
+v5261 dd 5261 ; moved from .bss
+v5262 dd 5262 ; moved from .bss
+v5263 dd 5263 ; moved from .bss
+v5264 dd 5264 ; moved from .bss
+v5265 dd 5265 ; moved from .bss
+v5266 dd 5266 ; moved from .bss
+v5267 dd 5267 ; moved from .bss
+v5268 dd 5268 ; moved from .bss
+v5269 dd 5269 ; moved from .bss
+v5270 dd 5270 ; moved from .bss
+v5271 dd 5271 ; moved from .bss
+v5272 dd 5272 ; moved from .bss
+v5273 dd 5273 ; moved from .bss
+v5274 dd 5274 ; moved from .bss
+v5275 dd 5275 ; moved from .bss
+v5276 dd 5276 ; moved from .bss
+v5277 dd 5277 ; moved from .bss
+v5278 dd 5278 ; moved from .bss
+v5279 dd 5279 ; moved from .bss
+v5280 dd 5280 ; moved from .bss
+v5281 dd 5281 ; moved from .bss
+v5282 dd 5282 ; moved from .bss
+v5283 dd 5283 ; moved from .bss
+v5284 dd 5284 ; moved from .bss
+v5285 dd 5285 ; moved from .bss
+v5286 dd 5286 ; moved from .bss
+v5287 dd 5287 ; moved from .bss
+v5288 dd 5288 ; moved from .bss
+v5289 dd 5289 ; moved from .bss
+v5290 dd 5290 ; moved from .bss
+v5291 dd 5291 ; moved from .bss
+v5292 dd 5292 ; moved from .bss
+v5293 dd 5293 ; moved from .bss
+v5294 dd 5294 ; moved from .bss
+v5295 dd 5295 ; moved from .bss
+v5296 dd 5296 ; moved from .bss
+v5297 dd 5297 ; moved from .bss
+v5298 dd 5298 ; moved from .bss
+v5299 dd 5299 ; moved from .bss
+v5300 dd 5300 ; moved from .bss
+v5301 dd 5301 ; moved from .bss
+v5302 dd 5302 ; moved from .bss
+v5303 dd 5303 ; moved from .bss
+v5304 dd 5304 ; moved from .bss
+v5305 dd 5305 ; moved from .bss
+v5306 dd 5306 ; moved from .bss
+v5307 dd 5307 ; moved from .bss
+v5308 dd 5308 ; moved from .bss
+v5309 dd 5309 ; moved from .bss
+v5310 dd 5310 ; moved from .bss
+v5311 dd 5311 ; moved from .bss
+v5312 dd 5312 ; moved from .bss
+v5313 dd 5313 ; moved from .bss
+v5314 dd 5314 ; moved from .bss
+v5315 dd 5315 ; moved from .bss
+v5316 dd 5316 ; moved from .bss
+v5317 dd 5317 ; moved from .bss
+v5318 dd 5318 ; moved from .bss
+v5319 dd 5319 ; moved from .bss
+v5320 dd 5320 ; moved from .bss
+v5321 dd 5321 ; moved from .bss
+v5322 dd 5322 ; moved from .bss
+v5323 dd 5323 ; moved from .bss
+v5324 dd 5324 ; moved from .bss
+v5325 dd 5325 ; moved from .bss
+v5326 dd 5326 ; moved from .bss
+v5327 dd 5327 ; moved from .bss
+v5328 dd 5328 ; moved from .bss
+v5329 dd 5329 ; moved from .bss
+v5330 dd 5330 ; moved from .bss
+v5331 dd 5331 ; moved from .bss
+v5332 dd 5332 ; moved from .bss
+v5333 dd 5333 ; moved from .bss
+v5334 dd 5334 ; moved from .bss
+v5335 dd 5335 ; moved from .bss
+v5336 dd 5336 ; moved from .bss
+v5337 dd 5337 ; moved from .bss
+v5338 dd 5338 ; moved from .bss
+v5339 dd 5339 ; moved from .bss
+v5340 dd 5340 ; moved from .bss
+v5341 dd 5341 ; moved from .bss
+v5342 dd 5342 ; moved from .bss
+v5343 dd 5343 ; moved from .bss
+v5344 dd 5344 ; moved from .bss
+v5345 dd 5345 ; moved from .bss
+v5346 dd 5346 ; moved from .bss
+v5347 dd 5347 ; moved from .bss
+v5348 dd 5348 ; moved from .bss
+v5349 dd 5349 ; moved from .bss
+v5350 dd 5350 ; moved from .bss
+v5351 dd 5351 ; moved from .bss
+v5352 dd 5352 ; moved from .bss
+v5353 dd 5353 ; moved from .bss
+v5354 dd 5354 ; moved from .bss
+v5355 dd 5355 ; moved from .bss
+v5356 dd 5356 ; moved from .bss
+v5357 dd 5357 ; moved from .bss
+v5358 dd 5358 ; moved from .bss
+v5359 dd 5359 ; moved from .bss
+v5360 dd 5360 ; moved from .bss
+v5361 dd 5361 ; moved from .bss
+v5362 dd 5362 ; moved from .bss
+v5363 dd 5363 ; moved from .bss
+v5364 dd 5364 ; moved from .bss
+v5365 dd 5365 ; moved from .bss
+v5366 dd 5366 ; moved from .bss
+v5367 dd 5367 ; moved from .bss
+v5368 dd 5368 ; moved from .bss
+v5369 dd 5369 ; moved from .bss
+v5370 dd 5370 ; moved from .bss
+v5371 dd 5371 ; moved from .bss
+v5372 dd 5372 ; moved from .bss
+v5373 dd 5373 ; moved from .bss
+v5374 dd 5374 ; moved from .bss
+v5375 dd 5375 ; moved from .bss
+v5376 dd 5376 ; moved from .bss
+v5377 dd 5377 ; moved from .bss
+v5378 dd 5378 ; moved from .bss
+v5379 dd 5379 ; moved from .bss
+v5380 dd 5380 ; moved from .bss
+v5381 dd 5381 ; moved from .bss
+v5382 dd 5382 ; moved from .bss
+v5383 dd 5383 ; moved from .bss
+v5384 dd 5384 ; moved from .bss
+v5385 dd 5385 ; moved from .bss
+v5386 dd 5386 ; moved from .bss
+v5387 dd 5387 ; moved from .bss
+v5388 dd 5388 ; moved from .bss
+v5389 dd 5389 ; moved from .bss
+v5390 dd 5390 ; moved from .bss
+v5391 dd 5391 ; moved from .bss
+v5392 dd 5392 ; moved from .bss
+v5393 dd 5393 ; moved from .bss
+v5394 dd 5394 ; moved from .bss
+v5395 dd 5395 ; moved from .bss
+v5396 dd 5396 ; moved from .bss
+v5397 dd 5397 ; moved from .bss
+v5398 dd 5398 ; moved from .bss
+v5399 dd 5399 ; moved from .bss
+v5400 dd 5400 ; moved from .bss
+v5401 dd 5401 ; moved from .bss
+v5402 dd 5402 ; moved from .bss
+v5403 dd 5403 ; moved from .bss
+v5404 dd 5404 ; moved from .bss
+v5405 dd 5405 ; moved from .bss
+v5406 dd 5406 ; moved from .bss
+v5407 dd 5407 ; moved from .bss
+v5408 dd 5408 ; moved from .bss
+v5409 dd 5409 ; moved from .bss
+v5410 dd 5410 ; moved from .bss
+v5411 dd 5411 ; moved from .bss
+v5412 dd 5412 ; moved from .bss
+v5413 dd 5413 ; moved from .bss
+v5414 dd 5414 ; moved from .bss
+v5415 dd 5415 ; moved from .bss
+v5416 dd 5416 ; moved from .bss
+v5417 dd 5417 ; moved from .bss
+v5418 dd 5418 ; moved from .bss
+v5419 dd 5419 ; moved from .bss
+v5420 dd 5420 ; moved from .bss
+v5421 dd 5421 ; moved from .bss
+v5422 dd 5422 ; moved from .bss
+v5423 dd 5423 ; moved from .bss
+v5424 dd 5424 ; moved from .bss
+v5425 dd 5425 ; moved from .bss
+v5426 dd 5426 ; moved from .bss
+v5427 dd 5427 ; moved from .bss
+v5428 dd 5428 ; moved from .bss
+v5429 dd 5429 ; moved from .bss
+v5430 dd 5430 ; moved from .bss
+v5431 dd 5431 ; moved from .bss
+v5432 dd 5432 ; moved from .bss
+v5433 dd 5433 ; moved from .bss
+v5434 dd 5434 ; moved from .bss
+v5435 dd 5435 ; moved from .bss
+v5436 dd 5436 ; moved from .bss
+v5437 dd 5437 ; moved from .bss
+v5438 dd 5438 ; moved from .bss
+v5439 dd 5439 ; moved from .bss
+v5440 dd 5440 ; moved from .bss
+v5441 dd 5441 ; moved from .bss
+v5442 dd 5442 ; moved from .bss
+v5443 dd 5443 ; moved from .bss
+v5444 dd 5444 ; moved from .bss
+v5445 dd 5445 ; moved from .bss
+v5446 dd 5446 ; moved from .bss
+v5447 dd 5447 ; moved from .bss
+v5448 dd 5448 ; moved from .bss
+v5449 dd 5449 ; moved from .bss
+v5450 dd 5450 ; moved from .bss
+v5451 dd 5451 ; moved from .bss
+v5452 dd 5452 ; moved from .bss
+v5453 dd 5453 ; moved from .bss
+v5454 dd 5454 ; moved from .bss
+v5455 dd 5455 ; moved from .bss
+v5456 dd 5456 ; moved from .bss
+v5457 dd 5457 ; moved from .bss
+v5458 dd 5458 ; moved from .bss
+v5459 dd 5459 ; moved from .bss
+v5460 dd 5460 ; moved from .bss
+v5461 dd 5461 ; moved from .bss
+v5462 dd 5462 ; moved from .bss
+v5463 dd 5463 ; moved from .bss
+v5464 dd 5464 ; moved from .bss
+v5465 dd 5465 ; moved from .bss
+v5466 dd 5466 ; moved from .bss
+v5467 dd 5467 ; moved from .bss
+v5468 dd 5468 ; moved from .bss
+v5469 dd 5469 ; moved from .bss
+v5470 dd 5470 ; moved from .bss
+v5471 dd 5471 ; moved from .bss
+v5472 dd 5472 ; moved from .bss
+v5473 dd 5473 ; moved from .bss
+v5474 dd 5474 ; moved from .bss
+v5475 dd 5475 ; moved from .bss
+v5476 dd 5476 ; moved from .bss
+v5477 dd 5477 ; moved from .bss
+v5478 dd 5478 ; moved from .bss
+v5479 dd 5479 ; moved from .bss
+v5480 dd 5480 ; moved from .bss
+v5481 dd 5481 ; moved from .bss
+v5482 dd 5482 ; moved from .bss
+v5483 dd 5483 ; moved from .bss
+v5484 dd 5484 ; moved from .bss
+v5485 dd 5485 ; moved from .bss
+v5486 dd 5486 ; moved from .bss
+v5487 dd 5487 ; moved from .bss
+v5488 dd 5488 ; moved from .bss
+v5489 dd 5489 ; moved from .bss
+v5490 dd 5490 ; moved from .bss
+v5491 dd 5491 ; moved from .bss
+v5492 dd 5492 ; moved from .bss
+v5493 dd 5493 ; moved from .bss
+v5494 dd 5494 ; moved from .bss
+v5495 dd 5495 ; moved from .bss
+v5496 dd 5496 ; moved from .bss
+v5497 dd 5497 ; moved from .bss
+v5498 dd 5498 ; moved from .bss
+v5499 dd 5499 ; moved from .bss
+v5500 dd 5500 ; moved from .bss
+v5501 dd 5501 ; moved from .bss
+v5502 dd 5502 ; moved from .bss
+v5503 dd 5503 ; moved from .bss
+v5504 dd 5504 ; moved from .bss
+v5505 dd 5505 ; moved from .bss
+v5506 dd 5506 ; moved from .bss
+v5507 dd 5507 ; moved from .bss
+v5508 dd 5508 ; moved from .bss
+v5509 dd 5509 ; moved from .bss
+v5510 dd 5510 ; moved from .bss
+v5511 dd 5511 ; moved from .bss
+v5512 dd 5512 ; moved from .bss
+v5513 dd 5513 ; moved from .bss
+v5514 dd 5514 ; moved from .bss
+v5515 dd 5515 ; moved from .bss
+v5516 dd 5516 ; moved from .bss
+v5517 dd 5517 ; moved from .bss
+v5518 dd 5518 ; moved from .bss
+v5519 dd 5519 ; moved from .bss
+v5520 dd 5520 ; moved from .bss
+v5521 dd 5521 ; moved from .bss
+v5522 dd 5522 ; moved from .bss
+v5523 dd 5523 ; moved from .bss
+v5524 dd 5524 ; moved from .bss
+v5525 dd 5525 ; moved from .bss
+v5526 dd 5526 ; moved from .bss
+v5527 dd 5527 ; moved from .bss
+v5528 dd 5528 ; moved from .bss
+v5529 dd 5529 ; moved from .bss
+v5530 dd 5530 ; moved from .bss
+v5531 dd 5531 ; moved from .bss
+v5532 dd 5532 ; moved from .bss
+v5533 dd 5533 ; moved from .bss
+v5534 dd 5534 ; moved from .bss
+v5535 dd 5535 ; moved from .bss
+v5536 dd 5536 ; moved from .bss
+v5537 dd 5537 ; moved from .bss
+v5538 dd 5538 ; moved from .bss
+v5539 dd 5539 ; moved from .bss
+v5540 dd 5540 ; moved from .bss
+v5541 dd 5541 ; moved from .bss
+v5542 dd 5542 ; moved from .bss
+v5543 dd 5543 ; moved from .bss
+v5544 dd 5544 ; moved from .bss
+v5545 dd 5545 ; moved from .bss
+v5546 dd 5546 ; moved from .bss
+v5547 dd 5547 ; moved from .bss
+v5548 dd 5548 ; moved from .bss
+v5549 dd 5549 ; moved from .bss
+v5550 dd 5550 ; moved from .bss
+v5551 dd 5551 ; moved from .bss
+v5552 dd 5552 ; moved from .bss
+v5553 dd 5553 ; moved from .bss
+v5554 dd 5554 ; moved from .bss
+v5555 dd 5555 ; moved from .bss
+v5556 dd 5556 ; moved from .bss
+v5557 dd 5557 ; moved from .bss
+v5558 dd 5558 ; moved from .bss
+v5559 dd 5559 ; moved from .bss
+v5560 dd 5560 ; moved from .bss
+v5561 dd 5561 ; moved from .bss
+v5562 dd 5562 ; moved from .bss
+v5563 dd 5563 ; moved from .bss
+v5564 dd 5564 ; moved from .bss
+v5565 dd 5565 ; moved from .bss
+v5566 dd 5566 ; moved from .bss
+v5567 dd 5567 ; moved from .bss
+v5568 dd 5568 ; moved from .bss
+v5569 dd 5569 ; moved from .bss
+v5570 dd 5570 ; moved from .bss
+v5571 dd 5571 ; moved from .bss
+v5572 dd 5572 ; moved from .bss
+v5573 dd 5573 ; moved from .bss
+v5574 dd 5574 ; moved from .bss
+v5575 dd 5575 ; moved from .bss
+v5576 dd 5576 ; moved from .bss
+v5577 dd 5577 ; moved from .bss
+v5578 dd 5578 ; moved from .bss
+v5579 dd 5579 ; moved from .bss
+v5580 dd 5580 ; moved from .bss
+v5581 dd 5581 ; moved from .bss
+v5582 dd 5582 ; moved from .bss
+v5583 dd 5583 ; moved from .bss
+v5584 dd 5584 ; moved from .bss
+v5585 dd 5585 ; moved from .bss
+v5586 dd 5586 ; moved from .bss
+v5587 dd 5587 ; moved from .bss
+v5588 dd 5588 ; moved from .bss
+v5589 dd 5589 ; moved from .bss
+v5590 dd 5590 ; moved from .bss
+v5591 dd 5591 ; moved from .bss
+v5592 dd 5592 ; moved from .bss
+v5593 dd 5593 ; moved from .bss
+v5594 dd 5594 ; moved from .bss
+v5595 dd 5595 ; moved from .bss
+v5596 dd 5596 ; moved from .bss
+v5597 dd 5597 ; moved from .bss
+v5598 dd 5598 ; moved from .bss
+v5599 dd 5599 ; moved from .bss
+v5600 dd 5600 ; moved from .bss
+v5601 dd 5601 ; moved from .bss
+v5602 dd 5602 ; moved from .bss
+v5603 dd 5603 ; moved from .bss
+v5604 dd 5604 ; moved from .bss
+v5605 dd 5605 ; moved from .bss
+v5606 dd 5606 ; moved from .bss
+v5607 dd 5607 ; moved from .bss
+v5608 dd 5608 ; moved from .bss
+v5609 dd 5609 ; moved from .bss
+v5610 dd 5610 ; moved from .bss
+v5611 dd 5611 ; moved from .bss
+v5612 dd 5612 ; moved from .bss
+v5613 dd 5613 ; moved from .bss
+v5614 dd 5614 ; moved from .bss
+v5615 dd 5615 ; moved from .bss
+v5616 dd 5616 ; moved from .bss
+v5617 dd 5617 ; moved from .bss
+v5618 dd 5618 ; moved from .bss
+v5619 dd 5619 ; moved from .bss
+v5620 dd 5620 ; moved from .bss
+v5621 dd 5621 ; moved from .bss
+v5622 dd 5622 ; moved from .bss
+v5623 dd 5623 ; moved from .bss
+v5624 dd 5624 ; moved from .bss
+v5625 dd 5625 ; moved from .bss
+v5626 dd 5626 ; moved from .bss
+v5627 dd 5627 ; moved from .bss
+v5628 dd 5628 ; moved from .bss
+v5629 dd 5629 ; moved from .bss
+v5630 dd 5630 ; moved from .bss
+v5631 dd 5631 ; moved from .bss
+v5632 dd 5632 ; moved from .bss
+v5633 dd 5633 ; moved from .bss
+v5634 dd 5634 ; moved from .bss
+v5635 dd 5635 ; moved from .bss
+v5636 dd 5636 ; moved from .bss
+v5637 dd 5637 ; moved from .bss
+v5638 dd 5638 ; moved from .bss
+v5639 dd 5639 ; moved from .bss
+v5640 dd 5640 ; moved from .bss
+v5641 dd 5641 ; moved from .bss
+v5642 dd 5642 ; moved from .bss
+v5643 dd 5643 ; moved from .bss
+v5644 dd 5644 ; moved from .bss
+v5645 dd 5645 ; moved from .bss
+v5646 dd 5646 ; moved from .bss
+v5647 dd 5647 ; moved from .bss
+v5648 dd 5648 ; moved from .bss
+v5649 dd 5649 ; moved from .bss
+v5650 dd 5650 ; moved from .bss
+v5651 dd 5651 ; moved from .bss
+v5652 dd 5652 ; moved from .bss
+v5653 dd 5653 ; moved from .bss
+v5654 dd 5654 ; moved from .bss
+v5655 dd 5655 ; moved from .bss
+v5656 dd 5656 ; moved from .bss
+v5657 dd 5657 ; moved from .bss
+v5658 dd 5658 ; moved from .bss
+v5659 dd 5659 ; moved from .bss
+v5660 dd 5660 ; moved from .bss
+v5661 dd 5661 ; moved from .bss
+v5662 dd 5662 ; moved from .bss
+v5663 dd 5663 ; moved from .bss
+v5664 dd 5664 ; moved from .bss
+v5665 dd 5665 ; moved from .bss
+v5666 dd 5666 ; moved from .bss
+v5667 dd 5667 ; moved from .bss
+v5668 dd 5668 ; moved from .bss
+v5669 dd 5669 ; moved from .bss
+v5670 dd 5670 ; moved from .bss
+v5671 dd 5671 ; moved from .bss
+v5672 dd 5672 ; moved from .bss
+v5673 dd 5673 ; moved from .bss
+v5674 dd 5674 ; moved from .bss
+v5675 dd 5675 ; moved from .bss
+v5676 dd 5676 ; moved from .bss
+v5677 dd 5677 ; moved from .bss
+v5678 dd 5678 ; moved from .bss
+v5679 dd 5679 ; moved from .bss
+v5680 dd 5680 ; moved from .bss
+v5681 dd 5681 ; moved from .bss
+v5682 dd 5682 ; moved from .bss
+v5683 dd 5683 ; moved from .bss
+v5684 dd 5684 ; moved from .bss
+v5685 dd 5685 ; moved from .bss
+v5686 dd 5686 ; moved from .bss
+v5687 dd 5687 ; moved from .bss
+v5688 dd 5688 ; moved from .bss
+v5689 dd 5689 ; moved from .bss
+v5690 dd 5690 ; moved from .bss
+v5691 dd 5691 ; moved from .bss
+v5692 dd 5692 ; moved from .bss
+v5693 dd 5693 ; moved from .bss
+v5694 dd 5694 ; moved from .bss
+v5695 dd 5695 ; moved from .bss
+v5696 dd 5696 ; moved from .bss
+v5697 dd 5697 ; moved from .bss
+v5698 dd 5698 ; moved from .bss
+v5699 dd 5699 ; moved from .bss
+v5700 dd 5700 ; moved from .bss
+v5701 dd 5701 ; moved from .bss
+v5702 dd 5702 ; moved from .bss
+v5703 dd 5703 ; moved from .bss
+v5704 dd 5704 ; moved from .bss
+v5705 dd 5705 ; moved from .bss
+v5706 dd 5706 ; moved from .bss
+v5707 dd 5707 ; moved from .bss
+v5708 dd 5708 ; moved from .bss
+v5709 dd 5709 ; moved from .bss
+v5710 dd 5710 ; moved from .bss
+v5711 dd 5711 ; moved from .bss
+v5712 dd 5712 ; moved from .bss
+v5713 dd 5713 ; moved from .bss
+v5714 dd 5714 ; moved from .bss
+v5715 dd 5715 ; moved from .bss
+v5716 dd 5716 ; moved from .bss
+v5717 dd 5717 ; moved from .bss
+v5718 dd 5718 ; moved from .bss
+v5719 dd 5719 ; moved from .bss
+v5720 dd 5720 ; moved from .bss
+v5721 dd 5721 ; moved from .bss
+v5722 dd 5722 ; moved from .bss
+v5723 dd 5723 ; moved from .bss
+v5724 dd 5724 ; moved from .bss
+v5725 dd 5725 ; moved from .bss
+v5726 dd 5726 ; moved from .bss
+v5727 dd 5727 ; moved from .bss
+v5728 dd 5728 ; moved from .bss
+v5729 dd 5729 ; moved from .bss
+v5730 dd 5730 ; moved from .bss
+v5731 dd 5731 ; moved from .bss
+v5732 dd 5732 ; moved from .bss
+v5733 dd 5733 ; moved from .bss
+v5734 dd 5734 ; moved from .bss
+v5735 dd 5735 ; moved from .bss
+v5736 dd 5736 ; moved from .bss
+v5737 dd 5737 ; moved from .bss
+v5738 dd 5738 ; moved from .bss
+v5739 dd 5739 ; moved from .bss
+v5740 dd 5740 ; moved from .bss
+v5741 dd 5741 ; moved from .bss
+v5742 dd 5742 ; moved from .bss
+v5743 dd 5743 ; moved from .bss
+v5744 dd 5744 ; moved from .bss
+v5745 dd 5745 ; moved from .bss
+v5746 dd 5746 ; moved from .bss
+v5747 dd 5747 ; moved from .bss
+v5748 dd 5748 ; moved from .bss
+v5749 dd 5749 ; moved from .bss
+v5750 dd 5750 ; moved from .bss
+v5751 dd 5751 ; moved from .bss
+v5752 dd 5752 ; moved from .bss
+v5753 dd 5753 ; moved from .bss
+v5754 dd 5754 ; moved from .bss
+v5755 dd 5755 ; moved from .bss
+v5756 dd 5756 ; moved from .bss
+v5757 dd 5757 ; moved from .bss
+v5758 dd 5758 ; moved from .bss
+v5759 dd 5759 ; moved from .bss
+v5760 dd 5760 ; moved from .bss
+v5761 dd 5761 ; moved from .bss
+v5762 dd 5762 ; moved from .bss
+v5763 dd 5763 ; moved from .bss
+v5764 dd 5764 ; moved from .bss
+v5765 dd 5765 ; moved from .bss
+v5766 dd 5766 ; moved from .bss
+v5767 dd 5767 ; moved from .bss
+v5768 dd 5768 ; moved from .bss
+v5769 dd 5769 ; moved from .bss
+v5770 dd 5770 ; moved from .bss
+v5771 dd 5771 ; moved from .bss
+v5772 dd 5772 ; moved from .bss
+v5773 dd 5773 ; moved from .bss
+v5774 dd 5774 ; moved from .bss
+v5775 dd 5775 ; moved from .bss
+v5776 dd 5776 ; moved from .bss
+v5777 dd 5777 ; moved from .bss
+v5778 dd 5778 ; moved from .bss
+v5779 dd 5779 ; moved from .bss
+v5780 dd 5780 ; moved from .bss
+v5781 dd 5781 ; moved from .bss
+v5782 dd 5782 ; moved from .bss
+v5783 dd 5783 ; moved from .bss
+v5784 dd 5784 ; moved from .bss
+v5785 dd 5785 ; moved from .bss
+v5786 dd 5786 ; moved from .bss
+v5787 dd 5787 ; moved from .bss
+v5788 dd 5788 ; moved from .bss
+v5789 dd 5789 ; moved from .bss
+v5790 dd 5790 ; moved from .bss
+v5791 dd 5791 ; moved from .bss
+v5792 dd 5792 ; moved from .bss
+v5793 dd 5793 ; moved from .bss
+v5794 dd 5794 ; moved from .bss
+v5795 dd 5795 ; moved from .bss
+v5796 dd 5796 ; moved from .bss
+v5797 dd 5797 ; moved from .bss
+v5798 dd 5798 ; moved from .bss
+v5799 dd 5799 ; moved from .bss
+v5800 dd 5800 ; moved from .bss
+v5801 dd 5801 ; moved from .bss
+v5802 dd 5802 ; moved from .bss
+v5803 dd 5803 ; moved from .bss
+v5804 dd 5804 ; moved from .bss
+v5805 dd 5805 ; moved from .bss
+v5806 dd 5806 ; moved from .bss
+v5807 dd 5807 ; moved from .bss
+v5808 dd 5808 ; moved from .bss
+v5809 dd 5809 ; moved from .bss
+v5810 dd 5810 ; moved from .bss
+v5811 dd 5811 ; moved from .bss
+v5812 dd 5812 ; moved from .bss
+v5813 dd 5813 ; moved from .bss
+v5814 dd 5814 ; moved from .bss
+v5815 dd 5815 ; moved from .bss
+v5816 dd 5816 ; moved from .bss
+v5817 dd 5817 ; moved from .bss
+v5818 dd 5818 ; moved from .bss
+v5819 dd 5819 ; moved from .bss
+v5820 dd 5820 ; moved from .bss
+v5821 dd 5821 ; moved from .bss
+v5822 dd 5822 ; moved from .bss
+v5823 dd 5823 ; moved from .bss
+v5824 dd 5824 ; moved from .bss
+v5825 dd 5825 ; moved from .bss
+v5826 dd 5826 ; moved from .bss
+v5827 dd 5827 ; moved from .bss
+v5828 dd 5828 ; moved from .bss
+v5829 dd 5829 ; moved from .bss
+v5830 dd 5830 ; moved from .bss
+v5831 dd 5831 ; moved from .bss
+v5832 dd 5832 ; moved from .bss
+v5833 dd 5833 ; moved from .bss
+v5834 dd 5834 ; moved from .bss
+v5835 dd 5835 ; moved from .bss
+v5836 dd 5836 ; moved from .bss
+v5837 dd 5837 ; moved from .bss
+v5838 dd 5838 ; moved from .bss
+v5839 dd 5839 ; moved from .bss
+v5840 dd 5840 ; moved from .bss
+v5841 dd 5841 ; moved from .bss
+v5842 dd 5842 ; moved from .bss
+v5843 dd 5843 ; moved from .bss
+v5844 dd 5844 ; moved from .bss
+v5845 dd 5845 ; moved from .bss
+v5846 dd 5846 ; moved from .bss
+v5847 dd 5847 ; moved from .bss
+v5848 dd 5848 ; moved from .bss
+v5849 dd 5849 ; moved from .bss
+v5850 dd 5850 ; moved from .bss
+v5851 dd 5851 ; moved from .bss
+v5852 dd 5852 ; moved from .bss
+v5853 dd 5853 ; moved from .bss
+v5854 dd 5854 ; moved from .bss
+v5855 dd 5855 ; moved from .bss
+v5856 dd 5856 ; moved from .bss
+v5857 dd 5857 ; moved from .bss
+v5858 dd 5858 ; moved from .bss
+v5859 dd 5859 ; moved from .bss
+v5860 dd 5860 ; moved from .bss
+v5861 dd 5861 ; moved from .bss
+v5862 dd 5862 ; moved from .bss
+v5863 dd 5863 ; moved from .bss
+v5864 dd 5864 ; moved from .bss
+v5865 dd 5865 ; moved from .bss
+v5866 dd 5866 ; moved from .bss
+v5867 dd 5867 ; moved from .bss
+v5868 dd 5868 ; moved from .bss
+v5869 dd 5869 ; moved from .bss
+v5870 dd 5870 ; moved from .bss
+v5871 dd 5871 ; moved from .bss
+v5872 dd 5872 ; moved from .bss
+v5873 dd 5873 ; moved from .bss
+v5874 dd 5874 ; moved from .bss
+v5875 dd 5875 ; moved from .bss
+v5876 dd 5876 ; moved from .bss
+v5877 dd 5877 ; moved from .bss
+v5878 dd 5878 ; moved from .bss
+v5879 dd 5879 ; moved from .bss
+v5880 dd 5880 ; moved from .bss
+v5881 dd 5881 ; moved from .bss
+v5882 dd 5882 ; moved from .bss
+v5883 dd 5883 ; moved from .bss
+v5884 dd 5884 ; moved from .bss
+v5885 dd 5885 ; moved from .bss
+v5886 dd 5886 ; moved from .bss
+v5887 dd 5887 ; moved from .bss
+v5888 dd 5888 ; moved from .bss
+v5889 dd 5889 ; moved from .bss
+v5890 dd 5890 ; moved from .bss
+v5891 dd 5891 ; moved from .bss
+v5892 dd 5892 ; moved from .bss
+v5893 dd 5893 ; moved from .bss
+v5894 dd 5894 ; moved from .bss
+v5895 dd 5895 ; moved from .bss
+v5896 dd 5896 ; moved from .bss
+v5897 dd 5897 ; moved from .bss
+v5898 dd 5898 ; moved from .bss
+v5899 dd 5899 ; moved from .bss
+v5900 dd 5900 ; moved from .bss
+v5901 dd 5901 ; moved from .bss
+v5902 dd 5902 ; moved from .bss
+v5903 dd 5903 ; moved from .bss
+v5904 dd 5904 ; moved from .bss
+v5905 dd 5905 ; moved from .bss
+v5906 dd 5906 ; moved from .bss
+v5907 dd 5907 ; moved from .bss
+v5908 dd 5908 ; moved from .bss
+v5909 dd 5909 ; moved from .bss
+v5910 dd 5910 ; moved from .bss
+v5911 dd 5911 ; moved from .bss
+v5912 dd 5912 ; moved from .bss
+v5913 dd 5913 ; moved from .bss
+v5914 dd 5914 ; moved from .bss
+v5915 dd 5915 ; moved from .bss
+v5916 dd 5916 ; moved from .bss
+v5917 dd 5917 ; moved from .bss
+v5918 dd 5918 ; moved from .bss
+v5919 dd 5919 ; moved from .bss
+v5920 dd 5920 ; moved from .bss
+v5921 dd 5921 ; moved from .bss
+v5922 dd 5922 ; moved from .bss
+v5923 dd 5923 ; moved from .bss
+v5924 dd 5924 ; moved from .bss
+v5925 dd 5925 ; moved from .bss
+v5926 dd 5926 ; moved from .bss
+v5927 dd 5927 ; moved from .bss
+v5928 dd 5928 ; moved from .bss
+v5929 dd 5929 ; moved from .bss
+v5930 dd 5930 ; moved from .bss
+v5931 dd 5931 ; moved from .bss
+v5932 dd 5932 ; moved from .bss
+v5933 dd 5933 ; moved from .bss
+v5934 dd 5934 ; moved from .bss
+v5935 dd 5935 ; moved from .bss
+v5936 dd 5936 ; moved from .bss
+v5937 dd 5937 ; moved from .bss
+v5938 dd 5938 ; moved from .bss
+v5939 dd 5939 ; moved from .bss
+v5940 dd 5940 ; moved from .bss
+v5941 dd 5941 ; moved from .bss
+v5942 dd 5942 ; moved from .bss
+v5943 dd 5943 ; moved from .bss
+v5944 dd 5944 ; moved from .bss
+v5945 dd 5945 ; moved from .bss
+v5946 dd 5946 ; moved from .bss
+v5947 dd 5947 ; moved from .bss
+v5948 dd 5948 ; moved from .bss
+v5949 dd 5949 ; moved from .bss
+v5950 dd 5950 ; moved from .bss
+v5951 dd 5951 ; moved from .bss
+v5952 dd 5952 ; moved from .bss
+v5953 dd 5953 ; moved from .bss
+v5954 dd 5954 ; moved from .bss
+v5955 dd 5955 ; moved from .bss
+v5956 dd 5956 ; moved from .bss
+v5957 dd 5957 ; moved from .bss
+v5958 dd 5958 ; moved from .bss
+v5959 dd 5959 ; moved from .bss
+v5960 dd 5960 ; moved from .bss
+v5961 dd 5961 ; moved from .bss
+v5962 dd 5962 ; moved from .bss
+v5963 dd 5963 ; moved from .bss
+v5964 dd 5964 ; moved from .bss
+v5965 dd 5965 ; moved from .bss
+v5966 dd 5966 ; moved from .bss
+v5967 dd 5967 ; moved from .bss
+v5968 dd 5968 ; moved from .bss
+v5969 dd 5969 ; moved from .bss
+v5970 dd 5970 ; moved from .bss
+v5971 dd 5971 ; moved from .bss
+v5972 dd 5972 ; moved from .bss
+v5973 dd 5973 ; moved from .bss
+v5974 dd 5974 ; moved from .bss
+v5975 dd 5975 ; moved from .bss
+v5976 dd 5976 ; moved from .bss
+v5977 dd 5977 ; moved from .bss
+v5978 dd 5978 ; moved from .bss
+v5979 dd 5979 ; moved from .bss
+v5980 dd 5980 ; moved from .bss
+v5981 dd 5981 ; moved from .bss
+v5982 dd 5982 ; moved from .bss
+v5983 dd 5983 ; moved from .bss
+v5984 dd 5984 ; moved from .bss
+v5985 dd 5985 ; moved from .bss
+v5986 dd 5986 ; moved from .bss
+v5987 dd 5987 ; moved from .bss
+v5988 dd 5988 ; moved from .bss
+v5989 dd 5989 ; moved from .bss
+v5990 dd 5990 ; moved from .bss
+v5991 dd 5991 ; moved from .bss
+v5992 dd 5992 ; moved from .bss
+v5993 dd 5993 ; moved from .bss
+v5994 dd 5994 ; moved from .bss
+v5995 dd 5995 ; moved from .bss
+v5996 dd 5996 ; moved from .bss
+v5997 dd 5997 ; moved from .bss
+v5998 dd 5998 ; moved from .bss
+s5999 db ".text", 0 ; not .text
+section .text ; was .data
+start:
+    ret
@@ -0,0 +1,10 @@
+; enter takes a frame size (iw) and a nesting level (ib, 0 when omitted)
+section .text
+outer:
+    enter 16, 0
+    enter 0x1000, 1
+    enter 8
+    enter 65535, 31
+    leave
+    ret 8
+    ret
@@ -0,0 +1,19 @@
+; times repeats data and instructions; incbin embeds a file, whole or a
+; range of it (paths are relative to the repository root, where
+; tests/run.sh is run from)
+section .data
+    header db 'HDR', 0
+    pad: times 5 db 0xAA
+    words times 3 dw 0x1234
+    times 2 dd 0xDEADBEEF, 7
+    empty times 0 db 1
+    blob incbin "tests/incbin_blob.dat"
+    part incbin "tests/incbin_blob.dat", 250, 12
+    tail incbin "tests/incbin_blob.dat", 508
+    times 4 db 'ab'
+section .text
+    times 3 nop
+    times 2 mov eax, [ebx+8]
+    times 0 ret
+    push blob
+    ret
@@ -0,0 +1,113 @@
+// Sends sources to a running assembler server (./assembler --serve) and
+// writes back what it returns, like a local run of the assembler.
+//
+// Build and run from the repository root:
+//     gcc -O2 -pthread -o asm_client tools/asm_client.c
+//     ./asm_client --socket path [-f elf32|bin] [-Os] [-o output] input.asm...
+// Each input is sent in turn over one connection and its output written
+// to -o (single input only) or the input's name with .o or .bin. The
+// server's messages go to stderr, and the exit status is 1 if any input
+// had errors.
+
+#define ASSEMBLER_NO_MAIN
+#include "../Assembler.c"
+
+// The whole of a file, in buf. Returns 0 if it cannot be read.
+static int read_file(const char *filename, SECTIONBUF *buf)
+{
+    int fd = open(filename, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) < 0) {
+        fprintf(stderr, "Cannot open %s: %s\n", filename, strerror(errno));
+        if (fd >= 0) close(fd);
+        return 0;
+    }
+    buf->size = 0;
+    unsigned char *dest = buffer_reserve(buf, st.st_size, "source");
+    int ok = read_full(fd, dest, st.st_size);
+    if (!ok) fprintf(stderr, "Cannot read %s\n", filename);
+    buf->size = st.st_size;
+    close(fd);
+    return ok;
+}
+
+static int write_file(const char *filename, const SECTIONBUF *buf)
+{
+    FILE *fp = fopen(filename, "wb");
+    int ok = fp && fwrite(buf->data, 1, buf->size, fp) == buf->size;
+    if (fp && fclose(fp) != 0) ok = 0;
+    if (!ok) fprintf(stderr, "Cannot write %s: %s\n", filename, strerror(errno));
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    const char *socket_path = NULL;
+    const char *output = NULL;
+    unsigned int flags = 0;
+    int first = argc;
+
+    for (int i = 1; i < argc && first == argc; i++) {
+        if (strcmp(argv[i], "--socket") == 0 && i + 1 < argc) {
+            socket_path = argv[++i];
+        } else if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+            output = argv[++i];
+        } else if (strcmp(argv[i], "-Os") == 0) {
+            flags |= SERVE_OPTIMIZE_SIZE;
+        } else if (strcmp(argv[i], "-f") == 0 && i + 1 < argc) {
+            const char *format = argv[++i];
+            if (strcmp(format, "bin") == 0) {
+                flags |= SERVE_BIN;
+            } else if (strcmp(format, "elf32") != 0 && strcmp(format, "elf") != 0) {
+                fprintf(stderr, "Unknown output format '%s'\n", format);
+                return 1;
+            }
+        } else if (argv[i][0] != '-') {
+            first = i;
+        } else {
+            break;
+        }
+    }
+    if (!socket_path || first == argc || (output && argc - first > 1)) {
+        fprintf(stderr, "Usage: %s --socket path [-f elf32|bin] [-Os] [-o output] input.asm...\n", argv[0]);
+        return 1;
+    }
+
+    int fd = connect_server(socket_path);
+    if (fd < 0) {
+        fprintf(stderr, "Cannot connect to %s: %s\n", socket_path, strerror(errno));
+        return 1;
+    }
+
+    SECTIONBUF source = {0}, result = {0}, diagnostics = {0};
+    int failed = 0;
+    for (int i = first; i < argc; i++) {
+        const char *input = argv[i];
+        if (!read_file(input, &source)) {
+            failed++;
+            continue;
+        }
+        int errors = remote_assemble(fd, input, (const char *)source.data, source.size, flags, &result,
+                                     &diagnostics);
+        if (errors < 0) {
+            fprintf(stderr, "Lost the connection to %s\n", socket_path);
+            failed++;
+            break;
+        }
+        fputs((const char *)diagnostics.data, stderr);
+        if (errors) {
+            failed++;
+            continue;
+        }
+        char *name = output ? NULL : output_name(input, flags & SERVE_BIN ? ".bin" : ".o");
+        if (!write_file(output ? output : name, &result))
+            failed++;
+        free(name);
+    }
+
+    close(fd);
+    free(source.data);
+    free(result.data);
+    free(diagnostics.data);
+    return failed != 0;
+}
@@ -0,0 +1,354 @@
+// Generates a synthetic .asm corpus for benchmarking, reproducibly from a
+// seed. Instructions are drawn from opcode.csv, so every line assembles.
+//
+// Build and run from the repository root:
+//     gcc -O2 -pthread -o gen_corpus tools/gen_corpus.c
+//     ./gen_corpus [options] > corpus.asm
+// Options:
+//     --seed N           PRNG seed (default 1)
+//     --size N[K|M|G]    approximate source size, 1K to 1G (default 1M)
+//     --mix R:I:M:B      weights of register, immediate, memory and branch
+//                        instructions (default 30:20:40:10)
+//     --labels N         labels per 1000 instructions (default 50)
+//     --data N           percent of lines that are data directives (default 10)
+//     --symbols N        percent of memory operands naming a data symbol (default 10)
+//     --csv file         opcode table (default opcode.csv)
+//     -o file            write there instead of stdout
+//
+// bench/suite.c includes this file (with GEN_CORPUS_NO_MAIN) to generate
+// its corpora in process.
+
+#define ASSEMBLER_NO_MAIN
+#include "../Assembler.c"
+
+// Instruction classes the --mix weights choose between
+enum { MIX_REG, MIX_IMM, MIX_MEM, MIX_BRANCH, MIX_COUNT };
+
+typedef struct {
+    unsigned long long seed;
+    unsigned long long size;        // Bytes of source to write, about
+    int mix[MIX_COUNT];             // Weights of the instruction classes
+    int label_density;              // Labels per 1000 instructions
+    int data_percent;               // Share of lines that are data directives
+    int symbol_percent;             // Memory operands with a data symbol
+} CORPUSCONFIG;
+
+static const CORPUSCONFIG default_corpus = { 1, 1 << 20, {30, 20, 40, 10}, 50, 10, 10 };
+
+static const char *const corpus_regs[8] = { "eax", "ecx", "edx", "ebx", "esp", "ebp", "esi", "edi" };
+
+// Generator state: the output, bytes written so far and the PRNG
+typedef struct {
+    FILE *out;
+    unsigned long long bytes;
+    unsigned long long rng;
+    const CORPUSCONFIG *cfg;
+    long data_symbols;              // d0 .. d<data_symbols - 1> are defined
+} CORPUS;
+
+static void emit(CORPUS *g, const char *fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int n = vfprintf(g->out, fmt, args);
+    va_end(args);
+    if (n > 0) g->bytes += n;
+}
+
+// xorshift64*: fast, and the same stream on every platform
+static unsigned int corpus_random(CORPUS *g) {
+    unsigned long long x = g->rng;
+    x ^= x >> 12;
+    x ^= x << 25;
+    x ^= x >> 27;
+    g->rng = x;
+    return (unsigned int)((x * 2685821657736338717ull) >> 32);
+}
+
+static unsigned int corpus_below(CORPUS *g, unsigned int n) {
+    return n ? corpus_random(g) % n : 0;
+}
+
+// Class of an opcode row, or -1 for operand types the generator skips
+static int opcode_class(const OPCODE *op) {
+    if (strcmp(op->type, "RR") == 0 || strcmp(op->type, "R") == 0 || strcmp(op->type, "NOOP") == 0)
+        return MIX_REG;
+    if (strcmp(op->type, "RI") == 0)
+        return MIX_IMM;
+    if (strcmp(op->type, "RM") == 0 || strcmp(op->type, "MR") == 0 ||
+        strcmp(op->type, "M") == 0 || strcmp(op->type, "MI") == 0)
+        return MIX_MEM;
+    if (strcmp(op->type, "I") == 0) {
+        // Only branches with a rel32 form, so relaxation keeps any target in range
+        if (is_relaxable_branch(op) || op->bytes[0] == 0xE8) return MIX_BRANCH;
+        return branch_rel_size(op) ? -1 : MIX_IMM;
+    }
+    return -1;
+}
+
+// A random memory operand: base, index*scale and displacement, or a data
+// symbol (with an optional base register)
+static void write_memory(CORPUS *g) {
+    static const int scales[4] = { 1, 2, 4, 8 };
+    if (g->data_symbols && (int)corpus_below(g, 100) < g->cfg->symbol_percent) {
+        long sym = corpus_below(g, (unsigned int)g->data_symbols);
+        if (corpus_below(g, 2))
+            emit(g, "[%s+d%ld]", corpus_regs[corpus_below(g, 8)], sym);
+        else
+            emit(g, "[d%ld]", sym);
+        return;
+    }
+
+    int base = (int)corpus_below(g, 9) - 1;              // -1: no base
+    int index = corpus_below(g, 3) ? -1 : (int)corpus_below(g, 8);
+    if (index == 4) index = -1;                           // esp cannot be an index
+    int disp = 0;
+    switch (corpus_below(g, 4)) {
+        case 0: break;
+        case 1: disp = (int)corpus_below(g, 256) - 128; break;
+        case 2: disp = (int)corpus_below(g, 1 << 16); break;
+        default: disp = (int)corpus_below(g, 64) * 4; break;
+    }
+    if (base < 0 && index < 0) {
+        emit(g, "[0x%x]", (unsigned int)disp & 0xFFFFF);
+        return;
+    }
+
+    emit(g, "[%s", base >= 0 ? corpus_regs[base] : "");
+    if (index >= 0)
+        emit(g, "%s%s*%d", base >= 0 ? "+" : "", corpus_regs[index], scales[corpus_below(g, 4)]);
+    if (disp > 0) emit(g, "+%d]", disp);
+    else if (disp < 0) emit(g, "-%d]", -disp);
+    else emit(g, "]");
+}
+
+static int random_immediate(CORPUS *g) {
+    switch (corpus_below(g, 4)) {
+        case 0: return (int)corpus_below(g, 16);
+        case 1: return (int)corpus_below(g, 256) - 128;
+        case 2: return (int)corpus_below(g, 1 << 20);
+        default: return (int)corpus_random(g);
+    }
+}
+
+// One instruction of op's operand type; branches go to labels near label
+static void write_instruction(CORPUS *g, const OPCODE *op, long label) {
+    const char *reg = corpus_regs[corpus_below(g, 8)];
+    const char *t = op->type;
+    char mnemonic[sizeof(op->mnemonic)];
+    for (int i = 0; ; i++) {
+        mnemonic[i] = (char)tolower((unsigned char)op->mnemonic[i]);
+        if (!op->mnemonic[i]) break;
+    }
+
+    if (strcmp(t, "NOOP") == 0) {
+        emit(g, "    %s\n", mnemonic);
+    } else if (strcmp(t, "R") == 0) {
+        emit(g, "    %s %s\n", mnemonic, reg);
+    } else if (strcmp(t, "RR") == 0) {
+        emit(g, "    %s %s, %s\n", mnemonic, reg, corpus_regs[corpus_below(g, 8)]);
+    } else if (strcmp(t, "RI") == 0) {
+        int imm = random_immediate(g);
+        if (op->bytes[0] == 0xC1 || op->bytes[0] == 0xE4) imm &= 31;   // Shift counts and ports
+        emit(g, "    %s %s, %d\n", mnemonic, reg, imm);
+    } else if (strcmp(t, "RM") == 0) {
+        emit(g, "    %s %s, ", mnemonic, reg);
+        write_memory(g);
+        emit(g, "\n");
+    } else if (strcmp(t, "MR") == 0) {
+        emit(g, "    %s ", mnemonic);
+        write_memory(g);
+        emit(g, ", %s\n", reg);
+    } else if (strcmp(t, "M") == 0 || strcmp(t, "MI") == 0) {
+        emit(g, "    %s dword ", mnemonic);
+        write_memory(g);
+        if (t[1] == 'I') {
+            int imm = random_immediate(g);
+            if (op->bytes[0] == 0xC1) imm &= 31;
+            emit(g, ", %d", imm);
+        }
+        emit(g, "\n");
+    } else if (opcode_class(op) == MIX_BRANCH) {
+        // A nearby label: mostly backwards, like loops, sometimes the next one
+        long target = label - (long)corpus_below(g, 8) + 1;
+        emit(g, "    %s L%ld\n", mnemonic, target < 0 ? 0 : target);
+    } else if (op->bytes[0] == 0xC2 || op->bytes[0] == 0xC8) {
+        emit(g, "    %s %d\n", mnemonic, (int)corpus_below(g, 256) * 4);   // ret/enter imm16
+    } else {
+        emit(g, "    %s %d\n", mnemonic, random_immediate(g));
+    }
+}
+
+// One data directive defining the next d<n>
+static void write_data(CORPUS *g) {
+    static const char *const directives[4] = { "db", "dw", "dd", "dq" };
+    static const unsigned long long limits[4] = { 256, 65536, 1ull << 32, 0 };
+    long symbol = g->data_symbols++;
+    int kind = corpus_below(g, 8);
+
+    if (kind == 0) {
+        emit(g, "d%ld db \"message %ld\", 10, 0\n", symbol, symbol);
+    } else if (kind == 1) {
+        emit(g, "d%ld: times %u db 0\n", symbol, corpus_below(g, 64) + 1);
+    } else {
+        int width = corpus_below(g, 4);
+        int values = corpus_below(g, 8) + 1;
+        emit(g, "d%ld %s ", symbol, directives[width]);
+        for (int i = 0; i < values; i++) {
+            unsigned long long v = ((unsigned long long)corpus_random(g) << 32) | corpus_random(g);
+            if (limits[width]) v %= limits[width];
+            emit(g, corpus_below(g, 4) ? "%s%llu" : "%s0x%llx", i ? ", " : "", v);
+        }
+        emit(g, "\n");
+    }
+}
+
+// Write a corpus to out. Returns the number of lines, or -1 if the opcode
+// table cannot be loaded or has nothing to draw from. The table is loaded
+// from csv for the draw and released again, so the assembler goes back
+// to its built-in table.
+long generate_corpus(const CORPUSCONFIG *cfg, const char *csv, FILE *out) {
+    if (!load_opcode_table(csv))
+        return -1;
+
+    // Rows by class, first row of each (mnemonic, type) only
+    int *rows[MIX_COUNT];
+    int counts[MIX_COUNT] = {0};
+    for (int c = 0; c < MIX_COUNT; c++) {
+        rows[c] = malloc(opcode_count * sizeof(int));
+        if (!rows[c]) {
+            fprintf(stderr, "Out of memory generating corpus!\n");
+            exit(1);
+        }
+    }
+    for (int i = 0; i < opcode_count; i++) {
+        const OPCODE *op = &opcode_table[i];
+        int c = opcode_class(op);
+        if (c >= 0 && find_opcode(op->mnemonic, op->type) == op)
+            rows[c][counts[c]++] = i;
+    }
+
+    int total_weight = 0;
+    for (int c = 0; c < MIX_COUNT; c++)
+        total_weight += counts[c] ? cfg->mix[c] : 0;
+
+    long lines = -1;
+    if (total_weight > 0) {
+        CORPUS g = { out, 0, cfg->seed * 0x9E3779B97F4A7C15ull + 1, cfg, 0 };
+        long label = 0, max_target = 0;
+
+        emit(&g, "; Generated by tools/gen_corpus.c, seed %llu\n", cfg->seed);
+        emit(&g, "section .text\n    global main\nmain:\nL0:\n");
+        lines = 5;
+        while (g.bytes < cfg->size) {
+            // A block of data lines now and then, in .data
+            if ((int)corpus_below(&g, 100) < cfg->data_percent * 2 / 3) {
+                int n = corpus_below(&g, 16) + 1;
+                emit(&g, "section .data\n");
+                for (int i = 0; i < n; i++)
+                    write_data(&g);
+                emit(&g, "section .text\n");
+                lines += n + 2;
+            }
+
+            // Then a run of instructions
+            for (int i = 0; i < 16; i++) {
+                if ((int)corpus_below(&g, 1000) < cfg->label_density) {
+                    emit(&g, "L%ld:\n", ++label);
+                    lines++;
+                }
+                unsigned int pick = corpus_below(&g, total_weight);
+                int c = 0;
+                while (!counts[c] || pick >= (unsigned int)cfg->mix[c]) {
+                    pick -= counts[c] ? cfg->mix[c] : 0;
+                    c++;
+                }
+                write_instruction(&g, &opcode_table[rows[c][corpus_below(&g, counts[c])]], label);
+                if (c == MIX_BRANCH && label + 1 > max_target)
+                    max_target = label + 1;
+                lines++;
+            }
+        }
+
+        // Forward branch targets that were never reached
+        while (label < max_target) {
+            emit(&g, "L%ld:\n", ++label);
+            lines++;
+        }
+        emit(&g, "    ret\n");
+        lines++;
+    }
+
+    for (int c = 0; c < MIX_COUNT; c++)
+        free(rows[c]);
+    free_opcode_table();
+    return lines;
+}
+
+// "64K", "16M", "1G" or plain bytes; 0 if malformed
+unsigned long long parse_size(const char *s) {
+    char *end;
+    unsigned long long n = strtoull(s, &end, 10);
+    switch (toupper((unsigned char)*end)) {
+        case 'K': n <<= 10; end++; break;
+        case 'M': n <<= 20; end++; break;
+        case 'G': n <<= 30; end++; break;
+        default: break;
+    }
+    return *end ? 0 : n;
+}
+
+#ifndef GEN_CORPUS_NO_MAIN
+int main(int argc, char **argv) {
+    CORPUSCONFIG cfg = default_corpus;
+    const char *csv = OPCODE_FILE;
+    const char *output = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : NULL;
+        int ok = value != NULL;
+        if (strcmp(arg, "--seed") == 0 && value) {
+            cfg.seed = strtoull(value, NULL, 10);
+        } else if (strcmp(arg, "--size") == 0 && value) {
+            cfg.size = parse_size(value);
+            ok = cfg.size >= 1 << 10 && cfg.size <= 1ull << 30;
+        } else if (strcmp(arg, "--mix") == 0 && value) {
+            ok = sscanf(value, "%d:%d:%d:%d", &cfg.mix[0], &cfg.mix[1], &cfg.mix[2], &cfg.mix[3]) == 4 &&
+                 cfg.mix[0] >= 0 && cfg.mix[1] >= 0 && cfg.mix[2] >= 0 && cfg.mix[3] >= 0;
+        } else if (strcmp(arg, "--labels") == 0 && value) {
+            cfg.label_density = atoi(value);
+            ok = cfg.label_density >= 0 && cfg.label_density <= 1000;
+        } else if (strcmp(arg, "--data") == 0 && value) {
+            cfg.data_percent = atoi(value);
+            ok = cfg.data_percent >= 0 && cfg.data_percent <= 100;
+        } else if (strcmp(arg, "--symbols") == 0 && value) {
+            cfg.symbol_percent = atoi(value);
+            ok = cfg.symbol_percent >= 0 && cfg.symbol_percent <= 100;
+        } else if (strcmp(arg, "--csv") == 0 && value) {
+            csv = value;
+        } else if (strcmp(arg, "-o") == 0 && value) {
+            output = value;
+        } else {
+            ok = 0;
+        }
+        if (!ok) {
+            fprintf(stderr, "Usage: %s [--seed N] [--size N[K|M|G]] [--mix R:I:M:B] [--labels N] "
+                            "[--data N] [--symbols N] [--csv file] [-o file]\n", argv[0]);
+            return 1;
+        }
+        i++;
+    }
+
+    FILE *out = output ? fopen(output, "w") : stdout;
+    if (!out) {
+        perror("Cannot create corpus file");
+        return 1;
+    }
+    long lines = generate_corpus(&cfg, csv, out);
+    if (lines < 0)
+        fprintf(stderr, "gen_corpus: no instructions to draw from %s\n", csv);
+    if ((output && fclose(out) != 0) || (!output && fflush(out) != 0))
+        lines = -1;
+    return lines < 0;
+}
+#endif
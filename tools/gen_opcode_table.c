@@ -0,0 +1,118 @@
+// Generates opcode_table.h, the compiled-in opcode table, from opcode.csv.
+//
+// Build and run from the repository root whenever opcode.csv changes:
+//     gcc -O2 -o gen_opcode_table tools/gen_opcode_table.c
+//     ./gen_opcode_table opcode.csv > opcode_table.h
+//
+// The CSV is parsed with the assembler's own loader, then laid out as a
+// perfect hash ("hash and displace"): keys are grouped into buckets by
+// their hash, and each bucket gets a displacement that sends all of its
+// keys to free slots. Lookups then need exactly one probe.
+
+#define ASSEMBLER_NO_MAIN
+#define OPCODE_NO_BUILTIN
+#include "../Assembler.c"
+
+#define SLOTS 256
+#define BUCKETS 64
+#define MAX_DISP 65535
+
+static int bucket_keys[BUCKETS][SLOTS];
+static int bucket_size[BUCKETS];
+static int slot_entry[SLOTS];       // Entry index + 1, 0 = free
+static unsigned int disp[BUCKETS];
+
+static int try_displacement(int b, unsigned int d, unsigned int *hashes)
+{
+    int taken[SLOTS];
+    for (int k = 0; k < bucket_size[b]; k++) {
+        int slot = opcode_slot(hashes[bucket_keys[b][k]], d) & (SLOTS - 1);
+        if (slot_entry[slot]) return 0;
+        for (int j = 0; j < k; j++) {
+            if (taken[j] == slot) return 0;
+        }
+        taken[k] = slot;
+    }
+    for (int k = 0; k < bucket_size[b]; k++)
+        slot_entry[taken[k]] = bucket_keys[b][k] + 1;
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    const char *csv = argc > 1 ? argv[1] : OPCODE_FILE;
+
+    if (!load_opcode_table(csv)) {
+        fprintf(stderr, "gen_opcode_table: no opcodes loaded from %s\n", csv);
+        return 1;
+    }
+
+    unsigned int *hashes = malloc(opcode_count * sizeof(unsigned int));
+    int unique = 0;
+    for (int i = 0; i < opcode_count; i++) {
+        OPCODE *op = &opcode_table[i];
+        hashes[i] = opcode_hash(op->mnemonic, op->type);
+
+        // Duplicate (mnemonic, type) rows: the first one wins, as at runtime
+        if (find_opcode(op->mnemonic, op->type) != op)
+            continue;
+
+        int b = hashes[i] & (BUCKETS - 1);
+        bucket_keys[b][bucket_size[b]++] = i;
+        unique++;
+    }
+    if (unique > SLOTS * 3 / 4) {
+        fprintf(stderr, "gen_opcode_table: %d opcodes do not fit in %d slots\n", unique, SLOTS);
+        return 1;
+    }
+
+    // Place the fullest buckets first while most slots are still free
+    int order[BUCKETS];
+    for (int b = 0; b < BUCKETS; b++) order[b] = b;
+    for (int i = 1; i < BUCKETS; i++) {
+        int b = order[i], j = i;
+        while (j > 0 && bucket_size[order[j - 1]] < bucket_size[b]) {
+            order[j] = order[j - 1];
+            j--;
+        }
+        order[j] = b;
+    }
+
+    for (int i = 0; i < BUCKETS; i++) {
+        int b = order[i];
+        unsigned int d = 0;
+        while (bucket_size[b] && !try_displacement(b, d, hashes)) {
+            if (++d > MAX_DISP) {
+                fprintf(stderr, "gen_opcode_table: no displacement found for bucket %d\n", b);
+                return 1;
+            }
+        }
+        disp[b] = d;
+    }
+
+    printf("// Generated by tools/gen_opcode_table.c from %s - do not edit.\n", csv);
+    printf("// %d opcodes in a perfect hash of %d slots; see find_builtin_opcode().\n\n", unique, SLOTS);
+    printf("#define BUILTIN_OPCODE_COUNT %d\n", unique);
+    printf("#define BUILTIN_OPCODE_SLOTS %d\n", SLOTS);
+    printf("#define BUILTIN_OPCODE_BUCKETS %d\n\n", BUCKETS);
+
+    printf("static const unsigned short builtin_opcode_disp[BUILTIN_OPCODE_BUCKETS] = {");
+    for (int b = 0; b < BUCKETS; b++)
+        printf("%s%u%s", b % 12 ? " " : "\n    ", disp[b], b + 1 < BUCKETS ? "," : "");
+    printf("\n};\n\n");
+
+    printf("static const OPCODE builtin_opcodes[BUILTIN_OPCODE_SLOTS] = {\n");
+    for (int slot = 0; slot < SLOTS; slot++) {
+        if (!slot_entry[slot]) continue;
+        OPCODE *op = &opcode_table[slot_entry[slot] - 1];
+        printf("    [%3d] = {\"%s\", \"%s\", {", slot, op->mnemonic, op->type);
+        for (int k = 0; k < op->len; k++)
+            printf("%s0x%02X", k ? ", " : "", op->bytes[k]);
+        printf("}, %d, %d},\n", op->len, op->ext);
+    }
+    printf("};\n");
+
+    free(hashes);
+    free_opcode_table();
+    return 0;
+}